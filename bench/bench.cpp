@@ -0,0 +1,296 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+
+namespace pel::bench
+{
+/*************************************************************************************************/
+/* Type definitions ---------------------------------------------------------------------------- */
+enum class output_format
+{
+    table,
+    csv,
+    json,
+};
+
+struct options
+{
+    output_format             format = output_format::table;
+    std::string_view          filter;
+    std::chrono::milliseconds minimumCaseDuration{50};
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the list of all registered benchmark cases.
+ *
+ * \retval      std::vector<benchmark_case>&: Registered cases, in registration order.
+ *************************************************************************************************/
+std::vector<benchmark_case>&
+registry()
+{
+    static std::vector<benchmark_case> cases;
+    return cases;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Register a benchmark case.
+ *
+ * \param       group_:             Name of the group the case belongs to (ie "copy").
+ * \param       container_:         Name of the benchmarked container (ie "pel::array").
+ * \param       itemType_:          Name of the type of the items in the container.
+ * \param       itemCount_:         Number of items in the container.
+ * \param       bytesPerIteration_: Number of bytes processed by one iteration of the case.
+ * \param       function_:          Function running the case.
+ *************************************************************************************************/
+void
+add(std::string  group_,
+    std::string  container_,
+    std::string  itemType_,
+    std::size_t  itemCount_,
+    std::size_t  bytesPerIteration_,
+    CaseFunction function_)
+{
+    registry().push_back({std::move(group_),
+                          std::move(container_),
+                          std::move(itemType_),
+                          itemCount_,
+                          bytesPerIteration_,
+                          function_});
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Run a benchmark case, doubling the number of iterations until the case runs for
+ *              at least `minimumCaseDuration_`.
+ *
+ * \param       case_:                Case to run.
+ * \param       minimumCaseDuration_: Minimum measured duration of the case.
+ *
+ * \retval      benchmark_result: Timing of the last (longest) run.
+ *************************************************************************************************/
+static benchmark_result
+run(const benchmark_case& case_, std::chrono::milliseconds minimumCaseDuration_)
+{
+    std::size_t              iterations = 1;
+    std::chrono::nanoseconds elapsed{0};
+
+    while(true)
+    {
+        state caseState{iterations};
+        case_.function(caseState);
+        elapsed = caseState.elapsed();
+
+        if(elapsed >= minimumCaseDuration_)
+        {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    const double nanoseconds  = static_cast<double>(elapsed.count());
+    const double perIteration = nanoseconds / static_cast<double>(iterations);
+
+    return {&case_,
+            iterations,
+            perIteration,
+            static_cast<double>(case_.bytesPerIteration) * 1e9 / perIteration};
+}
+
+
+/*************************************************************************************************/
+/* Output -------------------------------------------------------------------------------------- */
+
+static void
+print_header(output_format format_)
+{
+    switch(format_)
+    {
+        case output_format::table:
+            std::printf("%-20s %-30s %-12s %10s %12s %14s %12s\n",
+                        "group",
+                        "container",
+                        "item",
+                        "count",
+                        "iterations",
+                        "ns/iter",
+                        "MB/s");
+            break;
+        case output_format::csv:
+            std::printf("group,container,item_type,item_count,iterations,ns_per_iteration,"
+                        "bytes_per_second\n");
+            break;
+        case output_format::json:
+            std::printf("[\n");
+            break;
+    }
+}
+
+static void
+print_result(output_format format_, const benchmark_result& result_, bool first_)
+{
+    const benchmark_case& benchmarkCase = *result_.benchmarkCase;
+
+    switch(format_)
+    {
+        case output_format::table:
+            std::printf("%-20s %-30s %-12s %10zu %12zu %14.2f %12.1f\n",
+                        benchmarkCase.group.c_str(),
+                        benchmarkCase.container.c_str(),
+                        benchmarkCase.itemType.c_str(),
+                        benchmarkCase.itemCount,
+                        result_.iterations,
+                        result_.nanosecondsPerIteration,
+                        result_.bytesPerSecond / 1e6);
+            break;
+        case output_format::csv:
+            std::printf("%s,%s,%s,%zu,%zu,%.3f,%.1f\n",
+                        benchmarkCase.group.c_str(),
+                        benchmarkCase.container.c_str(),
+                        benchmarkCase.itemType.c_str(),
+                        benchmarkCase.itemCount,
+                        result_.iterations,
+                        result_.nanosecondsPerIteration,
+                        result_.bytesPerSecond);
+            break;
+        case output_format::json:
+            std::printf("%s  {\"group\": \"%s\", \"container\": \"%s\", \"item_type\": \"%s\", "
+                        "\"item_count\": %zu, \"iterations\": %zu, \"ns_per_iteration\": %.3f, "
+                        "\"bytes_per_second\": %.1f}",
+                        first_ ? "" : ",\n",
+                        benchmarkCase.group.c_str(),
+                        benchmarkCase.container.c_str(),
+                        benchmarkCase.itemType.c_str(),
+                        benchmarkCase.itemCount,
+                        result_.iterations,
+                        result_.nanosecondsPerIteration,
+                        result_.bytesPerSecond);
+            break;
+    }
+    std::fflush(stdout);
+}
+
+static void
+print_footer(output_format format_)
+{
+    if(format_ == output_format::json)
+    {
+        std::printf("\n]\n");
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Parse the command line options.
+ *
+ *              --format=table|csv|json   Output format [defaults : table]
+ *              --filter=<group>          Only run the cases of a group
+ *              --min-time=<ms>           Minimum measured duration of each case [defaults : 50]
+ *************************************************************************************************/
+static options
+parse_options(int argc_, char** argv_)
+{
+    options parsed;
+
+    for(int i = 1; i < argc_; ++i)
+    {
+        const std::string_view argument{argv_[i]};
+
+        if(argument == "--format=csv")
+        {
+            parsed.format = output_format::csv;
+        }
+        else if(argument == "--format=json")
+        {
+            parsed.format = output_format::json;
+        }
+        else if(argument == "--format=table")
+        {
+            parsed.format = output_format::table;
+        }
+        else if(argument.starts_with("--filter="))
+        {
+            parsed.filter = argument.substr(std::strlen("--filter="));
+        }
+        else if(argument.starts_with("--min-time="))
+        {
+            parsed.minimumCaseDuration =
+              std::chrono::milliseconds{std::atoi(argv_[i] + std::strlen("--min-time="))};
+        }
+        else
+        {
+            std::fprintf(stderr,
+                         "Usage: %s [--format=table|csv|json] [--filter=<group>] "
+                         "[--min-time=<ms>]\n",
+                         argv_[0]);
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    return parsed;
+}
+
+}        // namespace pel::bench
+
+
+int
+main(int argc, char** argv)
+{
+    const pel::bench::options options = pel::bench::parse_options(argc, argv);
+
+    pel::bench::print_header(options.format);
+
+    bool first = true;
+    for(const pel::bench::benchmark_case& benchmarkCase : pel::bench::registry())
+    {
+        if(!options.filter.empty() && (options.filter != benchmarkCase.group))
+        {
+            continue;
+        }
+
+        const pel::bench::benchmark_result result =
+          pel::bench::run(benchmarkCase, options.minimumCaseDuration);
+        pel::bench::print_result(options.format, result, first);
+        first = false;
+    }
+
+    pel::bench::print_footer(options.format);
+
+    return 0;
+}
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
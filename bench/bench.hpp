@@ -0,0 +1,161 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace pel::bench
+{
+/*************************************************************************************************/
+/* Benchmark state ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       State handed to a benchmark case: the number of iterations to run, and the timer
+ *              measuring them.
+ *
+ * \note        A case prepares its data first, then calls `measure` with the body of one
+ *              iteration. Only the iterations are timed.
+ *************************************************************************************************/
+class state
+{
+public:
+    constexpr explicit state(std::size_t iterations_) noexcept : m_iterations{iterations_}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t iterations() const noexcept
+    {
+        return m_iterations;
+    }
+    [[nodiscard]] constexpr std::chrono::nanoseconds elapsed() const noexcept
+    {
+        return m_elapsed;
+    }
+
+    template<typename BodyType>
+    void measure(BodyType body_)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < m_iterations; ++i)
+        {
+            body_();
+        }
+        m_elapsed = std::chrono::steady_clock::now() - start;
+    }
+
+private:
+    std::size_t              m_iterations;
+    std::chrono::nanoseconds m_elapsed{0};
+};
+
+
+/*************************************************************************************************/
+/* Type definitions ---------------------------------------------------------------------------- */
+
+using CaseFunction = void (*)(state& state_);
+
+struct benchmark_case
+{
+    std::string  group;
+    std::string  container;
+    std::string  itemType;
+    std::size_t  itemCount;
+    std::size_t  bytesPerIteration;
+    CaseFunction function;
+};
+
+struct benchmark_result
+{
+    const benchmark_case* benchmarkCase;
+    std::size_t           iterations;
+    double                nanosecondsPerIteration;
+    double                bytesPerSecond;
+};
+
+
+/*************************************************************************************************/
+/* Registration -------------------------------------------------------------------------------- */
+std::vector<benchmark_case>& registry();
+
+void add(std::string  group_,
+         std::string  container_,
+         std::string  itemType_,
+         std::size_t  itemCount_,
+         std::size_t  bytesPerIteration_,
+         CaseFunction function_);
+
+
+/*************************************************************************************************/
+/* Optimization barriers ----------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Prevent the compiler from optimizing away the computation of `value_`.
+ *
+ * \param       value_: Value that must be considered as read.
+ *************************************************************************************************/
+template<typename ValueType>
+inline void
+do_not_optimize(const ValueType& value_)
+{
+#if defined(_MSC_VER)
+    const volatile void* sink = std::addressof(value_);
+    static_cast<void>(sink);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r"(std::addressof(value_)) : "memory");
+#endif
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Force all pending memory writes to be considered as observed.
+ *************************************************************************************************/
+inline void
+clobber_memory()
+{
+#if defined(_MSC_VER)
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : : "memory");
+#endif
+}
+
+}        // namespace pel::bench
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
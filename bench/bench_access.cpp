@@ -0,0 +1,141 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+
+/*************************************************************************************************/
+/* Assignment, iteration and formatting -------------------------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+template<typename ContainerType>
+struct assign_value
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        constexpr std::size_t count = container_traits<ContainerType>::count;
+
+        std::unique_ptr<ContainerType> container = make_filled<ContainerType>();
+        const ItemType                 value     = sample_item<ItemType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container->assign(value, 0, count);
+              }
+              else
+              {
+                  std::fill(container->begin(), container->end(), value);
+              }
+              do_not_optimize(*container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct iterate
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        std::unique_ptr<ContainerType> container = make_filled<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              double total = 0.0;
+              for(const ItemType& item : *container)
+              {
+                  if constexpr(std::is_same_v<ItemType, std::string>)
+                  {
+                      total += static_cast<double>(item.size());
+                  }
+                  else
+                  {
+                      total += static_cast<double>(item);
+                  }
+              }
+              do_not_optimize(total);
+          });
+    }
+};
+
+/* std::array and T[N] are formatted like `pel::array::to_string` does */
+template<typename ContainerType>
+struct to_string
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        constexpr std::size_t count = container_traits<ContainerType>::count;
+
+        std::unique_ptr<ContainerType> container = make_filled<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              std::string text;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  text = container->to_string();
+              }
+              else
+              {
+                  std::ostringstream os;
+                  os << "Length: [" << count << "]\n";
+                  for(const ItemType& item : *container)
+                  {
+                      os << item << '\n';
+                  }
+                  text = os.str();
+              }
+              do_not_optimize(text);
+          });
+    }
+};
+
+const bool registered = []
+{
+    add_all_cases<assign_value>("assign");
+    add_all_cases<iterate>("iterate");
+    add_all_cases<to_string>("to_string");
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,136 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+
+#include <cstdint>
+
+
+/*************************************************************************************************/
+/* Bounds checking policies against T[N] ------------------------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+/* Ways of reading an element of the benchmarked container */
+enum class access
+{
+    subscript,
+    at,
+    unchecked,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Sum the elements of a container in a scattered order known only at run-time, so
+ *              that the compiler cannot prove any index in bounds and remove the checks itself.
+ *
+ * \note        An unchecked `pel::array` is expected to run, and to compile, exactly like `T[N]`.
+ *************************************************************************************************/
+template<typename ContainerType, access Access>
+struct indexed_read
+{
+    static void run(state& state_)
+    {
+        constexpr std::size_t count = container_traits<ContainerType>::count;
+
+        std::unique_ptr<ContainerType>                    container = make_filled<ContainerType>();
+        std::unique_ptr<raw_array<std::uint32_t, count>> indexes =
+          std::make_unique<raw_array<std::uint32_t, count>>();
+
+        /* 7919 is odd, so every index of a power-of-two count is visited exactly once */
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            indexes->items[i] = static_cast<std::uint32_t>((i * 7919U) % count);
+        }
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              float total = 0.0f;
+              for(std::uint32_t index : *indexes)
+              {
+                  if constexpr(!is_pel_array<ContainerType>)
+                  {
+                      total += container->items[index];
+                  }
+                  else if constexpr(Access == access::at)
+                  {
+                      total += container->at(index);
+                  }
+                  else if constexpr(Access == access::unchecked)
+                  {
+                      total += container->unchecked(index);
+                  }
+                  else
+                  {
+                      total += (*container)[index];
+                  }
+              }
+              do_not_optimize(total);
+          });
+    }
+};
+
+template<std::size_t ItemCount>
+void
+add_bounds_cases(const char* group_)
+{
+    using namespace pel::bounds_check;
+
+    constexpr std::size_t bytes = (sizeof(float) + sizeof(std::uint32_t)) * ItemCount;
+
+    const auto addCase = [&](const char* container_, CaseFunction function_)
+    { add(group_, container_, "float", ItemCount, bytes, function_); };
+
+    addCase("pel::array<checked>[]",
+            &indexed_read<pel::array<float, ItemCount, checked>, access::subscript>::run);
+    addCase("pel::array<checked>.at",
+            &indexed_read<pel::array<float, ItemCount, checked>, access::at>::run);
+    addCase("pel::array<checked>.unchecked",
+            &indexed_read<pel::array<float, ItemCount, checked>, access::unchecked>::run);
+    addCase("pel::array<sizes_only>[]",
+            &indexed_read<pel::array<float, ItemCount, sizes_only>, access::subscript>::run);
+    addCase("pel::array<assert_only>[]",
+            &indexed_read<pel::array<float, ItemCount, assert_only>, access::subscript>::run);
+    addCase("pel::array<trap>[]",
+            &indexed_read<pel::array<float, ItemCount, trap>, access::subscript>::run);
+    addCase("pel::array<unchecked>[]",
+            &indexed_read<pel::array<float, ItemCount, unchecked>, access::subscript>::run);
+    addCase("T[N]", &indexed_read<raw_array<float, ItemCount>, access::subscript>::run);
+}
+
+const bool registered = []
+{
+    add_bounds_cases<64>("indexed_read");
+    add_bounds_cases<1024>("indexed_read");
+    add_bounds_cases<16384>("indexed_read");
+    add_bounds_cases<1 << 20>("indexed_read");
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
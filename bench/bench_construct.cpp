@@ -0,0 +1,372 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <tuple>
+
+
+/*************************************************************************************************/
+/* Construction: every pel::array constructor against its std::array and T[N] equivalent ------- */
+namespace
+{
+using namespace pel::bench;
+
+/**
+ **************************************************************************************************
+ * \brief       Arguments forwarded to the variadic constructor. They are deliberately not of the
+ *              item type, so that `pel::array`'s variadic constructor is the one selected.
+ *************************************************************************************************/
+template<typename ItemType>
+[[nodiscard]] auto
+variadic_arguments()
+{
+    if constexpr(std::is_same_v<ItemType, std::string>)
+    {
+        return std::make_tuple(std::size_t{24}, 'x');
+    }
+    else
+    {
+        return std::make_tuple(1);
+    }
+}
+
+template<typename ContainerType>
+struct construct_value
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+        const ItemType                       value   = sample_item<ItemType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container = ::new(storage->bytes) ContainerType(value);
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType;
+                  std::fill(container->begin(), container->end(), value);
+              }
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct construct_range
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType>       source  = make_filled<ContainerType>();
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container = ::new(storage->bytes) ContainerType(source->begin(), source->end());
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType;
+                  std::copy(source->begin(), source->end(), container->begin());
+              }
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+/* Four items from an initializer list, the remaining items being default-constructed */
+template<typename ContainerType>
+struct construct_initializer_list
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+        const ItemType                       value   = sample_item<ItemType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container =
+                ::new(storage->bytes) ContainerType{value, value, value, value};
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct construct_variadic
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        std::unique_ptr<slot<ContainerType>> storage   = make_slot<ContainerType>();
+        const auto                           arguments = variadic_arguments<ItemType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container = std::apply(
+                    [&](const auto&... arguments_)
+                    {
+                        return ::new(storage->bytes) ContainerType(arguments_...);
+                    },
+                    arguments);
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType;
+                  for(ItemType& item : *container)
+                  {
+                      item = std::make_from_tuple<ItemType>(arguments);
+                  }
+              }
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct construct_generator
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+        const ItemType                       value   = sample_item<ItemType>();
+
+        auto generator = [&value]
+        {
+            return value;
+        };
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container = ::new(storage->bytes) ContainerType(generator);
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType;
+                  std::generate(container->begin(), container->end(), generator);
+              }
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct construct_indexed_generator
+{
+    static void run(state& state_)
+    {
+        using ItemType = typename container_traits<ContainerType>::ItemType;
+
+        constexpr std::size_t count = container_traits<ContainerType>::count;
+
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+        const ItemType                       value   = sample_item<ItemType>();
+
+        auto generator = [&value](std::size_t index_)
+        {
+            if constexpr(std::is_same_v<ItemType, std::string>)
+            {
+                return value.substr(index_ % value.size());
+            }
+            else
+            {
+                return static_cast<ItemType>(index_);
+            }
+        };
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(is_pel_array<ContainerType>)
+              {
+                  container = ::new(storage->bytes) ContainerType(generator);
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType;
+                  for(std::size_t i = 0; i < count; ++i)
+                  {
+                      container->begin()[i] = generator(i);
+                  }
+              }
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Item whose every constructor computes a small table: building an item twice, by
+ *              default-constructing it then assigning it, costs twice as much.
+ *************************************************************************************************/
+struct expensive_item
+{
+    /* Not a constant, so that the default table isn't computed at compile-time */
+    static inline double defaultSeed = 1.0;
+
+    expensive_item() noexcept : expensive_item(defaultSeed)
+    {
+    }
+    explicit expensive_item(double seed_) noexcept
+    {
+        for(std::size_t i = 0; i < std::size(table); ++i)
+        {
+            table[i] = std::sqrt(seed_ + static_cast<double>(i));
+        }
+    }
+
+    double table[16];
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Value-initializes a large buffer or leaves it uninitialized, then overwrites it.
+ *************************************************************************************************/
+template<bool ForOverwrite>
+struct construct_overwritten
+{
+    using ContainerType = pel::array<float, 1 << 20>;
+
+    static void run(state& state_)
+    {
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = nullptr;
+              if constexpr(ForOverwrite)
+              {
+                  container = ::new(storage->bytes) ContainerType(pel::for_overwrite);
+              }
+              else
+              {
+                  container = ::new(storage->bytes) ContainerType();
+              }
+              std::fill(container->begin(), container->end(), 1.0f);
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<std::size_t ItemCount>
+void
+add_expensive_cases()
+{
+    constexpr std::size_t bytes = sizeof(expensive_item) * ItemCount;
+
+    add("construct_expensive",
+        "pel::array",
+        "expensive_item",
+        ItemCount,
+        bytes,
+        &construct_value<pel::array<expensive_item, ItemCount>>::run);
+    add("construct_expensive",
+        "std::array",
+        "expensive_item",
+        ItemCount,
+        bytes,
+        &construct_value<std::array<expensive_item, ItemCount>>::run);
+    add("construct_expensive",
+        "T[N]",
+        "expensive_item",
+        ItemCount,
+        bytes,
+        &construct_value<raw_array<expensive_item, ItemCount>>::run);
+}
+
+const bool registered = []
+{
+    add_all_cases<construct_value>("construct_value");
+    add_all_cases<construct_range>("construct_range");
+    add_all_cases<construct_initializer_list>("construct_ilist");
+    add_all_cases<construct_variadic>("construct_variadic");
+    add_all_cases<construct_generator>("construct_generator");
+    add_all_cases<construct_indexed_generator>("construct_indexed");
+
+    add_expensive_cases<64>();
+    add_expensive_cases<4096>();
+
+    constexpr std::size_t overwrittenBytes = sizeof(float) * (1 << 20);
+    add("construct_for_overwrite",
+        "pel::array()",
+        "float",
+        1 << 20,
+        overwrittenBytes,
+        &construct_overwritten<false>::run);
+    add("construct_for_overwrite",
+        "pel::array(for_overwrite)",
+        "float",
+        1 << 20,
+        overwrittenBytes,
+        &construct_overwritten<true>::run);
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
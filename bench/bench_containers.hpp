@@ -0,0 +1,255 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./bench.hpp"
+#include "src/array.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+
+namespace pel::bench
+{
+/*************************************************************************************************/
+/* Benchmarked containers ---------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Plain `ItemType[ItemCount]`, wrapped so that it can be assigned and constructed in
+ *              place like the other containers. It is only ever accessed through raw pointers.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount>
+struct raw_array
+{
+    ItemType items[ItemCount];
+
+    [[nodiscard]] ItemType* begin() noexcept
+    {
+        return items;
+    }
+    [[nodiscard]] ItemType* end() noexcept
+    {
+        return items + ItemCount;
+    }
+    [[nodiscard]] const ItemType* begin() const noexcept
+    {
+        return items;
+    }
+    [[nodiscard]] const ItemType* end() const noexcept
+    {
+        return items + ItemCount;
+    }
+};
+
+template<typename ContainerType>
+struct container_traits;
+
+template<typename ItemType_, std::size_t ItemCount, typename BoundsCheck>
+struct container_traits<pel::array<ItemType_, ItemCount, BoundsCheck>>
+{
+    using ItemType = ItemType_;
+
+    static constexpr std::size_t count = ItemCount;
+    static constexpr const char* name  = "pel::array";
+};
+
+template<typename ItemType_, std::size_t ItemCount>
+struct container_traits<std::array<ItemType_, ItemCount>>
+{
+    using ItemType = ItemType_;
+
+    static constexpr std::size_t count = ItemCount;
+    static constexpr const char* name  = "std::array";
+};
+
+template<typename ItemType_, std::size_t ItemCount>
+struct container_traits<raw_array<ItemType_, ItemCount>>
+{
+    using ItemType = ItemType_;
+
+    static constexpr std::size_t count = ItemCount;
+    static constexpr const char* name  = "T[N]";
+};
+
+template<typename ContainerType>
+constexpr bool is_pel_array = pel::is_array<ContainerType>;
+
+
+/*************************************************************************************************/
+/* Item types ---------------------------------------------------------------------------------- */
+
+template<typename ItemType>
+constexpr const char* item_name = "?";
+template<>
+constexpr const char* item_name<std::uint8_t> = "uint8_t";
+template<>
+constexpr const char* item_name<float> = "float";
+template<>
+constexpr const char* item_name<double> = "double";
+template<>
+constexpr const char* item_name<std::string> = "std::string";
+
+/**
+ **************************************************************************************************
+ * \brief       Value used to fill the benchmarked containers.
+ *              Strings are long enough to defeat the small string optimization.
+ *************************************************************************************************/
+template<typename ItemType>
+[[nodiscard]] inline ItemType
+sample_item()
+{
+    if constexpr(std::is_same_v<ItemType, std::string>)
+    {
+        return std::string(24, 'x');
+    }
+    else
+    {
+        return ItemType{1};
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Approximate number of bytes touched when processing one item.
+ *************************************************************************************************/
+template<typename ItemType>
+constexpr std::size_t item_bytes = std::is_same_v<ItemType, std::string> ? 24 : sizeof(ItemType);
+
+
+/*************************************************************************************************/
+/* Storage ------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Uninitialized heap storage for a single container, used by the construction cases
+ *              so that large containers are never placed on the stack.
+ *************************************************************************************************/
+template<typename ContainerType>
+struct slot
+{
+    alignas(ContainerType) unsigned char bytes[sizeof(ContainerType)];
+};
+
+template<typename ContainerType>
+[[nodiscard]] inline std::unique_ptr<slot<ContainerType>>
+make_slot()
+{
+    return std::make_unique<slot<ContainerType>>();
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Heap-allocate a container filled with `sample_item()`.
+ *************************************************************************************************/
+template<typename ContainerType>
+[[nodiscard]] inline std::unique_ptr<ContainerType>
+make_filled()
+{
+    std::unique_ptr<ContainerType> container = std::make_unique<ContainerType>();
+    for(auto& item : *container)
+    {
+        item = sample_item<typename container_traits<ContainerType>::ItemType>();
+    }
+    return container;
+}
+
+
+/*************************************************************************************************/
+/* Registration -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Register `CaseTemplate` for `pel::array`, `std::array` and `T[N]` of a given item
+ *              type and count.
+ *
+ * \param       group_: Name of the group of the cases.
+ *************************************************************************************************/
+template<template<typename> typename CaseTemplate, typename ItemType, std::size_t ItemCount>
+inline void
+add_container_cases(const char* group_)
+{
+    constexpr std::size_t bytes = item_bytes<ItemType> * ItemCount;
+
+    add(group_,
+        "pel::array",
+        item_name<ItemType>,
+        ItemCount,
+        bytes,
+        &CaseTemplate<pel::array<ItemType, ItemCount>>::run);
+    add(group_,
+        "std::array",
+        item_name<ItemType>,
+        ItemCount,
+        bytes,
+        &CaseTemplate<std::array<ItemType, ItemCount>>::run);
+    add(group_,
+        "T[N]",
+        item_name<ItemType>,
+        ItemCount,
+        bytes,
+        &CaseTemplate<raw_array<ItemType, ItemCount>>::run);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Register `CaseTemplate` over every benchmarked item type, from 4 items up to 1M
+ *              items (16K items for strings).
+ *
+ * \param       group_: Name of the group of the cases.
+ *************************************************************************************************/
+template<template<typename> typename CaseTemplate>
+inline void
+add_all_cases(const char* group_)
+{
+    add_container_cases<CaseTemplate, std::uint8_t, 4>(group_);
+    add_container_cases<CaseTemplate, std::uint8_t, 1024>(group_);
+    add_container_cases<CaseTemplate, std::uint8_t, 1 << 20>(group_);
+
+    add_container_cases<CaseTemplate, float, 4>(group_);
+    add_container_cases<CaseTemplate, float, 64>(group_);
+    add_container_cases<CaseTemplate, float, 1024>(group_);
+    add_container_cases<CaseTemplate, float, 16384>(group_);
+    add_container_cases<CaseTemplate, float, 1 << 20>(group_);
+
+    add_container_cases<CaseTemplate, double, 4>(group_);
+    add_container_cases<CaseTemplate, double, 1024>(group_);
+    add_container_cases<CaseTemplate, double, 1 << 20>(group_);
+
+    add_container_cases<CaseTemplate, std::string, 4>(group_);
+    add_container_cases<CaseTemplate, std::string, 64>(group_);
+    add_container_cases<CaseTemplate, std::string, 16384>(group_);
+}
+
+}        // namespace pel::bench
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
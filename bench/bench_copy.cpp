@@ -0,0 +1,160 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+
+#include <utility>
+
+
+/*************************************************************************************************/
+/* Copy & move: pel::array against std::array and T[N] ----------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+template<typename ContainerType>
+struct copy_assign
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType> source      = make_filled<ContainerType>();
+        std::unique_ptr<ContainerType> destination = make_filled<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              *destination = *source;
+              do_not_optimize(*destination);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct copy_construct
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType>       source  = make_filled<ContainerType>();
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = ::new(storage->bytes) ContainerType(*source);
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct move_assign
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType> source      = make_filled<ContainerType>();
+        std::unique_ptr<ContainerType> destination = make_filled<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              *destination = std::move(*source);
+              do_not_optimize(*destination);
+          });
+    }
+};
+
+template<typename ContainerType>
+struct move_construct
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType>       source  = make_filled<ContainerType>();
+        std::unique_ptr<slot<ContainerType>> storage = make_slot<ContainerType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              ContainerType* container = ::new(storage->bytes) ContainerType(std::move(*source));
+              do_not_optimize(*container);
+              std::destroy_at(container);
+          });
+    }
+};
+
+/* Copy of a pel::array into a larger one, through the templated `OtherSize` assignment */
+template<typename ItemType, std::size_t ItemCount>
+struct copy_assign_cross_size
+{
+    static void run(state& state_)
+    {
+        using SourceType      = pel::array<ItemType, ItemCount>;
+        using DestinationType = pel::array<ItemType, ItemCount * 2>;
+
+        std::unique_ptr<SourceType>      source      = make_filled<SourceType>();
+        std::unique_ptr<DestinationType> destination = make_filled<DestinationType>();
+
+        state_.measure(
+          [&]
+          {
+              clobber_memory();
+              *destination = *source;
+              do_not_optimize(*destination);
+          });
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount>
+void
+add_cross_size_case()
+{
+    add("copy_cross_size",
+        "pel::array",
+        item_name<ItemType>,
+        ItemCount,
+        item_bytes<ItemType> * ItemCount,
+        &copy_assign_cross_size<ItemType, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_all_cases<copy_assign>("copy_assign");
+    add_all_cases<copy_construct>("copy_construct");
+    add_all_cases<move_assign>("move_assign");
+    add_all_cases<move_construct>("move_construct");
+
+    add_cross_size_case<float, 4>();
+    add_cross_size_case<float, 1024>();
+    add_cross_size_case<std::uint8_t, 4096>();
+    add_cross_size_case<std::string, 64>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
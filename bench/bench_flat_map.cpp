@@ -0,0 +1,161 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/fixed_flat_map.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Flat tables: fixed_flat_map lookups against std::unordered_map and a linear scan ------------ */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t lookups_per_pass = 4096;
+
+using KeyType   = std::uint32_t;
+using ValueType = std::uint32_t;
+
+enum class table
+{
+    fixed_flat_map,
+    unordered_map,
+    linear_scan,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Table of `ItemCount` random keys, and lookups of which one in four misses.
+ *************************************************************************************************/
+template<std::size_t ItemCount>
+struct lookup_data
+{
+    lookup_data() : keys(lookups_per_pass)
+    {
+        std::mt19937 generator{7};
+        for(std::pair<KeyType, ValueType>& entry : entries)
+        {
+            entry = {static_cast<KeyType>(generator()), static_cast<ValueType>(generator())};
+        }
+        for(KeyType& key : keys)
+        {
+            const std::size_t pick = generator() % (ItemCount + ItemCount / 3);
+            key = (pick < ItemCount) ? entries[pick].first : static_cast<KeyType>(generator());
+        }
+    }
+
+    pel::array<std::pair<KeyType, ValueType>, ItemCount> entries;
+    std::vector<KeyType>                                  keys;
+};
+
+template<table Table, std::size_t ItemCount>
+struct lookup
+{
+    static void run(state& state_)
+    {
+        const lookup_data<ItemCount> data;
+
+        auto flatMap = std::make_unique<pel::fixed_flat_map<KeyType, ValueType, ItemCount>>();
+        std::unordered_map<KeyType, ValueType> unorderedMap;
+        for(const auto& [key, value] : data.entries)
+        {
+            (void)flatMap->insert(key, value);
+            unorderedMap.emplace(key, value);
+        }
+
+        state_.measure(
+          [&]
+          {
+              ValueType sum = 0;
+              for(const KeyType key : data.keys)
+              {
+                  if constexpr(Table == table::fixed_flat_map)
+                  {
+                      const ValueType* value = flatMap->find(key);
+                      sum += (value != nullptr) ? *value : 0;
+                  }
+                  else if constexpr(Table == table::unordered_map)
+                  {
+                      const auto entry = unorderedMap.find(key);
+                      sum += (entry != unorderedMap.end()) ? entry->second : 0;
+                  }
+                  else
+                  {
+                      const auto entry =
+                        std::find_if(data.entries.begin(),
+                                     data.entries.end(),
+                                     [key](const auto& entry_) { return entry_.first == key; });
+                      sum += (entry != data.entries.end()) ? entry->second : 0;
+                  }
+              }
+              do_not_optimize(sum);
+          });
+    }
+};
+
+template<std::size_t ItemCount>
+void
+add_lookup_cases()
+{
+    constexpr std::size_t bytes = sizeof(KeyType) * lookups_per_pass;
+
+    add("flat_map_lookup",
+        "pel::fixed_flat_map",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &lookup<table::fixed_flat_map, ItemCount>::run);
+    add("flat_map_lookup",
+        "std::unordered_map",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &lookup<table::unordered_map, ItemCount>::run);
+    add("flat_map_lookup",
+        "linear scan",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &lookup<table::linear_scan, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_lookup_cases<16>();
+    add_lookup_cases<64>();
+    add_lookup_cases<1024>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
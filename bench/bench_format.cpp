@@ -0,0 +1,174 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array_format.hpp"
+
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Text formatting and binary serialization against to_string ---------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+template<typename ItemType, std::size_t ItemCount>
+using formatted_array = pel::array<ItemType, ItemCount>;
+
+/* Values with a varying number of digits, rather than the same digit over and over */
+template<typename ItemType, std::size_t ItemCount>
+[[nodiscard]] std::unique_ptr<formatted_array<ItemType, ItemCount>>
+make_formatted()
+{
+    std::unique_ptr<formatted_array<ItemType, ItemCount>> arr =
+      std::make_unique<formatted_array<ItemType, ItemCount>>();
+    for(std::size_t i = 0; i < ItemCount; ++i)
+    {
+        (*arr)[i] = static_cast<ItemType>((i * 7919U) % 251U) / static_cast<ItemType>(3);
+    }
+    return arr;
+}
+
+template<typename ItemType, std::size_t ItemCount>
+void
+text_to_string(state& state_)
+{
+    using ArrayType = formatted_array<ItemType, ItemCount>;
+
+    std::unique_ptr<ArrayType> arr = make_formatted<ItemType, ItemCount>();
+
+    state_.measure(
+      [&]
+      {
+          std::string text = arr->to_string();
+          do_not_optimize(text);
+      });
+}
+
+template<typename ItemType, std::size_t ItemCount>
+void
+text_format(state& state_)
+{
+    using ArrayType = formatted_array<ItemType, ItemCount>;
+
+    std::unique_ptr<ArrayType> arr = make_formatted<ItemType, ItemCount>();
+
+    state_.measure(
+      [&]
+      {
+          std::string text = pel::format(*arr);
+          do_not_optimize(text);
+      });
+}
+
+/* One line per item like `to_string`, into a buffer reused by every iteration */
+template<typename ItemType, std::size_t ItemCount>
+void
+text_format_to(state& state_)
+{
+    using ArrayType = formatted_array<ItemType, ItemCount>;
+
+    std::unique_ptr<ArrayType> arr = make_formatted<ItemType, ItemCount>();
+    std::vector<char> buffer(pel::format(*arr, {.separator = "\n"}).size());
+
+    state_.measure(
+      [&]
+      {
+          const std::to_chars_result result = pel::format_to(
+            buffer.data(), buffer.data() + buffer.size(), *arr, {.separator = "\n"});
+          do_not_optimize(result);
+          clobber_memory();
+      });
+}
+
+template<typename ItemType, std::size_t ItemCount>
+void
+binary_serialize(state& state_)
+{
+    using ArrayType = formatted_array<ItemType, ItemCount>;
+
+    std::unique_ptr<ArrayType> arr = make_formatted<ItemType, ItemCount>();
+    std::vector<std::byte> buffer(pel::serialized_size(*arr));
+
+    state_.measure(
+      [&]
+      {
+          const pel::serialize_result result = pel::serialize(*arr, buffer);
+          do_not_optimize(result);
+          clobber_memory();
+      });
+}
+
+template<typename ItemType, std::size_t ItemCount>
+void
+binary_deserialize(state& state_)
+{
+    using ArrayType = formatted_array<ItemType, ItemCount>;
+
+    std::unique_ptr<ArrayType> arr = make_formatted<ItemType, ItemCount>();
+    std::vector<std::byte> buffer(pel::serialized_size(*arr));
+    static_cast<void>(pel::serialize(*arr, buffer));
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          const pel::deserialize_result result = pel::deserialize(buffer, *arr);
+          do_not_optimize(result);
+          do_not_optimize(*arr);
+      });
+}
+
+template<typename ItemType, std::size_t ItemCount>
+void
+add_format_cases()
+{
+    constexpr std::size_t bytes = sizeof(ItemType) * ItemCount;
+
+    const auto addCase = [&](const char* group_, const char* container_, CaseFunction function_)
+    { add(group_, container_, item_name<ItemType>, ItemCount, bytes, function_); };
+
+    addCase("format", "to_string", &text_to_string<ItemType, ItemCount>);
+    addCase("format", "pel::format", &text_format<ItemType, ItemCount>);
+    addCase("format", "pel::format_to", &text_format_to<ItemType, ItemCount>);
+
+    addCase("serialize", "to_string", &text_to_string<ItemType, ItemCount>);
+    addCase("serialize", "pel::serialize", &binary_serialize<ItemType, ItemCount>);
+    addCase("serialize", "pel::deserialize", &binary_deserialize<ItemType, ItemCount>);
+}
+
+const bool registered = []
+{
+    add_format_cases<std::uint8_t, 1024>();
+    add_format_cases<float, 64>();
+    add_format_cases<float, 1024>();
+    add_format_cases<float, 16384>();
+    add_format_cases<double, 1024>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
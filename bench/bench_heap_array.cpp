@@ -0,0 +1,131 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/heap_array.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Heap arrays: random accesses over a large array, with small and huge pages ------------------ */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t item_count      = 1 << 24;
+constexpr std::size_t reads_per_pass = 1 << 16;
+
+using ItemType  = double;
+using ArrayType = pel::array<ItemType, item_count>;
+
+enum class storage
+{
+    inline_array,
+    small_pages,
+    huge_pages,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Reads items at random indexes of a 128 MiB array: with 4 KiB pages nearly every
+ *              read misses the TLB, with 2 MiB pages the whole array fits in the second-level TLB.
+ *************************************************************************************************/
+template<storage Storage>
+struct random_reads
+{
+    static void run(state& state_)
+    {
+        std::mt19937                               generator{11};
+        std::uniform_int_distribution<std::size_t> distribution{0, item_count - 1};
+
+        std::vector<std::size_t> indexes(reads_per_pass);
+        for(std::size_t& index : indexes)
+        {
+            index = distribution(generator);
+        }
+
+        if constexpr(Storage == storage::inline_array)
+        {
+            std::unique_ptr<ArrayType> items = std::make_unique<ArrayType>(1.0);
+            read(state_, *items, indexes);
+        }
+        else
+        {
+            const pel::heap_options options{Storage == storage::huge_pages,
+                                            pel::page_touch::populate};
+
+            pel::heap_array<ItemType, item_count> items(1.0, options);
+            read(state_, *items, indexes);
+        }
+    }
+
+    static void read(state&                          state_,
+                     const ArrayType&                items_,
+                     const std::vector<std::size_t>& indexes_)
+    {
+        state_.measure(
+          [&]
+          {
+              ItemType sum = 0.0;
+              for(const std::size_t index : indexes_)
+              {
+                  sum += items_.unchecked(index);
+              }
+              do_not_optimize(sum);
+          });
+    }
+};
+
+const bool registered = []
+{
+    constexpr std::size_t bytes = sizeof(ItemType) * reads_per_pass;
+
+    add("heap_random_reads",
+        "pel::array (new)",
+        "double",
+        item_count,
+        bytes,
+        &random_reads<storage::inline_array>::run);
+    add("heap_random_reads",
+        "pel::heap_array 4 KiB",
+        "double",
+        item_count,
+        bytes,
+        &random_reads<storage::small_pages>::run);
+    add("heap_random_reads",
+        "pel::heap_array 2 MiB",
+        "double",
+        item_count,
+        bytes,
+        &random_reads<storage::huge_pages>::run);
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,172 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/md_array.hpp"
+
+#include <utility>
+
+
+/*************************************************************************************************/
+/* Matrix transposition: row-major against tiled layouts --------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t tile_length = 8;
+
+template<std::size_t Length>
+using row_major_matrix = pel::md_array<float, Length, Length>;
+template<std::size_t Length>
+using tiled_matrix = pel::basic_md_array<float,
+                                         pel::layout::tiled<tile_length, tile_length>,
+                                         pel::default_bounds_check,
+                                         Length,
+                                         Length>;
+
+template<typename MatrixType>
+[[nodiscard]] std::unique_ptr<MatrixType>
+make_matrix()
+{
+    std::unique_ptr<MatrixType> matrix = std::make_unique<MatrixType>();
+    for(std::size_t i = 0; i < MatrixType::extent(0); ++i)
+    {
+        for(std::size_t j = 0; j < MatrixType::extent(1); ++j)
+        {
+            (*matrix)(i, j) = static_cast<float>((i + j) % 64);
+        }
+    }
+    return matrix;
+}
+
+/* `destination(j, i) = source(i, j)`, one row of the source after the other */
+template<std::size_t Length>
+void
+transpose_naive(state& state_)
+{
+    std::unique_ptr<row_major_matrix<Length>> source      = make_matrix<row_major_matrix<Length>>();
+    std::unique_ptr<row_major_matrix<Length>> destination = make_matrix<row_major_matrix<Length>>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          for(std::size_t i = 0; i < Length; ++i)
+          {
+              for(std::size_t j = 0; j < Length; ++j)
+              {
+                  destination->unchecked(j, i) = source->unchecked(i, j);
+              }
+          }
+          do_not_optimize(*destination);
+      });
+}
+
+/* Same transposition, looping over 8x8 blocks of a row-major matrix */
+template<std::size_t Length>
+void
+transpose_blocked(state& state_)
+{
+    std::unique_ptr<row_major_matrix<Length>> source      = make_matrix<row_major_matrix<Length>>();
+    std::unique_ptr<row_major_matrix<Length>> destination = make_matrix<row_major_matrix<Length>>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          for(std::size_t bi = 0; bi < Length; bi += tile_length)
+          {
+              for(std::size_t bj = 0; bj < Length; bj += tile_length)
+              {
+                  for(std::size_t i = bi; i < bi + tile_length; ++i)
+                  {
+                      for(std::size_t j = bj; j < bj + tile_length; ++j)
+                      {
+                          destination->unchecked(j, i) = source->unchecked(i, j);
+                      }
+                  }
+              }
+          }
+          do_not_optimize(*destination);
+      });
+}
+
+/* Same transposition between tiled matrices, each tile being a contiguous 8x8 block */
+template<std::size_t Length>
+void
+transpose_tiled(state& state_)
+{
+    std::unique_ptr<tiled_matrix<Length>> source      = make_matrix<tiled_matrix<Length>>();
+    std::unique_ptr<tiled_matrix<Length>> destination = make_matrix<tiled_matrix<Length>>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          for(std::size_t ti = 0; ti < Length / tile_length; ++ti)
+          {
+              for(std::size_t tj = 0; tj < Length / tile_length; ++tj)
+              {
+                  const auto sourceTile      = std::as_const(*source).tile(ti, tj);
+                  const auto destinationTile = destination->tile(tj, ti);
+                  for(std::size_t i = 0; i < tile_length; ++i)
+                  {
+                      for(std::size_t j = 0; j < tile_length; ++j)
+                      {
+                          destinationTile.unchecked(j, i) = sourceTile.unchecked(i, j);
+                      }
+                  }
+              }
+          }
+          do_not_optimize(*destination);
+      });
+}
+
+template<std::size_t Length>
+void
+add_transpose_cases()
+{
+    constexpr std::size_t count = Length * Length;
+    constexpr std::size_t bytes = 2 * sizeof(float) * count;
+
+    add("transpose", "md_array (row-major)", "float", count, bytes, &transpose_naive<Length>);
+    add("transpose",
+        "md_array (row-major, 8x8 loop)",
+        "float",
+        count,
+        bytes,
+        &transpose_blocked<Length>);
+    add("transpose", "md_array (tiled<8, 8>)", "float", count, bytes, &transpose_tiled<Length>);
+}
+
+const bool registered = []
+{
+    add_transpose_cases<256>();
+    add_transpose_cases<2048>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,206 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array.hpp"
+#include "src/packed_array.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+
+/*************************************************************************************************/
+/* Bit-packed arrays: scans over packed items against scans over unpacked items ---------------- */
+namespace
+{
+using namespace pel::bench;
+
+enum class kernel
+{
+    unpacked,
+    packed_blocks,
+    packed_items,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Random items on `Bits` bits, both unpacked and packed.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, std::size_t Bits>
+struct packed_data
+{
+    packed_data()
+    {
+        std::mt19937 generator{17};
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            items[i] = static_cast<ItemType>(generator() % (std::size_t{1} << Bits));
+        }
+        packed.pack(items);
+    }
+
+    pel::array<ItemType, ItemCount>              items;
+    pel::packed_array<ItemType, ItemCount, Bits> packed;
+};
+
+template<kernel Kernel, typename ItemType, std::size_t ItemCount, std::size_t Bits>
+struct scan
+{
+    /* Kept apart from the measured lambda, whose result escapes, so that the sum stays in a
+     * register while blocks are unpacked */
+    static std::uint64_t sum_items(const packed_data<ItemType, ItemCount, Bits>& data_)
+    {
+        std::uint64_t sum = 0;
+        if constexpr(Kernel == kernel::unpacked)
+        {
+            for(const ItemType item : data_.items)
+            {
+                sum += item;
+            }
+        }
+        else if constexpr(Kernel == kernel::packed_blocks)
+        {
+            constexpr std::size_t blockLength =
+              pel::packed_array<ItemType, ItemCount, Bits>::block_length;
+
+            pel::array<ItemType, blockLength> block;
+            for(std::size_t offset = 0; offset < ItemCount; offset += blockLength)
+            {
+                data_.packed.unpack(block, offset);
+                for(const ItemType item : block)
+                {
+                    sum += item;
+                }
+            }
+        }
+        else
+        {
+            for(const ItemType item : data_.packed)
+            {
+                sum += item;
+            }
+        }
+        return sum;
+    }
+
+    static void run(state& state_)
+    {
+        const auto data = std::make_unique<packed_data<ItemType, ItemCount, Bits>>();
+
+        state_.measure(
+          [&]
+          {
+              const std::uint64_t sum = sum_items(*data);
+              do_not_optimize(sum);
+          });
+    }
+};
+
+template<kernel Kernel, std::size_t ItemCount>
+struct count
+{
+    static void run(state& state_)
+    {
+        const auto items  = std::make_unique<pel::array<bool, ItemCount>>();
+        const auto packed = std::make_unique<pel::packed_array<bool, ItemCount, 1>>();
+        std::mt19937 generator{19};
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            (*items)[i]  = (generator() & 1U) != 0;
+            (*packed)[i] = (*items)[i];
+        }
+
+        state_.measure(
+          [&]
+          {
+              std::size_t set = 0;
+              if constexpr(Kernel == kernel::unpacked)
+              {
+                  set = static_cast<std::size_t>(std::count(items->begin(), items->end(), true));
+              }
+              else
+              {
+                  set = packed->count();
+              }
+              do_not_optimize(set);
+          });
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount, std::size_t Bits>
+void
+add_scan_cases(const char* itemName_)
+{
+    add("packed_scan",
+        "pel::array",
+        itemName_,
+        ItemCount,
+        sizeof(ItemType) * ItemCount,
+        &scan<kernel::unpacked, ItemType, ItemCount, Bits>::run);
+    add("packed_scan",
+        "pel::packed_array::unpack",
+        itemName_,
+        ItemCount,
+        sizeof(pel::packed_array<ItemType, ItemCount, Bits>),
+        &scan<kernel::packed_blocks, ItemType, ItemCount, Bits>::run);
+    add("packed_scan",
+        "pel::packed_array items",
+        itemName_,
+        ItemCount,
+        sizeof(pel::packed_array<ItemType, ItemCount, Bits>),
+        &scan<kernel::packed_items, ItemType, ItemCount, Bits>::run);
+}
+
+template<std::size_t ItemCount>
+void
+add_count_cases()
+{
+    add("packed_count",
+        "pel::array<bool>",
+        "bool",
+        ItemCount,
+        ItemCount,
+        &count<kernel::unpacked, ItemCount>::run);
+    add("packed_count",
+        "pel::packed_array::count",
+        "bool",
+        ItemCount,
+        ItemCount / 8,
+        &count<kernel::packed_blocks, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_scan_cases<std::uint16_t, 1 << 16, 4>("uint16_t:4");
+    add_scan_cases<std::uint16_t, 1 << 20, 4>("uint16_t:4");
+    add_scan_cases<std::uint16_t, 1 << 20, 12>("uint16_t:12");
+    add_count_cases<1 << 16>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,179 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/parallel.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+
+
+/*************************************************************************************************/
+/* Parallel algorithms: scaling from 1 to N threads -------------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t item_count = 1 << 22;
+
+using ArrayType = pel::array<float, item_count>;
+
+/* A few multiply-adds per item, so that the kernel is bound by the cores rather than memory */
+constexpr auto polynomial = [](float value_) noexcept
+{
+    float result = 0.5f;
+    for(int degree = 0; degree < 16; ++degree)
+    {
+        result = (result * value_) + 0.25f;
+    }
+    return result;
+};
+
+[[nodiscard]] std::unique_ptr<ArrayType>
+make_input()
+{
+    std::unique_ptr<ArrayType> input = std::make_unique<ArrayType>();
+    for(std::size_t i = 0; i < item_count; ++i)
+    {
+        (*input)[i] = static_cast<float>(i % 64) / 64.0f;
+    }
+    return input;
+}
+
+void
+transform_serial(state& state_)
+{
+    std::unique_ptr<ArrayType> input  = make_input();
+    std::unique_ptr<ArrayType> output = std::make_unique<ArrayType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          std::transform(input->begin(), input->end(), output->begin(), polynomial);
+          do_not_optimize(*output);
+      });
+}
+
+template<std::size_t ThreadCount>
+void
+transform_parallel(state& state_)
+{
+    std::unique_ptr<ArrayType> input  = make_input();
+    std::unique_ptr<ArrayType> output = std::make_unique<ArrayType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          pel::parallel::transform(*input, *output, polynomial, {.threads = ThreadCount});
+          do_not_optimize(*output);
+      });
+}
+
+void
+reduce_serial(state& state_)
+{
+    std::unique_ptr<ArrayType> input = make_input();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          const double total = std::accumulate(input->begin(), input->end(), 0.0);
+          do_not_optimize(total);
+      });
+}
+
+template<std::size_t ThreadCount>
+void
+reduce_parallel(state& state_)
+{
+    std::unique_ptr<ArrayType> input = make_input();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          const double total =
+            pel::parallel::reduce(*input, 0.0, std::plus<>{}, {.threads = ThreadCount});
+          do_not_optimize(total);
+      });
+}
+
+template<std::size_t ThreadCount>
+void
+add_thread_count_cases()
+{
+    if(ThreadCount > pel::default_thread_pool().concurrency())
+    {
+        return;
+    }
+
+    const std::string threads = " (" + std::to_string(ThreadCount) + " threads)";
+
+    add("parallel_transform",
+        "pel::parallel" + threads,
+        "float",
+        item_count,
+        2 * sizeof(float) * item_count,
+        &transform_parallel<ThreadCount>);
+    add("parallel_reduce",
+        "pel::parallel" + threads,
+        "float",
+        item_count,
+        sizeof(float) * item_count,
+        &reduce_parallel<ThreadCount>);
+}
+
+const bool registered = []
+{
+    add("parallel_transform",
+        "std::transform",
+        "float",
+        item_count,
+        2 * sizeof(float) * item_count,
+        &transform_serial);
+    add("parallel_reduce",
+        "std::accumulate",
+        "float",
+        item_count,
+        sizeof(float) * item_count,
+        &reduce_serial);
+
+    add_thread_count_cases<1>();
+    add_thread_count_cases<2>();
+    add_thread_count_cases<4>();
+    add_thread_count_cases<8>();
+    add_thread_count_cases<16>();
+    add_thread_count_cases<32>();
+    add_thread_count_cases<64>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,178 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Permutations: gather and stream compaction against element-by-element loops ----------------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t source_length = 1 << 16;
+
+enum class kernel
+{
+    pel_array,
+    item_loop,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Random indexes into a source of `source_length` items, and a mask keeping about
+ *              one item in two.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount>
+struct permute_data
+{
+    permute_data() : source(source_length)
+    {
+        std::mt19937 generator{13};
+        for(std::size_t i = 0; i < source_length; ++i)
+        {
+            source[i] = static_cast<ItemType>(i);
+        }
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            indices[i] = static_cast<std::uint32_t>(generator() % source_length);
+            mask[i]    = (generator() & 1U) != 0;
+        }
+    }
+
+    std::vector<ItemType>                source;
+    pel::array<std::uint32_t, ItemCount> indices;
+    pel::array<bool, ItemCount>          mask;
+};
+
+template<kernel Kernel, typename ItemType, std::size_t ItemCount>
+struct gather
+{
+    static void run(state& state_)
+    {
+        const auto data  = std::make_unique<permute_data<ItemType, ItemCount>>();
+        auto       items = std::make_unique<pel::array<ItemType, ItemCount>>();
+
+        state_.measure(
+          [&]
+          {
+              if constexpr(Kernel == kernel::pel_array)
+              {
+                  items->gather(data->source, data->indices);
+              }
+              else
+              {
+                  for(std::size_t i = 0; i < ItemCount; ++i)
+                  {
+                      (*items)[i] = data->source[data->indices[i]];
+                  }
+              }
+              do_not_optimize(*items);
+          });
+    }
+};
+
+template<kernel Kernel, typename ItemType, std::size_t ItemCount>
+struct compress
+{
+    static void run(state& state_)
+    {
+        const auto data  = std::make_unique<permute_data<ItemType, ItemCount>>();
+        const auto items = std::make_unique<pel::array<ItemType, ItemCount>>();
+        auto       kept  = std::make_unique<pel::array<ItemType, ItemCount>>();
+        items->assign(std::span{data->source}.first(ItemCount));
+
+        state_.measure(
+          [&]
+          {
+              std::size_t count = 0;
+              if constexpr(Kernel == kernel::pel_array)
+              {
+                  count = items->compress(data->mask, *kept);
+              }
+              else
+              {
+                  for(std::size_t i = 0; i < ItemCount; ++i)
+                  {
+                      if(data->mask[i])
+                      {
+                          (*kept)[count++] = (*items)[i];
+                      }
+                  }
+              }
+              do_not_optimize(count);
+              do_not_optimize(*kept);
+          });
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount>
+void
+add_permute_cases(const char* itemName_)
+{
+    constexpr std::size_t bytes = sizeof(ItemType) * ItemCount;
+
+    add("gather",
+        "pel::array::gather",
+        itemName_,
+        ItemCount,
+        bytes,
+        &gather<kernel::pel_array, ItemType, ItemCount>::run);
+    add("gather",
+        "item loop",
+        itemName_,
+        ItemCount,
+        bytes,
+        &gather<kernel::item_loop, ItemType, ItemCount>::run);
+    add("compress",
+        "pel::array::compress",
+        itemName_,
+        ItemCount,
+        bytes,
+        &compress<kernel::pel_array, ItemType, ItemCount>::run);
+    add("compress",
+        "item loop",
+        itemName_,
+        ItemCount,
+        bytes,
+        &compress<kernel::item_loop, ItemType, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_permute_cases<float, 1024>("float");
+    add_permute_cases<double, 1024>("double");
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,176 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array_pool.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Array pools: short-lived scratch arrays from a pool against malloc -------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t batch_size    = 64;
+constexpr std::size_t thread_rounds = 256;
+constexpr std::size_t churn_threads = 4;
+
+template<std::size_t ItemCount>
+using ScratchType = pel::array<float, ItemCount>;
+
+template<std::size_t ItemCount>
+struct heap_allocator
+{
+    using HandleType = std::unique_ptr<ScratchType<ItemCount>>;
+
+    [[nodiscard]] HandleType make()
+    {
+        return std::make_unique_for_overwrite<ScratchType<ItemCount>>();
+    }
+};
+
+template<std::size_t ItemCount>
+struct pool_allocator
+{
+    using PoolType   = pel::array_pool<float, ItemCount>;
+    using HandleType = typename PoolType::handle;
+
+    PoolType pool;
+
+    [[nodiscard]] HandleType make()
+    {
+        return pool.make(pel::for_overwrite);
+    }
+};
+
+/* Allocates a batch of scratch arrays, writes to each one, then frees them all */
+template<typename AllocatorType>
+void
+churn(AllocatorType& allocator_, std::size_t rounds_)
+{
+    std::vector<typename AllocatorType::HandleType> handles;
+    handles.reserve(batch_size);
+    for(std::size_t round = 0; round < rounds_; ++round)
+    {
+        for(std::size_t i = 0; i < batch_size; ++i)
+        {
+            handles.push_back(allocator_.make());
+            (*handles.back())[0] = static_cast<float>(i);
+        }
+        do_not_optimize(handles);
+        handles.clear();
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Churns through batches of scratch arrays on the benchmark thread.
+ *************************************************************************************************/
+template<typename AllocatorType>
+struct single_thread_churn
+{
+    static void run(state& state_)
+    {
+        auto allocator = std::make_unique<AllocatorType>();
+        churn(*allocator, 1);
+
+        state_.measure([&] { churn(*allocator, 1); });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Churns through batches of scratch arrays on several threads sharing one allocator.
+ *************************************************************************************************/
+template<typename AllocatorType>
+struct multi_thread_churn
+{
+    static void run(state& state_)
+    {
+        auto allocator = std::make_unique<AllocatorType>();
+
+        state_.measure(
+          [&]
+          {
+              std::vector<std::thread> threads;
+              for(std::size_t i = 0; i < churn_threads; ++i)
+              {
+                  threads.emplace_back([&] { churn(*allocator, thread_rounds); });
+              }
+              for(std::thread& thread : threads)
+              {
+                  thread.join();
+              }
+          });
+    }
+};
+
+template<std::size_t ItemCount>
+void
+add_churn_cases()
+{
+    constexpr std::size_t bytes = sizeof(ScratchType<ItemCount>) * batch_size;
+
+    add("pool_churn",
+        "pel::array_pool",
+        "float",
+        ItemCount,
+        bytes,
+        &single_thread_churn<pool_allocator<ItemCount>>::run);
+    add("pool_churn",
+        "make_unique",
+        "float",
+        ItemCount,
+        bytes,
+        &single_thread_churn<heap_allocator<ItemCount>>::run);
+
+    add("pool_churn_mt",
+        "pel::array_pool",
+        "float",
+        ItemCount,
+        bytes * thread_rounds * churn_threads,
+        &multi_thread_churn<pool_allocator<ItemCount>>::run);
+    add("pool_churn_mt",
+        "make_unique",
+        "float",
+        ItemCount,
+        bytes * thread_rounds * churn_threads,
+        &multi_thread_churn<heap_allocator<ItemCount>>::run);
+}
+
+const bool registered = []
+{
+    add_churn_cases<64>();
+    add_churn_cases<1024>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
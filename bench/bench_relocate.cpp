@@ -0,0 +1,153 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array.hpp"
+#include "src/static_vector.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Relocation: growing vectors of arrays, shifting arrays of owning pointers ------------------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t row_width    = 8;
+constexpr std::size_t shift_length = 64;
+
+/**
+ **************************************************************************************************
+ * \brief       Appends `RowCount` rows of heap-allocated strings to a vector without reserving, so
+ *              that every reallocation relocates the rows already there.
+ *************************************************************************************************/
+template<typename RowType, std::size_t RowCount>
+struct grow_vector
+{
+    static void run(state& state_)
+    {
+        RowType row;
+        for(std::string& item : row)
+        {
+            item = sample_item<std::string>();
+        }
+
+        state_.measure(
+          [&]
+          {
+              std::vector<RowType> rows;
+              for(std::size_t i = 0; i < RowCount; ++i)
+              {
+                  rows.push_back(row);
+              }
+              do_not_optimize(rows);
+          });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Inserts a row of owning pointers at the front of a full vector and erases its last
+ *              row, shifting every row twice.
+ *************************************************************************************************/
+template<typename VectorType, typename RowType>
+struct shift_rows
+{
+    static void run(state& state_)
+    {
+        VectorType rows;
+        if constexpr(requires { rows.reserve(shift_length); })
+        {
+            rows.reserve(shift_length);
+        }
+        for(std::size_t i = 0; i + 1 < shift_length; ++i)
+        {
+            rows.push_back(RowType{});
+        }
+
+        state_.measure(
+          [&]
+          {
+              rows.insert(rows.begin(), RowType{});
+              rows.erase(rows.end() - 1);
+              do_not_optimize(rows);
+          });
+    }
+};
+
+template<std::size_t RowCount>
+void
+add_growth_cases()
+{
+    using PelRowType = pel::array<std::string, row_width>;
+    using StdRowType = std::array<std::string, row_width>;
+
+    constexpr std::size_t bytes = item_bytes<std::string> * row_width * RowCount;
+
+    add("vector_growth",
+        "vector<pel::array>",
+        "std::string",
+        RowCount,
+        bytes,
+        &grow_vector<PelRowType, RowCount>::run);
+    add("vector_growth",
+        "vector<std::array>",
+        "std::string",
+        RowCount,
+        bytes,
+        &grow_vector<StdRowType, RowCount>::run);
+}
+
+const bool registered = []
+{
+    add_growth_cases<64>();
+    add_growth_cases<1024>();
+
+    using RowType = pel::array<std::unique_ptr<std::uint32_t>, row_width>;
+
+    constexpr std::size_t bytes = sizeof(RowType) * shift_length * 2;
+
+    add("relocate_shift",
+        "pel::static_vector",
+        "unique_ptr",
+        shift_length,
+        bytes,
+        &shift_rows<pel::static_vector<RowType, shift_length>, RowType>::run);
+    add("relocate_shift",
+        "std::vector+reserve",
+        "unique_ptr",
+        shift_length,
+        bytes,
+        &shift_rows<std::vector<RowType>, RowType>::run);
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,335 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/ring_array.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Ring buffers: throughput and latency under contention --------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+using MessageType = std::uint64_t;
+
+constexpr std::size_t ring_capacity        = 1024;
+constexpr std::size_t messages_per_pass    = 1 << 16;
+constexpr std::size_t round_trips_per_pass = 1 << 12;
+
+using SpscRingType = pel::ring_array<MessageType, ring_capacity, pel::ring_mode::spsc>;
+using MpmcRingType = pel::ring_array<MessageType, ring_capacity, pel::ring_mode::mpmc>;
+
+/**
+ **************************************************************************************************
+ * \brief       Ring of the same capacity guarded by a mutex, as the baseline of the lock-free ones.
+ *************************************************************************************************/
+class mutex_ring
+{
+public:
+    [[nodiscard]] bool try_push(MessageType message_)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if(m_tail - m_head == ring_capacity)
+        {
+            return false;
+        }
+        m_items[m_tail++ % ring_capacity] = message_;
+        return true;
+    }
+
+    [[nodiscard]] bool try_pop(MessageType& message_)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if(m_tail == m_head)
+        {
+            return false;
+        }
+        message_ = m_items[m_head++ % ring_capacity];
+        return true;
+    }
+
+private:
+    std::mutex                             m_mutex;
+    std::size_t                            m_head = 0;
+    std::size_t                            m_tail = 0;
+    pel::array<MessageType, ring_capacity> m_items;
+};
+
+/* Spinning threads would starve each other on machines with fewer cores than threads */
+void
+back_off()
+{
+    std::this_thread::yield();
+}
+
+template<std::size_t BatchSize, typename QueueType>
+void
+produce(QueueType& queue_, std::size_t count_)
+{
+    if constexpr(BatchSize == 1)
+    {
+        for(MessageType message = 0; message < count_;)
+        {
+            if(queue_.try_push(message))
+            {
+                ++message;
+            }
+            else
+            {
+                back_off();
+            }
+        }
+    }
+    else
+    {
+        pel::array<MessageType, BatchSize> batch;
+        for(std::size_t sent = 0; sent < count_;)
+        {
+            const std::size_t length = std::min(BatchSize, count_ - sent);
+            for(std::size_t i = 0; i < length; ++i)
+            {
+                batch[i] = sent + i;
+            }
+
+            const std::size_t pushed =
+              queue_.push(std::span<const MessageType>{batch.data(), length});
+            sent += pushed;
+            if(pushed == 0)
+            {
+                back_off();
+            }
+        }
+    }
+}
+
+template<std::size_t BatchSize, typename QueueType>
+MessageType
+consume(QueueType& queue_, std::size_t count_)
+{
+    MessageType checksum = 0;
+    if constexpr(BatchSize == 1)
+    {
+        for(std::size_t received = 0; received < count_;)
+        {
+            MessageType message = 0;
+            if(queue_.try_pop(message))
+            {
+                checksum += message;
+                ++received;
+            }
+            else
+            {
+                back_off();
+            }
+        }
+    }
+    else
+    {
+        pel::array<MessageType, BatchSize> batch;
+        for(std::size_t received = 0; received < count_;)
+        {
+            const std::size_t length = std::min(BatchSize, count_ - received);
+            const std::size_t popped = queue_.pop(std::span<MessageType>{batch.data(), length});
+            for(std::size_t i = 0; i < popped; ++i)
+            {
+                checksum += batch[i];
+            }
+            received += popped;
+            if(popped == 0)
+            {
+                back_off();
+            }
+        }
+    }
+    return checksum;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       `Producers` threads push `messages_per_pass` messages in total through `QueueType`,
+ *              while `Consumers` threads pop them, `BatchSize` messages at a time.
+ *************************************************************************************************/
+template<typename QueueType, std::size_t Producers, std::size_t Consumers, std::size_t BatchSize>
+struct throughput
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<QueueType> queue = std::make_unique<QueueType>();
+
+        state_.measure(
+          [&]
+          {
+              std::atomic<MessageType> checksum = 0;
+              std::vector<std::thread> threads;
+              threads.reserve(Producers + Consumers);
+              for(std::size_t p = 0; p < Producers; ++p)
+              {
+                  threads.emplace_back(
+                    [&queue] { produce<BatchSize>(*queue, messages_per_pass / Producers); });
+              }
+              for(std::size_t c = 0; c < Consumers; ++c)
+              {
+                  threads.emplace_back(
+                    [&queue, &checksum]
+                    {
+                        const MessageType received =
+                          consume<BatchSize>(*queue, messages_per_pass / Consumers);
+                        checksum.fetch_add(received, std::memory_order_relaxed);
+                    });
+              }
+              for(std::thread& thread : threads)
+              {
+                  thread.join();
+              }
+              do_not_optimize(checksum.load(std::memory_order_relaxed));
+          });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Ping-pong between two threads over a pair of `QueueType`: every message makes a
+ *              round trip before the next one is sent.
+ *************************************************************************************************/
+template<typename QueueType>
+struct round_trip
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<QueueType> ping = std::make_unique<QueueType>();
+        std::unique_ptr<QueueType> pong = std::make_unique<QueueType>();
+
+        state_.measure(
+          [&]
+          {
+              std::thread echo{[&]
+                               {
+                                   for(std::size_t i = 0; i < round_trips_per_pass; ++i)
+                                   {
+                                       const MessageType message = consume<1>(*ping, 1);
+                                       while(!pong->try_push(message))
+                                       {
+                                           back_off();
+                                       }
+                                   }
+                               }};
+
+              MessageType checksum = 0;
+              for(MessageType message = 0; message < round_trips_per_pass; ++message)
+              {
+                  while(!ping->try_push(message))
+                  {
+                      back_off();
+                  }
+                  checksum += consume<1>(*pong, 1);
+              }
+              echo.join();
+              do_not_optimize(checksum);
+          });
+    }
+};
+
+const bool registered = []
+{
+    constexpr std::size_t bytes = sizeof(MessageType) * messages_per_pass;
+
+    add("ring_throughput",
+        "mutex + pel::array (1P 1C)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<mutex_ring, 1, 1, 1>::run);
+    add("ring_throughput",
+        "pel::ring_array spsc (1P 1C)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<SpscRingType, 1, 1, 1>::run);
+    add("ring_throughput",
+        "pel::ring_array spsc (1P 1C, spans of 64)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<SpscRingType, 1, 1, 64>::run);
+    add("ring_throughput",
+        "pel::ring_array mpmc (1P 1C)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<MpmcRingType, 1, 1, 1>::run);
+    add("ring_throughput",
+        "mutex + pel::array (4P 4C)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<mutex_ring, 4, 4, 1>::run);
+    add("ring_throughput",
+        "pel::ring_array mpmc (4P 4C)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<MpmcRingType, 4, 4, 1>::run);
+    add("ring_throughput",
+        "pel::ring_array mpmc (4P 4C, spans of 64)",
+        "uint64_t",
+        ring_capacity,
+        bytes,
+        &throughput<MpmcRingType, 4, 4, 64>::run);
+
+    constexpr std::size_t roundTripBytes = 2 * sizeof(MessageType) * round_trips_per_pass;
+
+    add("ring_latency",
+        "mutex + pel::array",
+        "uint64_t",
+        round_trips_per_pass,
+        roundTripBytes,
+        &round_trip<mutex_ring>::run);
+    add("ring_latency",
+        "pel::ring_array spsc",
+        "uint64_t",
+        round_trips_per_pass,
+        roundTripBytes,
+        &round_trip<SpscRingType>::run);
+    add("ring_latency",
+        "pel::ring_array mpmc",
+        "uint64_t",
+        round_trips_per_pass,
+        roundTripBytes,
+        &round_trip<MpmcRingType>::run);
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,120 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/aligned_array.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* False sharing: one counter per thread ------------------------------------------------------- */
+namespace
+{
+using namespace pel::bench;
+
+using CounterType = std::atomic<std::uint64_t>;
+
+constexpr std::size_t counter_slots       = 8;
+constexpr std::size_t increments_per_pass = 1 << 16;
+
+/* At least two threads, so that the contention shows even on small machines */
+std::size_t
+thread_count()
+{
+    const std::size_t hardware = std::thread::hardware_concurrency();
+    return std::clamp<std::size_t>(hardware, 2, counter_slots);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Every thread increments its own slot of `ContainerType`. Adjacent slots of a
+ *              `pel::array` share cache lines, the ones of a `pel::padded_array` don't.
+ *************************************************************************************************/
+template<typename ContainerType>
+struct counters
+{
+    static void run(state& state_)
+    {
+        std::unique_ptr<ContainerType> slots   = std::make_unique<ContainerType>();
+        const std::size_t              threads = thread_count();
+
+        state_.measure(
+          [&]
+          {
+              std::vector<std::thread> workers;
+              workers.reserve(threads);
+              for(std::size_t t = 0; t < threads; ++t)
+              {
+                  workers.emplace_back(
+                    [&slots, t]
+                    {
+                        CounterType& counter = (*slots)[t];
+                        for(std::size_t i = 0; i < increments_per_pass; ++i)
+                        {
+                            counter.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+              }
+              for(std::thread& worker : workers)
+              {
+                  worker.join();
+              }
+              do_not_optimize(*slots);
+          });
+    }
+};
+
+const bool registered = []
+{
+    const std::size_t bytes = sizeof(std::uint64_t) * increments_per_pass * thread_count();
+
+    add("false_sharing",
+        "pel::array",
+        "atomic<uint64_t>",
+        counter_slots,
+        bytes,
+        &counters<pel::array<CounterType, counter_slots>>::run);
+    add("false_sharing",
+        "pel::aligned_array",
+        "atomic<uint64_t>",
+        counter_slots,
+        bytes,
+        &counters<pel::aligned_array<CounterType, counter_slots>>::run);
+    add("false_sharing",
+        "pel::padded_array",
+        "atomic<uint64_t>",
+        counter_slots,
+        bytes,
+        &counters<pel::padded_array<CounterType, counter_slots>>::run);
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,215 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array_reduce.hpp"
+#include "src/soa_array.hpp"
+
+
+/*************************************************************************************************/
+/* Single-field kernels: array of structures against structure of arrays ----------------------- */
+namespace
+{
+using namespace pel::bench;
+
+struct particle
+{
+    float x;
+    float y;
+    float z;
+    float vx;
+    float vy;
+    float vz;
+    float mass;
+    float charge;
+};
+
+constexpr float time_step = 0.01f;
+
+template<std::size_t ItemCount>
+using aos_particles = pel::array<particle, ItemCount>;
+template<std::size_t ItemCount>
+using soa_particles = pel::soa_array<particle, ItemCount>;
+
+template<typename ContainerType>
+[[nodiscard]] std::unique_ptr<ContainerType>
+make_particles()
+{
+    std::unique_ptr<ContainerType> particles = std::make_unique<ContainerType>();
+    for(std::size_t i = 0; i < particles->size(); ++i)
+    {
+        const float value = static_cast<float>(i % 64);
+        (*particles)[i]   = particle{value, value, value, 1.0f, 1.0f, 1.0f, value, -value};
+    }
+    return particles;
+}
+
+/* Sum of the masses, looping over whole particles */
+template<std::size_t ItemCount>
+void
+scan_aos(state& state_)
+{
+    using ContainerType = aos_particles<ItemCount>;
+
+    std::unique_ptr<ContainerType> particles = make_particles<ContainerType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          float total = 0.0f;
+          for(const particle& item : *particles)
+          {
+              total += item.mass;
+          }
+          do_not_optimize(total);
+      });
+}
+
+/* Sum of the masses, looping over the mass column */
+template<std::size_t ItemCount>
+void
+scan_soa_loop(state& state_)
+{
+    using ContainerType = soa_particles<ItemCount>;
+
+    std::unique_ptr<ContainerType> particles = make_particles<ContainerType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          float total = 0.0f;
+          for(float mass : particles->template column<6>())
+          {
+              total += mass;
+          }
+          do_not_optimize(total);
+      });
+}
+
+/* Sum of the masses, reducing the mass column by SIMD packs */
+template<std::size_t ItemCount>
+void
+scan_soa_simd(state& state_)
+{
+    using ContainerType = soa_particles<ItemCount>;
+
+    std::unique_ptr<ContainerType> particles = make_particles<ContainerType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          const float total = pel::sum(particles->template column<6>());
+          do_not_optimize(total);
+      });
+}
+
+/* `x += vx * dt` over whole particles */
+template<std::size_t ItemCount>
+void
+update_aos(state& state_)
+{
+    using ContainerType = aos_particles<ItemCount>;
+
+    std::unique_ptr<ContainerType> particles = make_particles<ContainerType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          for(particle& item : *particles)
+          {
+              item.x += item.vx * time_step;
+          }
+          do_not_optimize(*particles);
+      });
+}
+
+/* `x += vx * dt` as an expression over the x and vx columns */
+template<std::size_t ItemCount>
+void
+update_soa_simd(state& state_)
+{
+    using ContainerType = soa_particles<ItemCount>;
+
+    std::unique_ptr<ContainerType> particles = make_particles<ContainerType>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          particles->template column<0>() =
+            particles->template column<0>() + particles->template column<3>() * time_step;
+          do_not_optimize(*particles);
+      });
+}
+
+template<std::size_t ItemCount>
+void
+add_soa_cases()
+{
+    constexpr std::size_t scanBytes   = sizeof(float) * ItemCount;
+    constexpr std::size_t updateBytes = 3 * sizeof(float) * ItemCount;
+
+    add("field_scan", "pel::array (AoS)", "particle", ItemCount, scanBytes, &scan_aos<ItemCount>);
+    add("field_scan",
+        "pel::soa_array (loop)",
+        "particle",
+        ItemCount,
+        scanBytes,
+        &scan_soa_loop<ItemCount>);
+    add("field_scan",
+        "pel::soa_array (pel::sum)",
+        "particle",
+        ItemCount,
+        scanBytes,
+        &scan_soa_simd<ItemCount>);
+
+    add("field_update",
+        "pel::array (AoS)",
+        "particle",
+        ItemCount,
+        updateBytes,
+        &update_aos<ItemCount>);
+    add("field_update",
+        "pel::soa_array (expression)",
+        "particle",
+        ItemCount,
+        updateBytes,
+        &update_soa_simd<ItemCount>);
+}
+
+const bool registered = []
+{
+    add_soa_cases<1024>();
+    add_soa_cases<16384>();
+    add_soa_cases<1 << 20>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,267 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array_sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Sorting and searching: pel::sort and lookups against std::sort and std::lower_bound --------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t arrays_per_pass  = 256;
+constexpr std::size_t lookups_per_pass = 4096;
+
+enum class sorter
+{
+    pel,
+    std,
+};
+
+enum class searcher
+{
+    std_lower_bound,
+    pel_lower_bound,
+    eytzinger,
+};
+
+template<typename ItemType>
+[[nodiscard]] std::vector<ItemType>
+random_items(std::size_t count_, std::uint32_t seed_)
+{
+    std::mt19937          generator{seed_};
+    std::vector<ItemType> items(count_);
+    for(ItemType& item : items)
+    {
+        item = static_cast<ItemType>(generator() % (1U << 30));
+    }
+    return items;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Sorts many small arrays of random scores, as when ranking the top-k candidates.
+ *              Every iteration copies the arrays back from unsorted sources before sorting them.
+ *************************************************************************************************/
+template<sorter Sorter, typename ItemType, std::size_t ItemCount>
+struct sort_small
+{
+    using ArrayType = pel::array<ItemType, ItemCount>;
+
+    static void run(state& state_)
+    {
+        const std::vector<ItemType> items = random_items<ItemType>(arrays_per_pass * ItemCount, 1);
+
+        std::vector<ArrayType> sources(arrays_per_pass);
+        for(std::size_t i = 0; i < arrays_per_pass; ++i)
+        {
+            std::copy_n(items.begin() + static_cast<std::ptrdiff_t>(i * ItemCount),
+                        ItemCount,
+                        sources[i].begin());
+        }
+        std::vector<ArrayType> arrays(arrays_per_pass);
+
+        state_.measure(
+          [&]
+          {
+              for(std::size_t i = 0; i < arrays_per_pass; ++i)
+              {
+                  arrays[i] = sources[i];
+                  if constexpr(Sorter == sorter::pel)
+                  {
+                      pel::sort(arrays[i]);
+                  }
+                  else
+                  {
+                      std::sort(arrays[i].begin(), arrays[i].end());
+                  }
+              }
+              do_not_optimize(arrays);
+          });
+    }
+};
+
+template<sorter Sorter, typename ItemType, std::size_t ItemCount>
+struct sort_large
+{
+    using ArrayType = pel::array<ItemType, ItemCount>;
+
+    static void run(state& state_)
+    {
+        const std::vector<ItemType> items = random_items<ItemType>(ItemCount, 2);
+
+        std::unique_ptr<ArrayType> source = std::make_unique<ArrayType>();
+        std::unique_ptr<ArrayType> array  = std::make_unique<ArrayType>();
+        std::copy(items.begin(), items.end(), source->begin());
+
+        state_.measure(
+          [&]
+          {
+              *array = *source;
+              if constexpr(Sorter == sorter::pel)
+              {
+                  pel::sort(*array);
+              }
+              else
+              {
+                  std::sort(array->begin(), array->end());
+              }
+              do_not_optimize(*array);
+          });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Looks up random keys in a sorted table.
+ *************************************************************************************************/
+template<searcher Searcher, std::size_t ItemCount>
+struct search_table
+{
+    using ArrayType = pel::array<std::uint32_t, ItemCount>;
+
+    static void run(state& state_)
+    {
+        const std::vector<std::uint32_t> items = random_items<std::uint32_t>(ItemCount, 3);
+        const std::vector<std::uint32_t> keys  = random_items<std::uint32_t>(lookups_per_pass, 4);
+
+        /* The largest item is past every key, so that every lookup finds an item */
+        std::unique_ptr<ArrayType> table = std::make_unique<ArrayType>();
+        std::copy(items.begin(), items.end(), table->begin());
+        table->back() = std::numeric_limits<std::uint32_t>::max();
+        pel::sort(*table);
+
+        using EytzingerType = pel::eytzinger_array<std::uint32_t, ItemCount>;
+        std::unique_ptr<EytzingerType> eytzinger = std::make_unique<EytzingerType>(*table);
+
+        state_.measure(
+          [&]
+          {
+              std::size_t found = 0;
+              for(const std::uint32_t key : keys)
+              {
+                  if constexpr(Searcher == searcher::std_lower_bound)
+                  {
+                      found += static_cast<std::size_t>(
+                        *std::lower_bound(table->begin(), table->end(), key) & 1U);
+                  }
+                  else if constexpr(Searcher == searcher::pel_lower_bound)
+                  {
+                      found += table->unchecked(pel::lower_bound(*table, key)) & 1U;
+                  }
+                  else
+                  {
+                      const std::uint32_t* item = eytzinger->lower_bound(key);
+                      found += (item != nullptr) ? (*item & 1U) : 0U;
+                  }
+              }
+              do_not_optimize(found);
+          });
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount>
+void
+add_sort_small_cases(const char* itemName_)
+{
+    constexpr std::size_t bytes = sizeof(ItemType) * ItemCount * arrays_per_pass;
+
+    add("sort_small",
+        "pel::sort",
+        itemName_,
+        ItemCount,
+        bytes,
+        &sort_small<sorter::pel, ItemType, ItemCount>::run);
+    add("sort_small",
+        "std::sort",
+        itemName_,
+        ItemCount,
+        bytes,
+        &sort_small<sorter::std, ItemType, ItemCount>::run);
+}
+
+template<std::size_t ItemCount>
+void
+add_search_cases()
+{
+    constexpr std::size_t bytes = sizeof(std::uint32_t) * lookups_per_pass;
+
+    add("search",
+        "std::lower_bound",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &search_table<searcher::std_lower_bound, ItemCount>::run);
+    add("search",
+        "pel::lower_bound",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &search_table<searcher::pel_lower_bound, ItemCount>::run);
+    add("search",
+        "pel::eytzinger_array",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &search_table<searcher::eytzinger, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_sort_small_cases<float, 8>("float");
+    add_sort_small_cases<float, 16>("float");
+    add_sort_small_cases<float, 32>("float");
+    add_sort_small_cases<std::int32_t, 16>("int32_t");
+
+    constexpr std::size_t largeCount = 1 << 16;
+    add("sort_large",
+        "pel::sort",
+        "int32_t",
+        largeCount,
+        sizeof(std::int32_t) * largeCount,
+        &sort_large<sorter::pel, std::int32_t, largeCount>::run);
+    add("sort_large",
+        "std::sort",
+        "int32_t",
+        largeCount,
+        sizeof(std::int32_t) * largeCount,
+        &sort_large<sorter::std, std::int32_t, largeCount>::run);
+
+    add_search_cases<1024>();
+    add_search_cases<1 << 20>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,184 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/static_vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Fixed-capacity vectors: static_vector against std::vector with reserve on small sizes ------- */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t vectors_per_pass = 256;
+constexpr std::size_t churn_operations = 1 << 12;
+
+template<typename ItemType, std::size_t ItemCount>
+struct std_vector
+{
+    using Type = std::vector<ItemType>;
+
+    [[nodiscard]] static Type make()
+    {
+        Type items;
+        items.reserve(ItemCount);
+        return items;
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount>
+struct static_vector
+{
+    using Type = pel::static_vector<ItemType, ItemCount>;
+
+    [[nodiscard]] static Type make()
+    {
+        return Type{};
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Builds many short-lived vectors of `ItemCount` items, as when gathering the
+ *              neighbours of each node of a graph.
+ *************************************************************************************************/
+template<typename VectorType, typename ItemType, std::size_t ItemCount>
+struct build_vectors
+{
+    static void run(state& state_)
+    {
+        const ItemType value = sample_item<ItemType>();
+
+        state_.measure(
+          [&]
+          {
+              for(std::size_t i = 0; i < vectors_per_pass; ++i)
+              {
+                  auto items = VectorType::make();
+                  for(std::size_t j = 0; j < ItemCount; ++j)
+                  {
+                      items.push_back(value);
+                  }
+                  do_not_optimize(items);
+              }
+          });
+    }
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Keeps a full vector sorted while replacing a pseudo-random item at each step, with
+ *              one `erase` and one `insert` at a searched position.
+ *************************************************************************************************/
+template<typename VectorType, std::size_t ItemCount>
+struct sorted_churn
+{
+    static void run(state& state_)
+    {
+        std::vector<std::uint32_t>                   keys(churn_operations);
+        std::mt19937                                 generator{42};
+        std::uniform_int_distribution<std::uint32_t> distribution;
+        std::generate(keys.begin(), keys.end(), [&] { return distribution(generator); });
+
+        auto items = VectorType::make();
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            items.push_back(keys[i]);
+        }
+        std::sort(items.begin(), items.end());
+
+        state_.measure(
+          [&]
+          {
+              for(const std::uint32_t key : keys)
+              {
+                  items.erase(items.begin() + static_cast<std::ptrdiff_t>(key % ItemCount));
+                  items.insert(std::lower_bound(items.begin(), items.end(), key), key);
+              }
+              do_not_optimize(items);
+          });
+    }
+};
+
+template<typename ItemType, std::size_t ItemCount>
+void
+add_build_cases(const char* itemName_)
+{
+    constexpr std::size_t bytes = sizeof(ItemType) * ItemCount * vectors_per_pass;
+
+    add("static_vector_build",
+        "pel::static_vector",
+        itemName_,
+        ItemCount,
+        bytes,
+        &build_vectors<static_vector<ItemType, ItemCount>, ItemType, ItemCount>::run);
+    add("static_vector_build",
+        "std::vector+reserve",
+        itemName_,
+        ItemCount,
+        bytes,
+        &build_vectors<std_vector<ItemType, ItemCount>, ItemType, ItemCount>::run);
+}
+
+template<std::size_t ItemCount>
+void
+add_churn_cases()
+{
+    constexpr std::size_t bytes = sizeof(std::uint32_t) * ItemCount;
+
+    add("static_vector_churn",
+        "pel::static_vector",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &sorted_churn<static_vector<std::uint32_t, ItemCount>, ItemCount>::run);
+    add("static_vector_churn",
+        "std::vector+reserve",
+        "uint32_t",
+        ItemCount,
+        bytes,
+        &sorted_churn<std_vector<std::uint32_t, ItemCount>, ItemCount>::run);
+}
+
+const bool registered = []
+{
+    add_build_cases<int, 16>("int");
+    add_build_cases<int, 64>("int");
+    add_build_cases<std::string, 16>("std::string");
+
+    add_churn_cases<16>();
+    add_churn_cases<64>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
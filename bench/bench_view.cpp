@@ -0,0 +1,157 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./bench_containers.hpp"
+#include "src/array_reduce.hpp"
+
+
+/*************************************************************************************************/
+/* Zero-copy views against copies of the viewed items ------------------------------------------ */
+namespace
+{
+using namespace pel::bench;
+
+constexpr std::size_t block_length = 64;
+
+template<std::size_t ItemCount>
+[[nodiscard]] std::unique_ptr<pel::array<float, ItemCount>>
+make_samples()
+{
+    std::unique_ptr<pel::array<float, ItemCount>> samples =
+      std::make_unique<pel::array<float, ItemCount>>();
+    for(std::size_t i = 0; i < ItemCount; ++i)
+    {
+        (*samples)[i] = static_cast<float>(i % 64);
+    }
+    return samples;
+}
+
+/* Sum of every block, copying each block into its own array first */
+template<std::size_t ItemCount>
+void
+block_copy(state& state_)
+{
+    std::unique_ptr<pel::array<float, ItemCount>> samples = make_samples<ItemCount>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          float total = 0.0f;
+          for(std::size_t offset = 0; offset < ItemCount; offset += block_length)
+          {
+              const pel::array<float, block_length> block{
+                samples->begin() + static_cast<std::ptrdiff_t>(offset),
+                samples->begin() + static_cast<std::ptrdiff_t>(offset + block_length)};
+              total += pel::sum(block);
+          }
+          do_not_optimize(total);
+      });
+}
+
+/* Sum of every block, reducing a static-extent slice of the array */
+template<std::size_t ItemCount>
+void
+block_view(state& state_)
+{
+    std::unique_ptr<pel::array<float, ItemCount>> samples = make_samples<ItemCount>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          float total = 0.0f;
+          for(std::size_t offset = 0; offset < ItemCount; offset += block_length)
+          {
+              total += pel::sum(samples->template slice<block_length>(offset));
+          }
+          do_not_optimize(total);
+      });
+}
+
+/* Sum of the left channel of interleaved stereo samples, copying the channel out first */
+template<std::size_t ItemCount>
+void
+channel_copy(state& state_)
+{
+    std::unique_ptr<pel::array<float, ItemCount>> samples = make_samples<ItemCount>();
+    std::unique_ptr<pel::array<float, ItemCount / 2>> channel =
+      std::make_unique<pel::array<float, ItemCount / 2>>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          for(std::size_t i = 0; i < ItemCount / 2; ++i)
+          {
+              (*channel)[i] = (*samples)[2 * i];
+          }
+          const float total = pel::sum(*channel);
+          do_not_optimize(total);
+      });
+}
+
+/* Sum of the left channel of interleaved stereo samples, through a strided view */
+template<std::size_t ItemCount>
+void
+channel_view(state& state_)
+{
+    std::unique_ptr<pel::array<float, ItemCount>> samples = make_samples<ItemCount>();
+
+    state_.measure(
+      [&]
+      {
+          clobber_memory();
+          float total = 0.0f;
+          for(float sample : samples->strided(2))
+          {
+              total += sample;
+          }
+          do_not_optimize(total);
+      });
+}
+
+template<std::size_t ItemCount>
+void
+add_view_cases()
+{
+    constexpr std::size_t bytes = sizeof(float) * ItemCount;
+
+    add("subblock_sum", "copy + pel::sum", "float", ItemCount, bytes, &block_copy<ItemCount>);
+    add("subblock_sum", "slice<64> + pel::sum", "float", ItemCount, bytes, &block_view<ItemCount>);
+
+    add("channel_sum", "copy + pel::sum", "float", ItemCount, bytes, &channel_copy<ItemCount>);
+    add("channel_sum", "strided(2) loop", "float", ItemCount, bytes, &channel_view<ItemCount>);
+}
+
+const bool registered = []
+{
+    add_view_cases<16384>();
+    add_view_cases<1 << 20>();
+    return true;
+}();
+}        // namespace
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,83 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "src/array.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+
+
+/*************************************************************************************************/
+/* Code size probe: the same array code instantiated for many sizes ---------------------------- */
+
+/* Number of distinct sizes instantiated, set by the "array_code_size_report" target */
+#if !defined(PEL_CODE_SIZE_INSTANTIATIONS)
+#define PEL_CODE_SIZE_INSTANTIATIONS 16
+#endif
+
+namespace
+{
+/**
+ **************************************************************************************************
+ * \brief       Builds, copies, assigns and prints arrays of strings and floats of sizes derived
+ *              from `Index`, going through the members that used to be compiled once per size.
+ *************************************************************************************************/
+template<std::size_t Index>
+void
+exercise_arrays(std::ostream& os_, const std::string& value_)
+{
+    constexpr std::size_t item_count = Index + 2;
+
+    pel::array<std::string, item_count>     strings(value_);
+    pel::array<std::string, item_count + 1> grown{strings};
+    grown.assign(value_, 1, item_count);
+    grown = std::move(strings);
+
+    pel::array<float, item_count * 16> floats(static_cast<float>(value_.size()));
+    floats.assign(1.0f, Index, 4);
+
+    os_ << strings << grown.to_string() << floats;
+}
+
+template<std::size_t... Indexes>
+void
+exercise_all(std::ostream& os_, const std::string& value_, std::index_sequence<Indexes...>)
+{
+    (exercise_arrays<Indexes>(os_, value_), ...);
+}
+}        // namespace
+
+
+int
+main(int argc_, char** argv_)
+{
+    const std::string value = (argc_ > 1) ? argv_[1] : "item";
+    exercise_all(std::cout, value, std::make_index_sequence<PEL_CODE_SIZE_INSTANTIATIONS>{});
+    return 0;
+}
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,54 @@
+# -----------------------------------------------------------------------------
+# Code size report
+#
+# Prints the text size of the code size probes, built for an increasing number
+# of array sizes with and without PEL_ARRAY_SHARED_CODE, and the text added by
+# each new size. Run through the "array_code_size_report" target, which passes:
+#   SIZE_TOOL: "size" or "llvm-size" program
+#   PROBES:    "instantiations|shared|path" entries, separated by "^"
+# -----------------------------------------------------------------------------
+cmake_minimum_required(VERSION 3.17)
+
+string(REPLACE "^" ";" probe_list "${PROBES}")
+
+message("")
+message("instantiations  shared_code  text_bytes  bytes_per_size")
+
+foreach(probe ${probe_list})
+    string(REPLACE "|" ";" fields "${probe}")
+    list(GET fields 0 instantiations)
+    list(GET fields 1 shared)
+    list(GET fields 2 path)
+
+    # Berkeley format: the first column of the second line is the text size
+    execute_process(COMMAND "${SIZE_TOOL}" "${path}"
+                    OUTPUT_VARIABLE size_output
+                    RESULT_VARIABLE size_result)
+    if(NOT size_result EQUAL 0)
+        message(FATAL_ERROR "${SIZE_TOOL} failed on ${path}")
+    endif()
+    string(REGEX MATCH "\n[ \t]*([0-9]+)" size_line "${size_output}")
+    set(text_bytes "${CMAKE_MATCH_1}")
+
+    # Text added by each size, relative to the build with the fewest sizes
+    if(NOT DEFINED first_text_${shared})
+        set(first_text_${shared} ${text_bytes})
+        set(first_instantiations_${shared} ${instantiations})
+        set(bytes_per_size "-")
+    else()
+        math(EXPR added_text "${text_bytes} - ${first_text_${shared}}")
+        math(EXPR added_sizes "${instantiations} - ${first_instantiations_${shared}}")
+        math(EXPR bytes_per_size "${added_text} / ${added_sizes}")
+    endif()
+
+    string(LENGTH "${instantiations}" width)
+    math(EXPR padding "16 - ${width}")
+    string(REPEAT " " ${padding} instantiations_padding)
+    string(LENGTH "${text_bytes}" width)
+    math(EXPR padding "12 - ${width}")
+    string(REPEAT " " ${padding} text_padding)
+
+    message("${instantiations}${instantiations_padding}${shared}            "
+            "${text_bytes}${text_padding}${bytes_per_size}")
+endforeach()
+message("")
@@ -0,0 +1,156 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace pel::aggregate
+{
+/*************************************************************************************************/
+/* Field counting ------------------------------------------------------------------------------ */
+
+/* Largest number of fields supported by `field_count` and `tie` */
+constexpr std::size_t max_fields = 8;
+
+/* Stand-in convertible to any field type, only used in unevaluated contexts */
+struct any_field
+{
+    template<typename FieldType>
+    constexpr operator FieldType() const noexcept;
+};
+
+template<typename Type, std::size_t... Indexes>
+constexpr bool
+is_initializable_with(std::index_sequence<Indexes...> /* indexes_ */) noexcept
+{
+    return requires { Type{(static_cast<void>(Indexes), any_field{})...}; };
+}
+
+template<typename Type, std::size_t Count = max_fields>
+constexpr std::size_t
+count_fields() noexcept
+{
+    if constexpr(Count == 0 || is_initializable_with<Type>(std::make_index_sequence<Count>{}))
+    {
+        return Count;
+    }
+    else
+    {
+        return count_fields<Type, Count - 1>();
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Number of fields of an aggregate, found by aggregate-initializing it with more and
+ *              more fields.
+ *
+ * \note        Only aggregates without base classes, whose fields are not C arrays, are
+ *              supported: brace elision would count each element of an array as a field.
+ *************************************************************************************************/
+template<typename Type>
+constexpr std::size_t field_count = count_fields<std::remove_cv_t<Type>>();
+
+template<typename Type>
+concept decomposable_type = std::is_aggregate_v<std::remove_cv_t<Type>>
+                            && !std::is_array_v<std::remove_cv_t<Type>>
+                            && (field_count<Type> > 0) && (field_count<Type> <= max_fields);
+
+
+/*************************************************************************************************/
+/* Field access -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Tuple of references to every field of an aggregate, in declaration order.
+ *
+ * \param       aggregate_: Aggregate to decompose.
+ *
+ * \retval      std::tuple<Fields&...>: References to the fields of `aggregate_`, const if
+ *              `aggregate_` is.
+ *************************************************************************************************/
+template<decomposable_type Type>
+[[nodiscard]] constexpr auto
+tie(Type& aggregate_) noexcept
+{
+    constexpr std::size_t count = field_count<Type>;
+
+    if constexpr(count == 1)
+    {
+        auto& [f0] = aggregate_;
+        return std::tie(f0);
+    }
+    else if constexpr(count == 2)
+    {
+        auto& [f0, f1] = aggregate_;
+        return std::tie(f0, f1);
+    }
+    else if constexpr(count == 3)
+    {
+        auto& [f0, f1, f2] = aggregate_;
+        return std::tie(f0, f1, f2);
+    }
+    else if constexpr(count == 4)
+    {
+        auto& [f0, f1, f2, f3] = aggregate_;
+        return std::tie(f0, f1, f2, f3);
+    }
+    else if constexpr(count == 5)
+    {
+        auto& [f0, f1, f2, f3, f4] = aggregate_;
+        return std::tie(f0, f1, f2, f3, f4);
+    }
+    else if constexpr(count == 6)
+    {
+        auto& [f0, f1, f2, f3, f4, f5] = aggregate_;
+        return std::tie(f0, f1, f2, f3, f4, f5);
+    }
+    else if constexpr(count == 7)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6] = aggregate_;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6);
+    }
+    else
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7] = aggregate_;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+    }
+}
+
+/* Type of the field `Index` of an aggregate */
+template<decomposable_type Type, std::size_t Index>
+using field_type =
+  std::remove_cvref_t<std::tuple_element_t<Index, decltype(tie(std::declval<Type&>()))>>;
+
+}        // namespace pel::aggregate
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,315 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+
+/*************************************************************************************************/
+/* Target detection ---------------------------------------------------------------------------- */
+
+/* Size, in bytes, of the unit of data exchanged between cores: two threads writing to the same
+ * cache line slow each other down even if they never touch the same bytes (false sharing).
+ * Can be overridden on the command line (ie `-DPEL_CACHE_LINE_BYTES=128`). */
+#if !defined(PEL_CACHE_LINE_BYTES)
+#if defined(__APPLE__) && defined(__aarch64__)
+#define PEL_CACHE_LINE_BYTES 128
+#else
+#define PEL_CACHE_LINE_BYTES 64
+#endif
+#endif
+
+
+namespace pel
+{
+constexpr std::size_t cache_line_bytes = PEL_CACHE_LINE_BYTES;
+
+
+/*************************************************************************************************/
+/* Over-aligned array -------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       `pel::array` whose first element is aligned on `Alignment` bytes, so that vector
+ *              loads and stores on it never cross a cache line.
+ *
+ * \note        The array is otherwise a `pel::array`: it has the same interface, can be used in
+ *              array expressions and reductions, and is trivially copyable whenever `ItemType`
+ *              is. Its size is rounded up to a multiple of `Alignment`.
+ *************************************************************************************************/
+template<typename ItemType,
+         std::size_t ItemCount,
+         std::size_t Alignment = cache_line_bytes,
+         typename BoundsCheck  = default_bounds_check>
+class alignas(Alignment) aligned_array : public array<ItemType, ItemCount, BoundsCheck>
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(ItemType), "Alignment can't be lower than the items'");
+
+public:
+    using ArrayType = array<ItemType, ItemCount, BoundsCheck>;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    using ArrayType::ArrayType;
+    using ArrayType::operator=;
+
+    [[nodiscard]] constexpr ItemType*       data() noexcept;
+    [[nodiscard]] constexpr const ItemType* data() const noexcept;
+};
+
+template<typename ItemType, std::size_t ItemCount, std::size_t Alignment, typename BoundsCheck>
+constexpr bool is_array<aligned_array<ItemType, ItemCount, Alignment, BoundsCheck>> = true;
+
+
+/*************************************************************************************************/
+/* Cache-line padded array --------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Item of a `padded_array`, alone on its cache line(s).
+ *************************************************************************************************/
+template<typename ItemType>
+struct alignas(cache_line_bytes) padded_item
+{
+    ItemType value;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Random-access iterator over the items of a `padded_array`, skipping the padding.
+ *************************************************************************************************/
+template<typename ItemType>
+class padded_iterator
+{
+    using SlotType = std::conditional_t<std::is_const_v<ItemType>,
+                                        const padded_item<std::remove_const_t<ItemType>>,
+                                        padded_item<ItemType>>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type        = std::remove_const_t<ItemType>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = ItemType*;
+    using reference         = ItemType&;
+
+    using ReverseIteratorType = std::reverse_iterator<padded_iterator>;
+
+    constexpr padded_iterator() noexcept = default;
+    constexpr explicit padded_iterator(SlotType* slot_) noexcept : m_slot{slot_}
+    {
+    }
+
+    [[nodiscard]] constexpr ItemType& operator*() const noexcept
+    {
+        return m_slot->value;
+    }
+    [[nodiscard]] constexpr ItemType* operator->() const noexcept
+    {
+        return std::addressof(m_slot->value);
+    }
+    [[nodiscard]] constexpr ItemType& operator[](difference_type offset_) const noexcept
+    {
+        return m_slot[offset_].value;
+    }
+
+    constexpr padded_iterator& operator++() noexcept
+    {
+        ++m_slot;
+        return *this;
+    }
+    constexpr padded_iterator operator++(int) noexcept
+    {
+        padded_iterator previous = *this;
+        ++m_slot;
+        return previous;
+    }
+    constexpr padded_iterator& operator--() noexcept
+    {
+        --m_slot;
+        return *this;
+    }
+    constexpr padded_iterator operator--(int) noexcept
+    {
+        padded_iterator previous = *this;
+        --m_slot;
+        return previous;
+    }
+
+    constexpr padded_iterator& operator+=(difference_type offset_) noexcept
+    {
+        m_slot += offset_;
+        return *this;
+    }
+    constexpr padded_iterator& operator-=(difference_type offset_) noexcept
+    {
+        m_slot -= offset_;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr padded_iterator operator+(padded_iterator it_,
+                                                             difference_type offset_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr padded_iterator operator+(difference_type offset_,
+                                                             padded_iterator it_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr padded_iterator operator-(padded_iterator it_,
+                                                             difference_type offset_) noexcept
+    {
+        return it_ -= offset_;
+    }
+    [[nodiscard]] friend constexpr difference_type operator-(const padded_iterator& lhs_,
+                                                             const padded_iterator& rhs_) noexcept
+    {
+        return lhs_.m_slot - rhs_.m_slot;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const padded_iterator&) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const padded_iterator&) const noexcept = default;
+
+private:
+    SlotType* m_slot = nullptr;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Fixed-size array storing each of its items on its own cache line.
+ *
+ * \note        Meant for per-thread slots (counters, accumulators, flags): threads writing to
+ *              their own item never invalidate each other's cache lines. The items are not
+ *              contiguous, so the array has no `data()` and can't be used in array expressions.
+ *
+ * \note        The interface otherwise follows `pel::array`, including its `BoundsCheck` policy.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck = default_bounds_check>
+class padded_array
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType            = std::size_t;
+    using DifferenceType      = std::ptrdiff_t;
+    using IteratorType        = padded_iterator<ItemType>;
+    using ConstIteratorType   = padded_iterator<const ItemType>;
+    using RIteratorType       = typename IteratorType::ReverseIteratorType;
+    using ConstRIteratorType  = typename ConstIteratorType::ReverseIteratorType;
+    using InitializerListType = std::initializer_list<ItemType>;
+    using BoundsCheckType     = BoundsCheck;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr explicit padded_array() = default;
+    constexpr explicit padded_array(const ItemType& value_);
+    constexpr padded_array(InitializerListType ilist_);
+
+    template<array_generator_type<ItemType> GeneratorType>
+    constexpr explicit padded_array(GeneratorType&& generator_);
+    template<array_indexed_generator_type<ItemType> GeneratorType>
+    constexpr explicit padded_array(GeneratorType&& generator_);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cbegin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cend() const noexcept;
+
+    [[nodiscard]] constexpr RIteratorType      rbegin() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType      rend() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ItemType&
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr const ItemType&
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] constexpr ItemType&       at(SizeType index_);
+    [[nodiscard]] constexpr const ItemType& at(SizeType index_) const;
+    [[nodiscard]] constexpr ItemType&       unchecked(SizeType index_) noexcept;
+    [[nodiscard]] constexpr const ItemType& unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ItemType&       front() noexcept;
+    [[nodiscard]] constexpr const ItemType& front() const noexcept;
+    [[nodiscard]] constexpr ItemType&       back() noexcept;
+    [[nodiscard]] constexpr const ItemType& back() const noexcept;
+
+    constexpr void assign(const ItemType& value_, DifferenceType offset_ = 0, SizeType count_ = 1);
+    constexpr void assign(InitializerListType ilist_, DifferenceType offset_ = 0);
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Misc ------------------------------------------------------------------------------------ */
+    [[nodiscard]] constexpr std::string to_string() const;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    constexpr void check_fit(SizeType size_) const;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    constexpr static SizeType m_size = ItemCount;
+    array<padded_item<ItemType>, ItemCount, BoundsCheck> m_items;
+};
+
+}        // namespace pel
+
+
+#include "./aligned_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
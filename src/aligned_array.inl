@@ -0,0 +1,407 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./aligned_array.hpp"
+
+#include <algorithm>
+#include <ostream>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define ALIGNED_ARRAY_TEMPLATE_DECLARATION__                                                       \
+    typename ItemType, std::size_t ItemCount, std::size_t Alignment, typename BoundsCheck
+#define ALIGNED_ARRAY_CLASS_SCOPE__ aligned_array<ItemType, ItemCount, Alignment, BoundsCheck>
+
+#define PADDED_ARRAY_TEMPLATE_DECLARATION__                                                        \
+    typename ItemType, std::size_t ItemCount, typename BoundsCheck
+#define PADDED_ARRAY_CLASS_SCOPE__ padded_array<ItemType, ItemCount, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* ALIGNED ARRAY ------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Item type and length of an aligned array operand, same as its `pel::array` base.
+ *************************************************************************************************/
+template<ALIGNED_ARRAY_TEMPLATE_DECLARATION__>
+struct array_operand_traits<ALIGNED_ARRAY_CLASS_SCOPE__>
+: array_operand_traits<array<ItemType, ItemCount, BoundsCheck>>
+{
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a pointer to the beginning of the array's data space.
+ *
+ * \retval      ItemType*: Pointer to the beginning of the array's data, which the compiler may
+ *              assume to be aligned on `Alignment` bytes.
+ *************************************************************************************************/
+template<ALIGNED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType*
+ALIGNED_ARRAY_CLASS_SCOPE__::data() noexcept
+{
+    return std::assume_aligned<Alignment>(ArrayType::data());
+}
+
+template<ALIGNED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType*
+ALIGNED_ARRAY_CLASS_SCOPE__::data() const noexcept
+{
+    return std::assume_aligned<Alignment>(ArrayType::data());
+}
+
+
+/*************************************************************************************************/
+/* PADDED ARRAY -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Overload of the left-shift << operator to print a padded array's content to an
+ *              output stream, in the same format as a `pel::array`.
+ *
+ * \param       os_:  Left-hand-side output stream.
+ * \param       arr_: Right-hand-side array to print.
+ *
+ * \retval      std::ostream&: Reference the output stream after appending data.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+inline static std::ostream&
+operator<<(std::ostream& os_, const PADDED_ARRAY_CLASS_SCOPE__& arr_) noexcept
+{
+    shared::print_items(os_, arr_.begin(), arr_.length());
+
+    return os_;
+}
+
+
+/*************************************************************************************************/
+/* Constructors -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Default-value constructor for the padded array class.
+ *
+ * \param       value_:  Value to initialize all the elements with.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr PADDED_ARRAY_CLASS_SCOPE__::padded_array(const ItemType& value_)
+{
+    std::fill(begin(), end(), value_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Initializer-list constructor for the padded array class.
+ *
+ * \param       ilist_: Values to initialize the first elements with.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr PADDED_ARRAY_CLASS_SCOPE__::padded_array(InitializerListType ilist_)
+{
+    check_fit(ilist_.size());
+
+    std::copy(ilist_.begin(), ilist_.end(), begin());
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Generator constructors for the padded array class, see `pel::array`.
+ *
+ * \param       generator_: Callable taking either no arguments, or the index of the element to
+ *                          generate.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+template<array_generator_type<ItemType> GeneratorType>
+constexpr PADDED_ARRAY_CLASS_SCOPE__::padded_array(GeneratorType&& generator_)
+{
+    for(SizeType i = 0; i < m_size; ++i)
+    {
+        m_items.unchecked(i).value = generator_();
+    }
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+template<array_indexed_generator_type<ItemType> GeneratorType>
+constexpr PADDED_ARRAY_CLASS_SCOPE__::padded_array(GeneratorType&& generator_)
+{
+    for(SizeType i = 0; i < m_size; ++i)
+    {
+        m_items.unchecked(i).value = generator_(i);
+    }
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::IteratorType
+PADDED_ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return IteratorType{m_items.data()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return ConstIteratorType{m_items.data()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::cbegin() const noexcept
+{
+    return ConstIteratorType{m_items.data()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::IteratorType
+PADDED_ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return IteratorType{m_items.data() + m_size};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::end() const noexcept
+{
+    return ConstIteratorType{m_items.data() + m_size};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::cend() const noexcept
+{
+    return ConstIteratorType{m_items.data() + m_size};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::RIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::rbegin() noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return ConstRIteratorType{end()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::RIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::rend() noexcept
+{
+    return RIteratorType{begin()};
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+PADDED_ARRAY_CLASS_SCOPE__::rend() const noexcept
+{
+    return ConstRIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the array. `operator[]` is checked according to
+ *              `BoundsCheck::subscript`, `at()` always is and `unchecked()` never is.
+ *
+ * \param       index_: Index of the element to access.
+ *
+ * \retval      ItemType&: Reference to the element at `index_`.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    return m_items[index_].value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    return m_items[index_].value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::at(SizeType index_)
+{
+    return m_items.at(index_).value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::at(SizeType index_) const
+{
+    return m_items.at(index_).value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) noexcept
+{
+    return m_items.unchecked(index_).value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return m_items.unchecked(index_).value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::front() noexcept
+{
+    return m_items.front().value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::front() const noexcept
+{
+    return m_items.front().value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::back() noexcept
+{
+    return m_items.back().value;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+PADDED_ARRAY_CLASS_SCOPE__::back() const noexcept
+{
+    return m_items.back().value;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to a certain offset in the array for a certain amount of elements.
+ *
+ * \param       value_:  Value to assign to the array.
+ * \param       offset_: Offset at which data should be assigned.
+ *              [defaults : 0]
+ * \param       count_:  Number of elements to be assigned a new value.
+ *              [defaults : 1]
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PADDED_ARRAY_CLASS_SCOPE__::assign(const ItemType& value_, DifferenceType offset_, SizeType count_)
+{
+    check_fit(count_ + static_cast<SizeType>(offset_));
+
+    std::fill_n(begin() + offset_, count_, value_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Assign values to a certain offset in the array through an initializer list.
+ *
+ * \param       ilist_:  Values to assign to the array.
+ * \param       offset_: Offset at which data should be assigned.
+ *              [defaults : 0]
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PADDED_ARRAY_CLASS_SCOPE__::assign(InitializerListType ilist_, DifferenceType offset_)
+{
+    check_fit(ilist_.size() + static_cast<SizeType>(offset_));
+
+    std::copy(ilist_.begin(), ilist_.end(), begin() + offset_);
+}
+
+
+/*************************************************************************************************/
+/* Size & misc --------------------------------------------------------------------------------- */
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::SizeType
+PADDED_ARRAY_CLASS_SCOPE__::length() noexcept
+{
+    return m_size;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PADDED_ARRAY_CLASS_SCOPE__::SizeType
+PADDED_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return m_size;
+}
+
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline std::string
+PADDED_ARRAY_CLASS_SCOPE__::to_string() const
+{
+    return shared::format_items(begin(), m_size);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Check that `size_` items fit in the array, according to the `BoundsCheck` policy.
+ *
+ * \param       size_: Number of items to fit in the array.
+ *************************************************************************************************/
+template<PADDED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PADDED_ARRAY_CLASS_SCOPE__::check_fit(SizeType size_) const
+{
+    BoundsCheck::template check<std::length_error>(size_ <= m_size, "Data couldn't fit in array");
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef ALIGNED_ARRAY_TEMPLATE_DECLARATION__
+#undef ALIGNED_ARRAY_CLASS_SCOPE__
+#undef PADDED_ARRAY_TEMPLATE_DECLARATION__
+#undef PADDED_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -25,23 +25,182 @@
 
 /*************************************************************************************************/
 /* File includes ------------------------------------------------------------------------------- */
+#include "./array_expression.hpp"
+#include "./array_policy.hpp"
 #include "./container_base/src/container_base.hpp"
 
 #include <algorithm>
+#include <concepts>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
 #include <type_traits>
 
 
 namespace pel
 {
-constexpr bool array_safeness = true;
-
 template<typename ItemType>
 using array_iterator = iterator_base<ItemType>;
 
+/* Callables producing items: `f()` for plain generators, `f(index)` for indexed generators */
+template<typename GeneratorType, typename ItemType>
+concept array_generator_type =
+  std::invocable<GeneratorType&>
+  && std::convertible_to<std::invoke_result_t<GeneratorType&>, ItemType>;
+
+template<typename GeneratorType, typename ItemType>
+concept array_indexed_generator_type =
+  !std::invocable<GeneratorType&> && std::invocable<GeneratorType&, std::size_t>
+  && std::convertible_to<std::invoke_result_t<GeneratorType&, std::size_t>, ItemType>;
+
+/* Contiguous ranges read or written through `std::data` and `std::size`, ie: `pel::array`,
+ * `std::vector`, `std::span` or C arrays */
+template<typename RangeType, typename ItemType>
+concept array_contiguous_range = requires(const RangeType& range_) {
+    { std::data(range_) } -> std::convertible_to<const ItemType*>;
+    { std::size(range_) } -> std::convertible_to<std::size_t>;
+};
+
+template<typename RangeType, typename ItemType>
+concept array_output_range = requires(RangeType& range_) {
+    { std::data(range_) } -> std::convertible_to<ItemType*>;
+    { std::size(range_) } -> std::convertible_to<std::size_t>;
+};
+
+/* Contiguous ranges of integral indices */
+template<typename RangeType>
+concept array_index_range = requires(const RangeType& range_) {
+    { std::size(range_) } -> std::convertible_to<std::size_t>;
+    requires std::is_integral_v<std::remove_cvref_t<decltype(*std::data(range_))>>;
+    requires !std::is_same_v<std::remove_cvref_t<decltype(*std::data(range_))>, bool>;
+};
+
+/* Ranges whose items are assigned to consecutive items of an array */
+template<typename RangeType, typename ItemType>
+concept array_assignable_range =
+  !std::convertible_to<RangeType, const ItemType&>
+  && (array_contiguous_range<RangeType, ItemType>
+      || (std::ranges::input_range<RangeType> && std::ranges::sized_range<RangeType>
+          && std::convertible_to<std::ranges::range_reference_t<RangeType>, ItemType>));
+
+/**
+ **************************************************************************************************
+ * \brief       Tag of the `pel::array` constructor leaving its items uninitialized, for large
+ *              buffers of trivially copyable items that are about to be overwritten, ie:
+ *              `std::make_unique<pel::array<float, 1 << 20>>(pel::for_overwrite)` doesn't zero the
+ *              array before it's filled, unlike `std::make_unique<pel::array<float, 1 << 20>>()`.
+ *************************************************************************************************/
+struct for_overwrite_t
+{
+    explicit for_overwrite_t() = default;
+};
+
+inline constexpr for_overwrite_t for_overwrite{};
+
+/**
+ **************************************************************************************************
+ * \brief       Storage of the items of a `pel::array`.
+ *
+ * \note        Trivially default constructible items are stored in a plain C array: their default
+ *              initialization does nothing, and the array stays trivial and usable in constant
+ *              expressions. Other items are stored in a union, whose construction and destruction
+ *              do nothing: the array builds and destroys them itself.
+ *************************************************************************************************/
+template<typename ItemType,
+         std::size_t ItemCount,
+         bool Uninitialized = !std::is_trivially_default_constructible_v<ItemType>>
+struct array_storage
+{
+    static constexpr bool uninitialized = false;
+
+    /* Copied and moved like the array itself, item by item */
+    constexpr array_storage()                                = default;
+    constexpr array_storage(const array_storage&)            = default;
+    constexpr array_storage(array_storage&&)                 = default;
+    constexpr array_storage& operator=(const array_storage&) = default;
+    constexpr array_storage& operator=(array_storage&&)      = default;
+
+    ItemType m_data[ItemCount];
+};
+
 template<typename ItemType, std::size_t ItemCount>
-class array : public container_base<ItemType, array_iterator<ItemType>>
+struct array_storage<ItemType, ItemCount, true>
+{
+    static constexpr bool uninitialized = true;
+
+    constexpr array_storage() noexcept
+    {
+    }
+    constexpr array_storage(const array_storage&)            = default;
+    constexpr array_storage(array_storage&&)                 = default;
+    constexpr array_storage& operator=(const array_storage&) = default;
+    constexpr array_storage& operator=(array_storage&&)      = default;
+
+    constexpr ~array_storage() requires(std::is_trivially_destructible_v<ItemType>) = default;
+    constexpr ~array_storage()
+    {
+    }
+
+    union
+    {
+        ItemType m_data[ItemCount];
+    };
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Fixed-size array container.
+ *
+ * \note        The array does not derive from `container_base`: its begin and end iterators are
+ *              computed from `m_data` instead of being stored, and it has no virtual functions.
+ *              `sizeof(array<T, N>)` is therefore `sizeof(T[N])`, and the array is trivially
+ *              copyable whenever `ItemType` is.
+ *
+ * \note        `BoundsCheck` is one of the `pel::bounds_check` policies, and applies to
+ *              `operator[]`, `assign` and every size check of the array. `at()` is always
+ *              checked and `unchecked()` never is, whatever the policy.
+ *              Different policies can coexist in the same program, ie:
+ *              `pel::array<float, 1024, pel::bounds_check::unchecked>` for an inner kernel fed by
+ *              a checked `pel::array<float, 1024>`.
+ *
+ * \note        Every constructor builds each item exactly once. Items that are trivially default
+ *              constructible are default-initialized then written, which is the same thing.
+ *              Other items are built in place in uninitialized storage, and destroyed by the
+ *              destructor of the array.
+ *
+ * \note        The code that doesn't depend on `ItemCount` (loops over the items, formatting,
+ *              failed checks) is compiled once per item type in `pel::shared`, and called by every
+ *              size of array. See `PEL_ARRAY_SHARED_CODE`.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+class array : private array_storage<ItemType, ItemCount>
 {
+    /* The special members of uninitialized storage must build, copy and destroy the items
+     * themselves, unless the items are trivial enough or can't be copied anyway */
+    static constexpr bool uninitialized_storage = array_storage<ItemType, ItemCount>::uninitialized;
+    static constexpr bool defaulted_copy =
+      !uninitialized_storage || std::is_trivially_copy_constructible_v<ItemType>
+      || !std::is_copy_constructible_v<ItemType>;
+    static constexpr bool defaulted_copy_assignment =
+      !uninitialized_storage || std::is_trivially_copy_assignable_v<ItemType>
+      || !std::is_copy_assignable_v<ItemType>;
+    static constexpr bool defaulted_move =
+      !uninitialized_storage || std::is_trivially_move_constructible_v<ItemType>
+      || !std::is_move_constructible_v<ItemType>;
+    static constexpr bool defaulted_move_assignment =
+      !uninitialized_storage || std::is_trivially_move_assignable_v<ItemType>
+      || !std::is_move_assignable_v<ItemType>;
+
+    /* Loops over the items call the routines shared by every size, unless they go over a few
+     * trivially copyable items, which unroll into fewer instructions than the call */
+    static constexpr bool shared_loops =
+      !std::is_trivially_copyable_v<ItemType>
+      || (sizeof(ItemType) * ItemCount > PEL_ARRAY_SHARED_CODE_BYTES);
+    static constexpr bool defaulted_destructor =
+      !uninitialized_storage || std::is_trivially_destructible_v<ItemType>;
+
 public:
     /*********************************************************************************************/
     /* Type definitions ------------------------------------------------------------------------ */
@@ -49,32 +208,54 @@ public:
     using SizeType            = std::size_t;
     using DifferenceType      = std::ptrdiff_t;
     using IteratorType        = array_iterator<ItemType>;
+    using ConstIteratorType   = array_iterator<const ItemType>;
     using RIteratorType       = typename IteratorType::ReverseIteratorType;
+    using ConstRIteratorType  = typename ConstIteratorType::ReverseIteratorType;
     using InitializerListType = std::initializer_list<ItemType>;
+    using BoundsCheckType     = BoundsCheck;
 
 
     /*********************************************************************************************/
     /* Constructors ---------------------------------------------------------------------------- */
-    constexpr explicit array() = default;
+    constexpr explicit array() requires(!uninitialized_storage) = default;
+    constexpr explicit array()
+    requires(uninitialized_storage && std::is_default_constructible_v<ItemType>);
+    constexpr explicit array(for_overwrite_t) noexcept
+    requires(std::is_trivially_copyable_v<ItemType>);
     constexpr explicit array(const ItemType& value_);
     constexpr explicit array(IteratorType beginIterator_, IteratorType endIterator_);
 
     /*-----------------------------------------------*/
     /* Copy constructor and copy-assignment operator */
-    template<SizeType OtherSize>
-    constexpr explicit array(const array<ItemType, OtherSize>& copy_);
-    constexpr explicit array(const array& copy_);
+    template<SizeType OtherSize, typename OtherBoundsCheck>
+    requires(OtherSize == ItemCount
+             || (OtherSize < ItemCount && std::is_default_constructible_v<ItemType>))
+    constexpr explicit array(const array<ItemType, OtherSize, OtherBoundsCheck>& copy_);
+    constexpr array(const array& copy_) requires(defaulted_copy) = default;
+    constexpr array(const array& copy_) requires(!defaulted_copy);
 
-    template<SizeType OtherSize>
-    constexpr array& operator=(const array<ItemType, OtherSize>& copy_);
-    constexpr array& operator=(const array& copy_);
+    template<SizeType OtherSize, typename OtherBoundsCheck>
+    requires(OtherSize <= ItemCount)
+    constexpr array& operator=(const array<ItemType, OtherSize, OtherBoundsCheck>& copy_);
+    constexpr array& operator=(const array& copy_) requires(defaulted_copy_assignment) = default;
+    constexpr array& operator=(const array& copy_) requires(!defaulted_copy_assignment);
 
     /*-----------------------------------------------*/
     /* Move constructor and move-assignment operator */
-    template<SizeType OtherSize>
-    constexpr explicit array(array<ItemType, OtherSize>&& move_);
-    template<SizeType OtherSize>
-    constexpr array& operator=(array<ItemType, OtherSize>&& move_);
+    template<SizeType OtherSize, typename OtherBoundsCheck>
+    requires(OtherSize == ItemCount
+             || (OtherSize < ItemCount && std::is_default_constructible_v<ItemType>))
+    constexpr explicit array(array<ItemType, OtherSize, OtherBoundsCheck>&& move_);
+    constexpr array(array&& move_) requires(defaulted_move) = default;
+    constexpr array(array&& move_) noexcept(std::is_nothrow_move_constructible_v<ItemType>)
+    requires(!defaulted_move);
+
+    template<SizeType OtherSize, typename OtherBoundsCheck>
+    requires(OtherSize <= ItemCount)
+    constexpr array& operator=(array<ItemType, OtherSize, OtherBoundsCheck>&& move_);
+    constexpr array& operator=(array&& move_) requires(defaulted_move_assignment) = default;
+    constexpr array& operator=(array&& move_) noexcept(std::is_nothrow_move_assignable_v<ItemType>)
+    requires(!defaulted_move_assignment);
 
 
     /*----------------------*/
@@ -82,48 +263,188 @@ public:
     constexpr array(InitializerListType ilist_);
 
     template<typename... Args>
+    requires std::is_constructible_v<ItemType, Args...>
     constexpr explicit array(Args&&... args_);
 
-    constexpr explicit array(std::function<ItemType(void)> function_);
+    template<array_generator_type<ItemType> GeneratorType>
+    constexpr explicit array(GeneratorType&& generator_);
+    template<array_indexed_generator_type<ItemType> GeneratorType>
+    constexpr explicit array(GeneratorType&& generator_);
+
+    /*-----------------------------------*/
+    /* Element-wise expression evaluation */
+    template<array_expression_type ExpressionType>
+    constexpr array(const ExpressionType& expression_);
+    template<array_expression_type ExpressionType>
+    constexpr array& operator=(const ExpressionType& expression_);
 
     /*------------*/
     /* Destructor */
-    /* ~array(); */
+    constexpr ~array() requires(defaulted_destructor) = default;
+    constexpr ~array() requires(!defaulted_destructor);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cbegin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cend() const noexcept;
+
+    [[nodiscard]] constexpr RIteratorType      rbegin() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType      rend() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rend() const noexcept;
 
 
     /*********************************************************************************************/
     /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ItemType&
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr const ItemType&
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] constexpr ItemType&       at(SizeType index_);
+    [[nodiscard]] constexpr const ItemType& at(SizeType index_) const;
+    [[nodiscard]] constexpr ItemType&       unchecked(SizeType index_) noexcept;
+    [[nodiscard]] constexpr const ItemType& unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ItemType&       front() noexcept;
+    [[nodiscard]] constexpr const ItemType& front() const noexcept;
+    [[nodiscard]] constexpr ItemType&       back() noexcept;
+    [[nodiscard]] constexpr const ItemType& back() const noexcept;
+
     [[nodiscard]] constexpr ItemType*       data() noexcept;
     [[nodiscard]] constexpr const ItemType* data() const noexcept;
 
     constexpr void assign(const ItemType& value_, DifferenceType offset_ = 0, SizeType count_ = 1);
     constexpr void assign(InitializerListType ilist_, DifferenceType offset_ = 0);
+    template<array_assignable_range<ItemType> RangeType>
+    constexpr void assign(RangeType&& range_, DifferenceType offset_ = 0);
+    template<array_contiguous_range<bool> MaskType>
+    constexpr void assign_if(const MaskType& mask_, const ItemType& value_);
+
+    template<array_contiguous_range<ItemType> SourceType, array_index_range IndexRangeType>
+    constexpr void gather(const SourceType& source_, const IndexRangeType& indices_);
+    template<array_output_range<ItemType> DestinationType, array_index_range IndexRangeType>
+    constexpr void scatter(DestinationType&& destination_, const IndexRangeType& indices_) const;
+
+    template<array_contiguous_range<bool> MaskType, array_output_range<ItemType> DestinationType>
+    constexpr SizeType compress(const MaskType& mask_, DestinationType&& destination_) const;
+    template<array_contiguous_range<bool> MaskType, array_contiguous_range<ItemType> SourceType>
+    constexpr SizeType expand(const MaskType& mask_, const SourceType& source_);
+
+
+    /*********************************************************************************************/
+    /* Views ----------------------------------------------------------------------------------- */
+    using ViewType      = array_view<ItemType, dynamic_extent, BoundsCheck>;
+    using ConstViewType = array_view<const ItemType, dynamic_extent, BoundsCheck>;
+
+    [[nodiscard]] constexpr array_view<ItemType, ItemCount, BoundsCheck> view() noexcept;
+    [[nodiscard]] constexpr array_view<const ItemType, ItemCount, BoundsCheck>
+    view() const noexcept;
+
+    template<SizeType Offset, SizeType Count = ItemCount - Offset>
+    [[nodiscard]] constexpr array_view<ItemType, Count, BoundsCheck> subarray() noexcept;
+    template<SizeType Offset, SizeType Count = ItemCount - Offset>
+    [[nodiscard]] constexpr array_view<const ItemType, Count, BoundsCheck>
+    subarray() const noexcept;
+
+    [[nodiscard]] constexpr ViewType      slice(SizeType offset_, SizeType count_);
+    [[nodiscard]] constexpr ConstViewType slice(SizeType offset_, SizeType count_) const;
+    template<SizeType Count>
+    [[nodiscard]] constexpr array_view<ItemType, Count, BoundsCheck> slice(SizeType offset_);
+    template<SizeType Count>
+    [[nodiscard]] constexpr array_view<const ItemType, Count, BoundsCheck>
+    slice(SizeType offset_) const;
+
+    [[nodiscard]] constexpr strided_view<ItemType, BoundsCheck> strided(SizeType step_,
+                                                                        SizeType offset_ = 0);
+    [[nodiscard]] constexpr strided_view<const ItemType, BoundsCheck>
+    strided(SizeType step_, SizeType offset_ = 0) const;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
 
 
     /*********************************************************************************************/
     /* Misc ------------------------------------------------------------------------------------ */
-    [[nodiscard]] constexpr std::string to_string() const override;
+    [[nodiscard]] constexpr std::string to_string() const;
 
 
     /*********************************************************************************************/
     /* Private methods ------------------------------------------------------------------------- */
 private:
     constexpr void check_fit(SizeType size_) const;
+    template<typename IndexType>
+    constexpr void check_indices(const IndexType* indices_, SizeType count_, SizeType limit_) const;
+
+    constexpr void copy_items(const ItemType* source_, SizeType count_);
+    constexpr void move_items(ItemType* source_, SizeType count_);
+    constexpr void assign_items(const ItemType* source_, SizeType count_, SizeType offset_);
 
-    constexpr void array_constructor();
+    template<typename ProducerType>
+    constexpr void construct_items(SizeType count_, ProducerType&& producer_);
+    constexpr void construct_copies(const ItemType* source_, SizeType count_);
+    constexpr void construct_moves(ItemType* source_, SizeType count_);
 
 
     /*********************************************************************************************/
     /* Variables ------------------------------------------------------------------------------- */
 private:
+    using array_storage<ItemType, ItemCount>::m_data;
+
     constexpr static SizeType m_size = ItemCount;
-    ItemType        m_data[m_size];
 };
 
+
+/**
+ **************************************************************************************************
+ * \brief       Trait of the item types that can be relocated with `memcpy`: copying the bytes of
+ *              an object to another address and forgetting the original, without destroying it,
+ *              is the same as move-constructing a new object then destroying the original.
+ *
+ * \note        Trivially copyable types are. Other types opt in by specializing the trait, as long
+ *              as they don't refer to their own address, ie: a handle owning a heap buffer through
+ *              a plain pointer, but not `std::string`, whose short strings point inside the object.
+ *              Arrays are trivially relocatable whenever their items are.
+ *************************************************************************************************/
+template<typename ItemType>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<ItemType>>
+{
+};
+
+template<typename ItemType>
+struct is_trivially_relocatable<std::unique_ptr<ItemType>> : std::true_type
+{
+};
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+struct is_trivially_relocatable<array<ItemType, ItemCount, BoundsCheck>>
+: is_trivially_relocatable<ItemType>
+{
+};
+
+template<typename ItemType>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<ItemType>::value;
+
+
+template<std::size_t ItemCount,
+         typename BoundsCheck = default_bounds_check,
+         typename GeneratorType>
+[[nodiscard]] constexpr auto generate(GeneratorType&& generator_);
+
 }        // namespace pel
 
 
 #include "./array.inl"
+#include "./array_expression.inl"
+#include "./array_view.hpp"
 
 /*************************************************************************************************/
 /* ----- END OF FILE ----- */
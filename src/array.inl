@@ -23,17 +23,25 @@
  */
 #pragma once
 #include "./array.hpp"
-
+#include "./array_instrumentation.hpp"
+#include "./array_shared.hpp"
+#include "./simd_permute.hpp"
+
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
 #include <ostream>
-#include <sstream>
+#include <utility>
 
 namespace pel
 {
 
 /*************************************************************************************************/
 /* Defines ------------------------------------------------------------------------------------- */
-#define ARRAY_TEMPLATE_DECLARATION__ typename ItemType, std::size_t ItemCount
-#define ARRAY_CLASS_SCOPE__          array<ItemType, ItemCount>
+#define ARRAY_TEMPLATE_DECLARATION__ typename ItemType, std::size_t ItemCount, typename BoundsCheck
+#define ARRAY_CLASS_SCOPE__          array<ItemType, ItemCount, BoundsCheck>
 
 
 /**
@@ -51,15 +59,9 @@ namespace pel
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
 inline static std::ostream&
-operator<<(std::ostream& os_, const array<ItemType, ItemCount>& arr_) noexcept
+operator<<(std::ostream& os_, const ARRAY_CLASS_SCOPE__& arr_) noexcept
 {
-    /* Add capacity and length header */
-    os_ << "Length: [" << arr_.length() << "]\n";
-
-    for(ItemType& element : arr_)
-    {
-        os_ << element << '\n';
-    }
+    shared::print_items(os_, arr_.data(), arr_.length());
 
     return os_;
 }
@@ -70,6 +72,35 @@ operator<<(std::ostream& os_, const array<ItemType, ItemCount>& arr_) noexcept
 /*************************************************************************************************/
 
 
+/**
+ **************************************************************************************************
+ * \brief       Default constructor for the array class, for items built in uninitialized storage.
+ *              Every item is value-initialized.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr ARRAY_CLASS_SCOPE__::array()
+requires(uninitialized_storage && std::is_default_constructible_v<ItemType>)
+{
+    instrumentation::record<array>(instrumentation::event::construction, m_size);
+
+    shared::construct_defaults(m_data, m_size);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor leaving the items uninitialized, to be overwritten before being read.
+ *
+ * \note        Unlike the default constructor, value-initializing the array doesn't zero its items,
+ *              ie: `std::make_unique<pel::array<float, 4096>>(pel::for_overwrite)`.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr ARRAY_CLASS_SCOPE__::array(for_overwrite_t /* tag_ */) noexcept
+requires(std::is_trivially_copyable_v<ItemType>)
+{
+}
+
+
 /**
  **************************************************************************************************
  * \brief       Default-value constructor for the array class.
@@ -79,15 +110,20 @@ operator<<(std::ostream& os_, const array<ItemType, ItemCount>& arr_) noexcept
 template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr ARRAY_CLASS_SCOPE__::array(const ItemType& value_)
 {
-    array_constructor();
-
-    /* clang-format off */
-    std::for_each(begin(), end(),
-                  [&](ItemType& item)
-                  {
-                      AllocatorTraits::construct(m_allocator, &item, value_);
-                  });
-    /* clang-format on */
+    if constexpr(uninitialized_storage)
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        shared::construct_fill(m_data, m_size, value_);
+    }
+    else if constexpr(shared_loops)
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        shared::fill_items(m_data, value_, m_size);
+    }
+    else
+    {
+        construct_items(m_size, [&value_](SizeType) -> const ItemType& { return value_; });
+    }
 }
 
 
@@ -102,18 +138,10 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr ARRAY_CLASS_SCOPE__::array(const IteratorType beginIterator_,
                                      const IteratorType endIterator_)
 {
-    if(std::is_constant_evaluated())
-    {
-        m_size = endIterator_ - beginIterator_;
-    }
-    else
-    {
-        check_fit(endIterator_ - beginIterator_);
-    }
-
-    array_constructor();
+    const SizeType count = static_cast<SizeType>(endIterator_ - beginIterator_);
+    check_fit(count);
 
-    std::copy(beginIterator_, endIterator_, begin());
+    construct_copies(beginIterator_.ptr(), count);
 }
 
 
@@ -122,31 +150,30 @@ constexpr ARRAY_CLASS_SCOPE__::array(const IteratorType beginIterator_,
  * \brief       Copy constructor for the array class.
  *
  * \param       otherArray_: Array to copy data from.
+ *
+ * \note        Arrays longer than this one are rejected at compile-time, whatever the
+ *              bounds-checking policy.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-template<std::size_t OtherSize>
-constexpr ARRAY_CLASS_SCOPE__::array(const array<ItemType, OtherSize>& otherArray_)
+template<std::size_t OtherSize, typename OtherBoundsCheck>
+requires(OtherSize == ItemCount
+         || (OtherSize < ItemCount && std::is_default_constructible_v<ItemType>))
+constexpr ARRAY_CLASS_SCOPE__::array(
+  const array<ItemType, OtherSize, OtherBoundsCheck>& otherArray_)
 {
-    if(std::is_constant_evaluated())
-    {
-        m_size = otherArray_.length();
-    }
-    else
-    {
-        check_fit(otherArray_.length());
-    }
-
-    array_constructor();
-
-    std::copy(otherArray_.begin(), otherArray_.end(), begin());
+    construct_copies(otherArray_.data(), OtherSize);
 }
 
+/**
+ **************************************************************************************************
+ * \brief       Copy constructor for arrays of items built in uninitialized storage.
+ *
+ * \param       copy_: Array to copy data from.
+ *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-constexpr ARRAY_CLASS_SCOPE__::array(const array& otherArray_)
+constexpr ARRAY_CLASS_SCOPE__::array(const array& copy_) requires(!defaulted_copy)
 {
-    array_constructor();
-
-    std::copy(otherArray_.begin(), otherArray_.end(), begin());
+    construct_copies(copy_.data(), m_size);
 }
 
 /**
@@ -154,31 +181,34 @@ constexpr ARRAY_CLASS_SCOPE__::array(const array& otherArray_)
  * \brief       Copy assignment operator for the array class.
  *
  * \param       copy_: Array to copy data from.
+ *
+ * \note        Arrays longer than this one are rejected at compile-time, whatever the
+ *              bounds-checking policy.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-template<std::size_t OtherSize>
-constexpr inline array<ItemType, ItemCount>&
-ARRAY_CLASS_SCOPE__::operator=(const array<ItemType, OtherSize>& copy_)
+template<std::size_t OtherSize, typename OtherBoundsCheck>
+requires(OtherSize <= ItemCount)
+constexpr inline ARRAY_CLASS_SCOPE__&
+ARRAY_CLASS_SCOPE__::operator=(const array<ItemType, OtherSize, OtherBoundsCheck>& copy_)
 {
-    if(std::is_constant_evaluated())
-    {
-        m_size = copy_.length();
-    }
-    else
-    {
-        check_fit(copy_.length());
-    }
-
-    std::copy(copy_.begin(), copy_.begin(), begin());
+    copy_items(copy_.data(), OtherSize);
 
     return *this;
 }
 
+/**
+ **************************************************************************************************
+ * \brief       Copy assignment operator for arrays of items built in uninitialized storage.
+ *
+ * \param       copy_: Array to copy data from.
+ *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-constexpr inline array<ItemType, ItemCount>&
-ARRAY_CLASS_SCOPE__::operator=(const array<ItemType, ItemCount>& copy_)
+constexpr inline ARRAY_CLASS_SCOPE__&
+ARRAY_CLASS_SCOPE__::operator=(const array& copy_) requires(!defaulted_copy_assignment)
 {
-    return operator=<ItemType, ItemCount>(copy_);
+    copy_items(copy_.data(), m_size);
+
+    return *this;
 }
 
 
@@ -189,23 +219,34 @@ ARRAY_CLASS_SCOPE__::operator=(const array<ItemType, ItemCount>& copy_)
  * \param       otherVector_: Vector to move data from.
  * \param       alloc_:       Allocator to use for all memory allocations
  *              [defaults : AllocatorType{}]
+ *
+ * \note        Arrays longer than this one are rejected at compile-time, whatever the
+ *              bounds-checking policy.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-template<std::size_t OtherSize>
-constexpr ARRAY_CLASS_SCOPE__::array(array<ItemType, OtherSize>&& move_)
+template<std::size_t OtherSize, typename OtherBoundsCheck>
+requires(OtherSize == ItemCount
+         || (OtherSize < ItemCount && std::is_default_constructible_v<ItemType>))
+constexpr ARRAY_CLASS_SCOPE__::array(array<ItemType, OtherSize, OtherBoundsCheck>&& move_)
 {
-    if(std::is_constant_evaluated())
-    {
-        m_size = move_.length();
-    }
-    else
-    {
-        check_fit(move_.length());
-    }
-
-    array_constructor();
+    construct_moves(move_.data(), OtherSize);
+}
 
-    std::move(move_.begin(), move_.end(), begin());
+/**
+ **************************************************************************************************
+ * \brief       Move constructor for arrays of items built in uninitialized storage.
+ *              Each item is move-constructed from the matching item of `move_`.
+ *
+ * \param       move_: Array to move data from, whose items are left in their moved-from state.
+ *
+ * \note        Doesn't throw if moving the items doesn't, so that containers of arrays move them
+ *              instead of copying them when they grow.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr ARRAY_CLASS_SCOPE__::array(array&& move_) noexcept(
+  std::is_nothrow_move_constructible_v<ItemType>) requires(!defaulted_move)
+{
+    construct_moves(move_.data(), m_size);
 }
 
 /**
@@ -215,20 +256,41 @@ constexpr ARRAY_CLASS_SCOPE__::array(array<ItemType, OtherSize>&& move_)
  * \param       move__: Vector to move data from.
  *
  * \note        Will do nothing if attempting to move a vector into itself
+ *
+ * \note        Arrays longer than this one are rejected at compile-time, whatever the
+ *              bounds-checking policy.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-template<std::size_t OtherSize>
-constexpr inline array<ItemType, ItemCount>&
-ARRAY_CLASS_SCOPE__::operator=(array<ItemType, OtherSize>&& move_)
+template<std::size_t OtherSize, typename OtherBoundsCheck>
+requires(OtherSize <= ItemCount)
+constexpr inline ARRAY_CLASS_SCOPE__&
+ARRAY_CLASS_SCOPE__::operator=(array<ItemType, OtherSize, OtherBoundsCheck>&& move_)
 {
-    if(this != std::addressof(move_))
+    if(data() != move_.data())
     {
-        /* Grab the other vector's resources */
-        std::move(move_.begin(), move_.end(), begin());
+        /* Grab the other array's elements */
+        move_items(move_.data(), OtherSize);
+    }
+    return *this;
+}
 
-        /* Invalidate the other vector */
-        move_.m_beginIterator = IteratorType{nullptr};
-        move_.m_endIterator   = IteratorType{nullptr};
+/**
+ **************************************************************************************************
+ * \brief       Move assignment operator for arrays of items built in uninitialized storage.
+ *              Each item is move-assigned from the matching item of `move_`.
+ *
+ * \param       move_: Array to move data from, whose items are left in their moved-from state.
+ *
+ * \note        Will do nothing if attempting to move an array into itself.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline ARRAY_CLASS_SCOPE__&
+ARRAY_CLASS_SCOPE__::operator=(array&& move_) noexcept(
+  std::is_nothrow_move_assignable_v<ItemType>) requires(!defaulted_move_assignment)
+{
+    if(this != &move_)
+    {
+        move_items(move_.data(), m_size);
     }
     return *this;
 }
@@ -246,9 +308,7 @@ constexpr ARRAY_CLASS_SCOPE__::array(InitializerListType ilist_)
 {
     check_fit(ilist_.size());
 
-    array_constructor();
-
-    std::copy(ilist_.begin(), ilist_.end(), begin());
+    construct_copies(ilist_.begin(), ilist_.size());
 }
 
 
@@ -264,53 +324,192 @@ constexpr ARRAY_CLASS_SCOPE__::array(InitializerListType ilist_)
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
 template<typename... Args>
+requires std::is_constructible_v<ItemType, Args...>
 constexpr ARRAY_CLASS_SCOPE__::array(Args&&... args_)
 {
-    /* clang-format off */
-    auto builder = [&](ItemType& element)
-                   {
-                       AllocatorTraits::construct(m_allocator,
-                                                  &element,
-                                                  std::forward<Args>(args_)...);
-                   };
-    /* clang-format on */
+    construct_items(m_size, [&](SizeType) { return ItemType(args_...); });
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Generator-taking constructor for the array class.
+ *              Calls `generator_()` once per element, from first to last.
+ *
+ * \param       generator_: Callable (taking no arguments and returning something convertible
+ *                          to `ItemType`) called to initialize all the values in the array.
+ *
+ * \note        The generator is taken as-is rather than through `std::function`, so that it can
+ *              be inlined and used in constant evaluation.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_generator_type<ItemType> GeneratorType>
+constexpr ARRAY_CLASS_SCOPE__::array(GeneratorType&& generator_)
+{
+    construct_items(m_size, [&generator_](SizeType) -> decltype(auto) { return generator_(); });
+}
 
-    array_constructor();
 
-    std::for_each(begin(), end(), builder);
+/**
+ **************************************************************************************************
+ * \brief       Indexed-generator-taking constructor for the array class.
+ *              Initializes each element `i` with `generator_(i)`.
+ *
+ * \param       generator_: Callable (taking the index of an element and returning something
+ *                          convertible to `ItemType`) called to initialize all the values in the
+ *                          array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_indexed_generator_type<ItemType> GeneratorType>
+constexpr ARRAY_CLASS_SCOPE__::array(GeneratorType&& generator_)
+{
+    construct_items(m_size,
+                    [&generator_](SizeType index_) -> decltype(auto)
+                    {
+                        return generator_(index_);
+                    });
 }
 
 
 /**
  **************************************************************************************************
- * \brief       Generator-taking constructor for the vector class.
- *              Takes a generator function as parameter to create `length_` items in the vector.
+ * \brief       Build an array of `ItemCount` elements from a generator.
+ *              The item type is deduced from the generator's return type.
  *
- * \param       length_ :   Number of elements to create
- * \param       function_ : Function (returning `ItemType` and taking no arguments) called to
- *                          initialize all the values in the vector.
- * \param       alloc_:     Allocator to use for all memory allocations
- *              [defaults : AllocatorType{}]
+ * \param       generator_: Callable taking either no arguments, or the index of the element to
+ *                          generate.
+ *
+ * \retval      array<ItemType, ItemCount, BoundsCheck>: Generated array.
+ *
+ * \note        Used on a `constexpr` variable, the whole array is computed at compile-time and
+ *              placed in read-only data, ie:
+ *              `constexpr auto squares = pel::generate<256>([](std::size_t i) { return i * i; });`
+ *************************************************************************************************/
+template<std::size_t ItemCount, typename BoundsCheck, typename GeneratorType>
+[[nodiscard]] constexpr auto
+generate(GeneratorType&& generator_)
+{
+    if constexpr(std::invocable<GeneratorType&>)
+    {
+        using ItemType = std::remove_cvref_t<std::invoke_result_t<GeneratorType&>>;
+        return array<ItemType, ItemCount, BoundsCheck>(std::forward<GeneratorType>(generator_));
+    }
+    else
+    {
+        using ItemType = std::remove_cvref_t<std::invoke_result_t<GeneratorType&, std::size_t>>;
+        return array<ItemType, ItemCount, BoundsCheck>(std::forward<GeneratorType>(generator_));
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Destructor for arrays of items built in uninitialized storage.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr ARRAY_CLASS_SCOPE__::~array() requires(!defaulted_destructor)
+{
+    shared::destroy_items(m_data, m_size);
+}
+
+
+/*************************************************************************************************/
+/* ITERATORS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first element of the array.
+ *
+ * \retval      IteratorType: Iterator pointing to `m_data[0]`.
+ *
+ * \note        Iterators are computed from `m_data` rather than stored in the array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::IteratorType
+ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return IteratorType{m_data};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstIteratorType
+ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return ConstIteratorType{m_data};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstIteratorType
+ARRAY_CLASS_SCOPE__::cbegin() const noexcept
+{
+    return ConstIteratorType{m_data};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator past the last element of the array.
+ *
+ * \retval      IteratorType: Iterator pointing to `m_data + m_size`.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
-constexpr ARRAY_CLASS_SCOPE__::array(std::function<ItemType(void)> function_)
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::IteratorType
+ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return IteratorType{m_data + m_size};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstIteratorType
+ARRAY_CLASS_SCOPE__::end() const noexcept
 {
-    array_constructor();
+    return ConstIteratorType{m_data + m_size};
+}
 
-    std::generate(begin(), end(), function_);
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstIteratorType
+ARRAY_CLASS_SCOPE__::cend() const noexcept
+{
+    return ConstIteratorType{m_data + m_size};
 }
 
 
 /**
  **************************************************************************************************
- * \brief       Destructor for the array class.
+ * \brief       Get reverse iterators over the array.
+ *
+ * \retval      RIteratorType: Reverse iterator starting at the last element (`rbegin`) or
+ *              before the first element (`rend`).
  *************************************************************************************************/
-//template<ARRAY_TEMPLATE_DECLARATION__>
-//ARRAY_CLASS_SCOPE__::~array()
-//{
-//    /* Destroy elements in the allocated memory */
-//    std::destroy(begin(), end());
-//}
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::RIteratorType
+ARRAY_CLASS_SCOPE__::rbegin() noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstRIteratorType
+ARRAY_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return ConstRIteratorType{end()};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::RIteratorType
+ARRAY_CLASS_SCOPE__::rend() noexcept
+{
+    return RIteratorType{begin()};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstRIteratorType
+ARRAY_CLASS_SCOPE__::rend() const noexcept
+{
+    return ConstRIteratorType{begin()};
+}
 
 
 /*************************************************************************************************/
@@ -318,6 +517,127 @@ constexpr ARRAY_CLASS_SCOPE__::array(std::function<ItemType(void)> function_)
 /*************************************************************************************************/
 
 
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the array, checked according to `BoundsCheck::subscript`.
+ *
+ * \param       index_: Index of the element to access.
+ *
+ * \retval      ItemType&: Reference to the element at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return m_data[index_];
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+ARRAY_CLASS_SCOPE__::operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return m_data[index_];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the array, always checking its bounds.
+ *
+ * \param       index_: Index of the element to access.
+ *
+ * \retval      ItemType&: Reference to the element at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds, whatever the policy.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_CLASS_SCOPE__::at(SizeType index_)
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return m_data[index_];
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+ARRAY_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return m_data[index_];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the array without bounds checking, whatever the policy.
+ *
+ * \param       index_: Index of the element to access, which must be lower than `ItemCount`.
+ *
+ * \retval      ItemType&: Reference to the element at `index_`.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) noexcept
+{
+    return m_data[index_];
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return m_data[index_];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the first element of the array.
+ *
+ * \retval      ItemType&: Reference to the first element.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_CLASS_SCOPE__::front() noexcept
+{
+    return m_data[0];
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+ARRAY_CLASS_SCOPE__::front() const noexcept
+{
+    return m_data[0];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the last element of the array.
+ *
+ * \retval      ItemType&: Reference to the last element.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_CLASS_SCOPE__::back() noexcept
+{
+    return m_data[m_size - 1];
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+ARRAY_CLASS_SCOPE__::back() const noexcept
+{
+    return m_data[m_size - 1];
+}
+
+
 /**
  **************************************************************************************************
  * \brief       Get a pointer to the beginning of the vector's data space.
@@ -328,7 +648,7 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 [[nodiscard]] constexpr inline ItemType*
 ARRAY_CLASS_SCOPE__::data() noexcept
 {
-    return begin().ptr();
+    return m_data;
 }
 
 
@@ -342,7 +662,7 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 [[nodiscard]] constexpr inline const ItemType*
 ARRAY_CLASS_SCOPE__::data() const noexcept
 {
-    return begin().ptr();
+    return m_data;
 }
 
 
@@ -360,12 +680,16 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr inline void
 ARRAY_CLASS_SCOPE__::assign(const ItemType& value_, DifferenceType offset_, SizeType count_)
 {
-    if constexpr(array_safeness == true)
+    check_fit(count_ + static_cast<SizeType>(offset_));
+
+    if constexpr(shared_loops)
     {
-        check_fit(count_ + offset_);
+        shared::fill_items(m_data + offset_, value_, count_);
+    }
+    else
+    {
+        std::fill_n(m_data + offset_, count_, value_);
     }
-
-    std::fill_n(begin() + offset_, count_, value_);
 }
 
 
@@ -381,16 +705,389 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr inline void
 ARRAY_CLASS_SCOPE__::assign(InitializerListType ilist_, DifferenceType offset_)
 {
-    if constexpr(array_safeness == true)
-    {
-        check_fit(ilist_.size() + offset_);
-    }
+    check_fit(ilist_.size() + static_cast<SizeType>(offset_));
 
-    std::copy(ilist_.begin(), ilist_.end(), begin() + offset_);
+    assign_items(ilist_.begin(), ilist_.size(), static_cast<SizeType>(offset_));
 }
 
 
-/*************************************************************************************************/
+/**
+ **************************************************************************************************
+ * \brief       Assign the items of a range to a certain offset in the array.
+ *
+ * \param       range_:  Range of values to assign to the array, whose size is known up front.
+ * \param       offset_: Offset at which data should be assigned.
+ *              [defaults : 0]
+ *
+ * \note        Contiguous ranges are copied with `std::copy_n` from their `data()`, which is a
+ *              single `memmove` for trivially copyable items.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_assignable_range<ItemType> RangeType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::assign(RangeType&& range_, DifferenceType offset_)
+{
+    const SizeType count = static_cast<SizeType>(std::size(range_));
+    check_fit(count + static_cast<SizeType>(offset_));
+
+    if constexpr(array_contiguous_range<RangeType, ItemType>)
+    {
+        assign_items(std::data(range_), count, static_cast<SizeType>(offset_));
+    }
+    else
+    {
+        instrumentation::record<array>(
+          instrumentation::event::copy, count, count * sizeof(ItemType));
+        std::ranges::copy(range_, m_data + offset_);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to the items of the array whose mask is set.
+ *
+ * \param       mask_:  Selection flag of each item, from the first item of the array.
+ * \param       value_: Value to assign to the selected items.
+ *
+ * \note        Trivially copyable items are selected without branches, as a blend of the old and
+ *              new values the compiler can vectorize.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_contiguous_range<bool> MaskType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::assign_if(const MaskType& mask_, const ItemType& value_)
+{
+    const SizeType count = static_cast<SizeType>(std::size(mask_));
+    check_fit(count);
+
+    const bool* mask = std::data(mask_);
+    for(SizeType i = 0; i < count; ++i)
+    {
+        if constexpr(std::is_trivially_copyable_v<ItemType>)
+        {
+            m_data[i] = mask[i] ? value_ : m_data[i];
+        }
+        else if(mask[i])
+        {
+            m_data[i] = value_;
+        }
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign `source_[indices_[i]]` to the `i`th item of the array, for each index.
+ *
+ * \param       source_:  Contiguous range to read the items from.
+ * \param       indices_: Index in `source_` of each item to assign, from the first item of the
+ *                        array.
+ *
+ * \throws      std::length_error if there are more indices than items and the `BoundsCheck` policy
+ *              throws.
+ * \throws      std::out_of_range if an index is past the end of `source_` and the `BoundsCheck`
+ *              policy throws.
+ *
+ * \note        Uses the AVX2 and AVX-512 gather instructions when the target has them.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_contiguous_range<ItemType> SourceType, array_index_range IndexRangeType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::gather(const SourceType& source_, const IndexRangeType& indices_)
+{
+    const SizeType count       = static_cast<SizeType>(std::size(indices_));
+    const SizeType sourceCount = static_cast<SizeType>(std::size(source_));
+    check_fit(count);
+    check_indices(std::data(indices_), count, sourceCount);
+
+    simd::gather<ItemCount>(m_data, std::data(source_), sourceCount, std::data(indices_), count);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign the `i`th item of the array to `destination_[indices_[i]]`, for each index.
+ *
+ * \param       destination_: Contiguous range to write the items to.
+ * \param       indices_:     Index in `destination_` of each item, from the first item of the
+ *                            array.
+ *
+ * \throws      std::length_error if there are more indices than items and the `BoundsCheck` policy
+ *              throws.
+ * \throws      std::out_of_range if an index is past the end of `destination_` and the
+ *              `BoundsCheck` policy throws.
+ *
+ * \note        When an index is repeated, the item of the last one is kept.
+ * \note        Uses the AVX-512 scatter instructions when the target has them.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_output_range<ItemType> DestinationType, array_index_range IndexRangeType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::scatter(DestinationType&& destination_, const IndexRangeType& indices_) const
+{
+    const SizeType count            = static_cast<SizeType>(std::size(indices_));
+    const SizeType destinationCount = static_cast<SizeType>(std::size(destination_));
+    check_fit(count);
+    check_indices(std::data(indices_), count, destinationCount);
+
+    simd::scatter<ItemCount>(
+      std::data(destination_), destinationCount, m_data, std::data(indices_), count);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Copy the items of the array whose mask is set to the front of `destination_`, in
+ *              order (stream compaction).
+ *
+ * \param       mask_:        Selection flag of each item, from the first item of the array.
+ * \param       destination_: Contiguous range to write the items to, at least as long as
+ *                            `mask_`.
+ *
+ * \retval      SizeType: Number of items copied to `destination_`.
+ *
+ * \throws      std::length_error if the mask is longer than the array or than `destination_` and
+ *              the `BoundsCheck` policy throws.
+ *
+ * \note        Uses the AVX-512 compress instructions when the target has them. Elsewhere, the
+ *              items past the ones returned may be overwritten as well.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_contiguous_range<bool> MaskType, array_output_range<ItemType> DestinationType>
+constexpr inline typename ARRAY_CLASS_SCOPE__::SizeType
+ARRAY_CLASS_SCOPE__::compress(const MaskType& mask_, DestinationType&& destination_) const
+{
+    const SizeType count = static_cast<SizeType>(std::size(mask_));
+    check_fit(count);
+    BoundsCheck::template check<std::length_error>(count <= std::size(destination_),
+                                                   "Compressed items couldn't fit in destination");
+
+    return simd::compress<ItemCount>(std::data(destination_), m_data, std::data(mask_), count);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign the first items of `source_`, in order, to the items of the array whose mask
+ *              is set (stream expansion).
+ *
+ * \param       mask_:   Selection flag of each item, from the first item of the array.
+ * \param       source_: Contiguous range to read the items from, with an item for each set flag.
+ *
+ * \retval      SizeType: Number of items read from `source_`.
+ *
+ * \throws      std::length_error if the mask is longer than the array, or has more flags set than
+ *              `source_` has items, and the `BoundsCheck` policy throws.
+ *
+ * \note        Uses the AVX-512 expand instructions when the target has them.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_contiguous_range<bool> MaskType, array_contiguous_range<ItemType> SourceType>
+constexpr inline typename ARRAY_CLASS_SCOPE__::SizeType
+ARRAY_CLASS_SCOPE__::expand(const MaskType& mask_, const SourceType& source_)
+{
+    const SizeType count = static_cast<SizeType>(std::size(mask_));
+    check_fit(count);
+    BoundsCheck::template check<std::length_error>(
+      static_cast<SizeType>(std::count(std::data(mask_), std::data(mask_) + count, true))
+        <= std::size(source_),
+      "Source is missing items to expand");
+
+    return simd::expand<ItemCount>(m_data, std::data(source_), std::data(mask_), count);
+}
+
+
+/*************************************************************************************************/
+/* VIEWS --------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over the whole array.
+ *
+ * \retval      array_view<ItemType, ItemCount, BoundsCheck>: Non-owning view of the items.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline array_view<ItemType, ItemCount, BoundsCheck>
+ARRAY_CLASS_SCOPE__::view() noexcept
+{
+    return array_view<ItemType, ItemCount, BoundsCheck>{m_data, m_size};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline array_view<const ItemType, ItemCount, BoundsCheck>
+ARRAY_CLASS_SCOPE__::view() const noexcept
+{
+    return array_view<const ItemType, ItemCount, BoundsCheck>{m_data, m_size};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `Count` items starting at `Offset`, both known at compile-time.
+ *
+ * \tparam      Offset: Index of the first item of the view.
+ * \tparam      Count:  Number of items in the view.
+ *              [defaults : every item from `Offset` to the end of the array]
+ *
+ * \retval      array_view<ItemType, Count, BoundsCheck>: Non-owning view of the items.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Offset, std::size_t Count>
+[[nodiscard]] constexpr inline array_view<ItemType, Count, BoundsCheck>
+ARRAY_CLASS_SCOPE__::subarray() noexcept
+{
+    static_assert(Offset <= ItemCount && Count <= ItemCount - Offset,
+                  "A subarray must fit in its array");
+
+    return array_view<ItemType, Count, BoundsCheck>{m_data + Offset, Count};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Offset, std::size_t Count>
+[[nodiscard]] constexpr inline array_view<const ItemType, Count, BoundsCheck>
+ARRAY_CLASS_SCOPE__::subarray() const noexcept
+{
+    static_assert(Offset <= ItemCount && Count <= ItemCount - Offset,
+                  "A subarray must fit in its array");
+
+    return array_view<const ItemType, Count, BoundsCheck>{m_data + Offset, Count};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `count_` items starting at `offset_`, checked according to the
+ *              `BoundsCheck` policy.
+ *
+ * \param       offset_: Index of the first item of the view.
+ * \param       count_:  Number of items in the view.
+ *
+ * \retval      ViewType: Non-owning view of the items.
+ *
+ * \throws      std::out_of_range if the slice doesn't fit in the array and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ViewType
+ARRAY_CLASS_SCOPE__::slice(SizeType offset_, SizeType count_)
+{
+    BoundsCheck::template check<std::out_of_range>(
+      (offset_ <= m_size) && (count_ <= m_size - offset_), "Slice out of array bounds");
+
+    return ViewType{m_data + offset_, count_};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::ConstViewType
+ARRAY_CLASS_SCOPE__::slice(SizeType offset_, SizeType count_) const
+{
+    BoundsCheck::template check<std::out_of_range>(
+      (offset_ <= m_size) && (count_ <= m_size - offset_), "Slice out of array bounds");
+
+    return ConstViewType{m_data + offset_, count_};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `Count` items, known at compile-time, starting at `offset_`.
+ *              The view can be used in array expressions and reductions, like a `pel::array`.
+ *
+ * \tparam      Count:   Number of items in the view.
+ * \param       offset_: Index of the first item of the view.
+ *
+ * \retval      array_view<ItemType, Count, BoundsCheck>: Non-owning view of the items.
+ *
+ * \throws      std::out_of_range if the slice doesn't fit in the array and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Count>
+[[nodiscard]] constexpr inline array_view<ItemType, Count, BoundsCheck>
+ARRAY_CLASS_SCOPE__::slice(SizeType offset_)
+{
+    static_assert(Count <= ItemCount, "A slice must fit in its array");
+    BoundsCheck::template check<std::out_of_range>(offset_ <= m_size - Count,
+                                                   "Slice out of array bounds");
+
+    return array_view<ItemType, Count, BoundsCheck>{m_data + offset_, Count};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Count>
+[[nodiscard]] constexpr inline array_view<const ItemType, Count, BoundsCheck>
+ARRAY_CLASS_SCOPE__::slice(SizeType offset_) const
+{
+    static_assert(Count <= ItemCount, "A slice must fit in its array");
+    BoundsCheck::template check<std::out_of_range>(offset_ <= m_size - Count,
+                                                   "Slice out of array bounds");
+
+    return array_view<const ItemType, Count, BoundsCheck>{m_data + offset_, Count};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over every `step_`-th item, starting at `offset_`, ie one channel of
+ *              interleaved data.
+ *
+ * \param       step_:   Distance between two items of the view, greater than 0.
+ * \param       offset_: Index of the first item of the view.
+ *              [defaults : 0]
+ *
+ * \retval      strided_view<ItemType, BoundsCheck>: Non-owning view of the items.
+ *
+ * \throws      std::out_of_range if `offset_` is past the end of the array or `step_` is 0,
+ *              and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline strided_view<ItemType, BoundsCheck>
+ARRAY_CLASS_SCOPE__::strided(SizeType step_, SizeType offset_)
+{
+    BoundsCheck::template check<std::out_of_range>((step_ > 0) && (offset_ <= m_size),
+                                                   "Strided view out of array bounds");
+
+    const SizeType count = (offset_ < m_size) ? ((m_size - offset_ - 1) / step_) + 1 : 0;
+    return strided_view<ItemType, BoundsCheck>{m_data + offset_, count, step_};
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline strided_view<const ItemType, BoundsCheck>
+ARRAY_CLASS_SCOPE__::strided(SizeType step_, SizeType offset_) const
+{
+    BoundsCheck::template check<std::out_of_range>((step_ > 0) && (offset_ <= m_size),
+                                                   "Strided view out of array bounds");
+
+    const SizeType count = (offset_ < m_size) ? ((m_size - offset_ - 1) / step_) + 1 : 0;
+    return strided_view<const ItemType, BoundsCheck>{m_data + offset_, count, step_};
+}
+
+
+/*************************************************************************************************/
+/* SIZE ---------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of elements in the array.
+ *
+ * \retval      SizeType: `ItemCount`, known at compile-time.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::SizeType
+ARRAY_CLASS_SCOPE__::length() noexcept
+{
+    return m_size;
+}
+
+template<ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_CLASS_SCOPE__::SizeType
+ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return m_size;
+}
+
+
+/*************************************************************************************************/
 /* MISC ---------------------------------------------------------------------------------------- */
 /*************************************************************************************************/
 
@@ -405,9 +1102,7 @@ template<ARRAY_TEMPLATE_DECLARATION__>
 [[nodiscard]] constexpr inline std::string
 ARRAY_CLASS_SCOPE__::to_string() const
 {
-    std::ostringstream os;
-    os << *this;
-    return os.str();
+    return shared::format_items(m_data, m_size);
 }
 
 
@@ -421,26 +1116,239 @@ ARRAY_CLASS_SCOPE__::to_string() const
  *              If it is not currently big enough, reserve some memory.
  *
  * \param       extraLength_: Numbers of elements to add to the current length.
+ *
+ * \throws      std::length_error if the data doesn't fit and the `BoundsCheck` policy throws.
  *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr inline void
 ARRAY_CLASS_SCOPE__::check_fit(SizeType size_) const
 {
-    if constexpr(array_safeness == true)
+    if(size_ > m_size)
+    {
+        instrumentation::record<array>(instrumentation::event::check_failure, 1);
+    }
+    BoundsCheck::template check<std::length_error>(size_ <= m_size, "Data couldn't fit in array");
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Check that every index is below `limit_`, with a single check for all of them.
+ *
+ * \param       indices_: Pointer to the first index.
+ * \param       count_:   Number of indices.
+ * \param       limit_:   Number of items the indices refer to.
+ *
+ * \throws      std::out_of_range if an index is negative or not below `limit_`, and the
+ *              `BoundsCheck` policy throws.
+ *
+ * \note        The indices are compared independently of each other, so that the loop vectorizes
+ *              without a dependency chain.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<typename IndexType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::check_indices(const IndexType* indices_,
+                                   SizeType         count_,
+                                   SizeType         limit_) const
+{
+    using UnsignedIndexType = std::make_unsigned_t<IndexType>;
+
+    /* Negative indices wrap around past the largest signed index, which bounds `last` */
+    const UnsignedIndexType last = static_cast<UnsignedIndexType>(
+      std::min<SizeType>(limit_ - 1, std::numeric_limits<IndexType>::max()));
+
+    /* Accumulated as a lane mask rather than a `bool`, which the compiler doesn't vectorize */
+    constexpr UnsignedIndexType outOfRangeMask = std::numeric_limits<UnsignedIndexType>::max();
+    UnsignedIndexType           outOfRange     = 0;
+    for(SizeType i = 0; i < count_; ++i)
+    {
+        const bool indexOutOfRange = std::bit_cast<UnsignedIndexType>(indices_[i]) > last;
+        outOfRange |= indexOutOfRange ? outOfRangeMask : UnsignedIndexType{0};
+    }
+    BoundsCheck::template check<std::out_of_range>(
+      (count_ == 0) || ((limit_ != 0) && (outOfRange == 0)), "Index out of range");
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Copy `count_` items from `source_` to the beginning of the array.
+ *              Trivially copyable items are copied with a single `memcpy`.
+ *
+ * \param       source_: Pointer to the first item to copy.
+ * \param       count_:  Number of items to copy.
+ *
+ * \note        The caller is responsible for checking that `count_` items fit in the array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::copy_items(const ItemType* source_, SizeType count_)
+{
+    instrumentation::record<array>(
+      instrumentation::event::copy, count_, count_ * sizeof(ItemType));
+
+    if constexpr(std::is_trivially_copyable_v<ItemType>)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            std::memcpy(m_data, source_, count_ * sizeof(ItemType));
+            return;
+        }
+    }
+
+    shared::copy_items(m_data, source_, count_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Move `count_` items from `source_` to the beginning of the array.
+ *              Trivially copyable items are copied with a single `memcpy`.
+ *
+ * \param       source_: Pointer to the first item to move.
+ * \param       count_:  Number of items to move.
+ *
+ * \note        The caller is responsible for checking that `count_` items fit in the array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::move_items(ItemType* source_, SizeType count_)
+{
+    instrumentation::record<array>(
+      instrumentation::event::move, count_, count_ * sizeof(ItemType));
+
+    if constexpr(std::is_trivially_copyable_v<ItemType>)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            std::memcpy(m_data, source_, count_ * sizeof(ItemType));
+            return;
+        }
+    }
+
+    shared::move_items(m_data, source_, count_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Copy-assign `count_` items from `source_` to the items of the array from `offset_`.
+ *              Trivially copyable items are copied with a single `memmove`.
+ *
+ * \param       source_: Pointer to the first item to copy, which may be an item of the array.
+ * \param       count_:  Number of items to copy.
+ * \param       offset_: Index of the first item to assign.
+ *
+ * \note        The caller is responsible for checking that the items fit in the array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::assign_items(const ItemType* source_, SizeType count_, SizeType offset_)
+{
+    instrumentation::record<array>(
+      instrumentation::event::copy, count_, count_ * sizeof(ItemType));
+
+    if constexpr(std::is_trivially_copyable_v<ItemType>)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            std::memmove(m_data + offset_, source_, count_ * sizeof(ItemType));
+            return;
+        }
+    }
+
+    shared::copy_items(m_data + offset_, source_, count_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Build the items of a new array, the first `count_` from the results of `producer_`.
+ *
+ * \param       count_:    Number of items to build from `producer_`.
+ * \param       producer_: Callable taking the index of an item and returning its value, or a
+ *                         reference to the value to copy or move.
+ *
+ * \note        In uninitialized storage, each item is constructed exactly once, directly from the
+ *              result of `producer_`, and the items after `count_` are value-initialized. The items
+ *              already built are destroyed if a construction throws.
+ *              Items without a default constructor must all come from `producer_`.
+ *              Trivially default constructible items are assigned instead, and the items after
+ *              `count_` are left default-initialized.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<typename ProducerType>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::construct_items(SizeType count_, ProducerType&& producer_)
+{
+    instrumentation::record<array>(instrumentation::event::construction, m_size);
+
+    if constexpr(!uninitialized_storage)
     {
-        if(size_ > m_size)
+        for(SizeType i = 0; i < count_; ++i)
         {
-            throw(std::length_error("Data couldn't fit in array"));
+            m_data[i] = producer_(i);
         }
     }
+    else
+    {
+        shared::construct_items(
+          m_data, m_size, count_, std::forward<ProducerType>(producer_));
+    }
 }
 
+/**
+ **************************************************************************************************
+ * \brief       Build the items of a new array, the first `count_` copied from `source_`.
+ *
+ * \param       source_: Pointer to the first item to copy.
+ * \param       count_:  Number of items to copy.
+ *
+ * \note        The caller is responsible for checking that `count_` items fit in the array.
+ *************************************************************************************************/
 template<ARRAY_TEMPLATE_DECLARATION__>
 constexpr inline void
-ARRAY_CLASS_SCOPE__::array_constructor()
+ARRAY_CLASS_SCOPE__::construct_copies(const ItemType* source_, SizeType count_)
 {
-    m_beginIterator.ptr() = &m_data[0];
-    m_endIterator.ptr()   = m_data + m_size;
+    if constexpr(uninitialized_storage)
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        instrumentation::record<array>(
+          instrumentation::event::copy, count_, count_ * sizeof(ItemType));
+        shared::construct_copies(m_data, m_size, source_, count_);
+    }
+    else
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        copy_items(source_, count_);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build the items of a new array, the first `count_` moved from `source_`.
+ *
+ * \param       source_: Pointer to the first item to move.
+ * \param       count_:  Number of items to move.
+ *
+ * \note        The caller is responsible for checking that `count_` items fit in the array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+ARRAY_CLASS_SCOPE__::construct_moves(ItemType* source_, SizeType count_)
+{
+    if constexpr(uninitialized_storage)
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        instrumentation::record<array>(
+          instrumentation::event::move, count_, count_ * sizeof(ItemType));
+        shared::construct_moves(m_data, m_size, source_, count_);
+    }
+    else
+    {
+        instrumentation::record<array>(instrumentation::event::construction, m_size);
+        move_items(source_, count_);
+    }
 }
 
 
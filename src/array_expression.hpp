@@ -0,0 +1,430 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array_policy.hpp"
+#include "./simd.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Expression base & traits -------------------------------------------------------------------- */
+
+/* Where an expression reads the items of a range it is evaluated into, relative to the index each
+ * item is written at */
+enum class array_overlap : unsigned char
+{
+    none   = 0,
+    ahead  = 1, /* Reads items after their own index, ie `items.slice<7>(0) = items.slice<7>(1)` */
+    behind = 2, /* Reads items before their own index, ie `items.slice<7>(1) = items.slice<7>(0)` */
+    both   = 3,
+};
+
+[[nodiscard]] constexpr array_overlap
+operator|(array_overlap lhs_, array_overlap rhs_) noexcept
+{
+    return static_cast<array_overlap>(static_cast<unsigned char>(lhs_)
+                                      | static_cast<unsigned char>(rhs_));
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Base class of every lazy element-wise expression over `pel::array`s.
+ *
+ * \note        Every expression type exposes:
+ *              - `ResultType`:  Type of an element of the expression's result.
+ *              - `OperandType`: Type of the elements the expression operates on.
+ *              - `count`:       Number of elements in the expression, known at compile-time.
+ *              - `value(i)`:    Element `i` of the result, computed on its own.
+ *              - `load(i)`:     Elements `[i, i + simd::lanes<OperandType>)` as a single pack.
+ *              - `overlap(b, e)`: Whether it reads items of `[b, e)` at other indexes than their
+ *                                 own, which evaluating into `[b, e)` could overwrite first.
+ *
+ * \note        Expressions keep pointers to the arrays they were built from, and must therefore
+ *              be evaluated before those arrays are destroyed.
+ *************************************************************************************************/
+template<typename Derived>
+class array_expression
+{
+public:
+    [[nodiscard]] constexpr const Derived& self() const noexcept
+    {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+template<typename Type>
+concept array_expression_type = std::is_base_of_v<array_expression<Type>, Type>;
+
+template<typename Type>
+constexpr bool is_array = false;
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+constexpr bool is_array<array<ItemType, ItemCount, BoundsCheck>> = true;
+
+template<typename Type>
+concept array_operand_type = is_array<Type> || array_expression_type<Type>;
+
+
+/*************************************************************************************************/
+/* Terminals ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Expression reading the elements of an existing array.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount>
+class array_reference_expression
+: public array_expression<array_reference_expression<ItemType, ItemCount>>
+{
+public:
+    using ResultType  = ItemType;
+    using OperandType = ItemType;
+
+    static constexpr std::size_t count = ItemCount;
+
+    constexpr explicit array_reference_expression(const ItemType* data_) noexcept : m_data{data_}
+    {
+    }
+
+    [[nodiscard]] constexpr ItemType value(std::size_t index_) const noexcept
+    {
+        return m_data[index_];
+    }
+    [[nodiscard]] simd::pack<ItemType> load(std::size_t index_) const noexcept
+    {
+        return simd::load(m_data + index_);
+    }
+    [[nodiscard]] array_overlap overlap(const void* begin_, const void* end_) const noexcept
+    {
+        /* Items read at their own index, ie `a = a * 2`, are read before being written */
+        const std::less<const void*> less;
+        if((begin_ == m_data) || !less(m_data, end_) || !less(begin_, m_data + ItemCount))
+        {
+            return array_overlap::none;
+        }
+        return less(begin_, m_data) ? array_overlap::ahead : array_overlap::behind;
+    }
+
+private:
+    const ItemType* m_data;
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Expression broadcasting a single value to every element.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount>
+class scalar_expression : public array_expression<scalar_expression<ItemType, ItemCount>>
+{
+public:
+    using ResultType  = ItemType;
+    using OperandType = ItemType;
+
+    static constexpr std::size_t count = ItemCount;
+
+    constexpr explicit scalar_expression(const ItemType& value_) noexcept : m_value{value_}
+    {
+    }
+
+    [[nodiscard]] constexpr ItemType value(std::size_t /* index_ */) const noexcept
+    {
+        return m_value;
+    }
+    [[nodiscard]] simd::pack<ItemType> load(std::size_t /* index_ */) const noexcept
+    {
+        return simd::broadcast(m_value);
+    }
+    [[nodiscard]] array_overlap overlap(const void* /* begin_ */,
+                                        const void* /* end_ */) const noexcept
+    {
+        return array_overlap::none;
+    }
+
+private:
+    ItemType m_value;
+};
+
+
+/*************************************************************************************************/
+/* Operations ---------------------------------------------------------------------------------- */
+
+/* Operations apply equally to single items and to packs of items. Arithmetic on small integer
+ * items promotes to `int`, and is narrowed back to the item type. */
+namespace operation
+{
+template<typename ItemType, typename ValueType>
+[[nodiscard]] constexpr ItemType
+keep_type(const ValueType& value_) noexcept
+{
+    if constexpr(std::is_same_v<ItemType, ValueType>)
+    {
+        return value_;
+    }
+    else
+    {
+        return static_cast<ItemType>(value_);
+    }
+}
+
+#define PEL_ARRAY_ARITHMETIC_OPERATION__(name_, operator_)                                         \
+    struct name_                                                                                   \
+    {                                                                                              \
+        template<typename ItemType>                                                                \
+        [[nodiscard]] static constexpr ItemType apply(const ItemType& lhs_,                        \
+                                                      const ItemType& rhs_) noexcept               \
+        {                                                                                          \
+            return keep_type<ItemType>(lhs_ operator_ rhs_);                                       \
+        }                                                                                          \
+    }
+
+#define PEL_ARRAY_COMPARISON_OPERATION__(name_, operator_)                                         \
+    struct name_                                                                                   \
+    {                                                                                              \
+        template<typename ItemType>                                                                \
+        [[nodiscard]] static constexpr auto apply(const ItemType& lhs_,                            \
+                                                  const ItemType& rhs_) noexcept                   \
+        {                                                                                          \
+            return lhs_ operator_ rhs_;                                                            \
+        }                                                                                          \
+    }
+
+PEL_ARRAY_ARITHMETIC_OPERATION__(add, +);
+PEL_ARRAY_ARITHMETIC_OPERATION__(subtract, -);
+PEL_ARRAY_ARITHMETIC_OPERATION__(multiply, *);
+PEL_ARRAY_ARITHMETIC_OPERATION__(divide, /);
+
+PEL_ARRAY_COMPARISON_OPERATION__(equal, ==);
+PEL_ARRAY_COMPARISON_OPERATION__(not_equal, !=);
+PEL_ARRAY_COMPARISON_OPERATION__(less, <);
+PEL_ARRAY_COMPARISON_OPERATION__(less_equal, <=);
+PEL_ARRAY_COMPARISON_OPERATION__(greater, >);
+PEL_ARRAY_COMPARISON_OPERATION__(greater_equal, >=);
+
+#undef PEL_ARRAY_ARITHMETIC_OPERATION__
+#undef PEL_ARRAY_COMPARISON_OPERATION__
+}        // namespace operation
+
+
+/*************************************************************************************************/
+/* Compound expressions ------------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise arithmetic between two expressions.
+ *************************************************************************************************/
+template<typename Operation, typename LhsType, typename RhsType>
+class binary_expression : public array_expression<binary_expression<Operation, LhsType, RhsType>>
+{
+    static_assert(std::is_same_v<typename LhsType::OperandType, typename RhsType::OperandType>,
+                  "Both sides of an array expression must have the same item type");
+    static_assert(LhsType::count == RhsType::count,
+                  "Both sides of an array expression must have the same length");
+    static_assert(std::is_same_v<typename LhsType::ResultType, typename LhsType::OperandType>
+                    && std::is_same_v<typename RhsType::ResultType, typename RhsType::OperandType>,
+                  "Comparison results can only be used through pel::select");
+
+public:
+    using ResultType  = typename LhsType::OperandType;
+    using OperandType = typename LhsType::OperandType;
+
+    static constexpr std::size_t count = LhsType::count;
+
+    constexpr binary_expression(const LhsType& lhs_, const RhsType& rhs_) noexcept
+    : m_lhs{lhs_}, m_rhs{rhs_}
+    {
+    }
+
+    [[nodiscard]] constexpr ResultType value(std::size_t index_) const noexcept
+    {
+        return Operation::apply(m_lhs.value(index_), m_rhs.value(index_));
+    }
+    [[nodiscard]] simd::pack<OperandType> load(std::size_t index_) const noexcept
+    {
+        return Operation::apply(m_lhs.load(index_), m_rhs.load(index_));
+    }
+    [[nodiscard]] array_overlap overlap(const void* begin_, const void* end_) const noexcept
+    {
+        return m_lhs.overlap(begin_, end_) | m_rhs.overlap(begin_, end_);
+    }
+
+private:
+    LhsType m_lhs;
+    RhsType m_rhs;
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise comparison between two expressions, resulting in a mask.
+ *************************************************************************************************/
+template<typename Operation, typename LhsType, typename RhsType>
+class compare_expression : public array_expression<compare_expression<Operation, LhsType, RhsType>>
+{
+    static_assert(std::is_same_v<typename LhsType::OperandType, typename RhsType::OperandType>,
+                  "Both sides of an array comparison must have the same item type");
+    static_assert(LhsType::count == RhsType::count,
+                  "Both sides of an array comparison must have the same length");
+
+public:
+    using ResultType  = bool;
+    using OperandType = typename LhsType::OperandType;
+
+    static constexpr std::size_t count = LhsType::count;
+
+    constexpr compare_expression(const LhsType& lhs_, const RhsType& rhs_) noexcept
+    : m_lhs{lhs_}, m_rhs{rhs_}
+    {
+    }
+
+    [[nodiscard]] constexpr bool value(std::size_t index_) const noexcept
+    {
+        return Operation::apply(m_lhs.value(index_), m_rhs.value(index_));
+    }
+    [[nodiscard]] simd::mask<OperandType> load(std::size_t index_) const noexcept
+    {
+        return Operation::apply(m_lhs.load(index_), m_rhs.load(index_));
+    }
+    [[nodiscard]] array_overlap overlap(const void* begin_, const void* end_) const noexcept
+    {
+        return m_lhs.overlap(begin_, end_) | m_rhs.overlap(begin_, end_);
+    }
+
+private:
+    LhsType m_lhs;
+    RhsType m_rhs;
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise selection between two expressions, driven by a comparison mask.
+ *************************************************************************************************/
+template<typename MaskType, typename TrueType, typename FalseType>
+class select_expression : public array_expression<select_expression<MaskType, TrueType, FalseType>>
+{
+    static_assert(std::is_same_v<typename MaskType::ResultType, bool>,
+                  "The first argument of pel::select must be a comparison");
+    static_assert(std::is_same_v<typename MaskType::OperandType, typename TrueType::OperandType>
+                    && std::is_same_v<typename TrueType::OperandType,
+                                      typename FalseType::OperandType>,
+                  "pel::select requires the same item type for the mask and both choices");
+    static_assert((MaskType::count == TrueType::count) && (TrueType::count == FalseType::count),
+                  "pel::select requires the same length for the mask and both choices");
+
+public:
+    using ResultType  = typename TrueType::OperandType;
+    using OperandType = typename TrueType::OperandType;
+
+    static constexpr std::size_t count = MaskType::count;
+
+    constexpr select_expression(const MaskType&  mask_,
+                                const TrueType&  ifTrue_,
+                                const FalseType& ifFalse_) noexcept
+    : m_mask{mask_}, m_ifTrue{ifTrue_}, m_ifFalse{ifFalse_}
+    {
+    }
+
+    [[nodiscard]] constexpr ResultType value(std::size_t index_) const noexcept
+    {
+        return m_mask.value(index_) ? m_ifTrue.value(index_) : m_ifFalse.value(index_);
+    }
+    [[nodiscard]] simd::pack<OperandType> load(std::size_t index_) const noexcept
+    {
+        return simd::blend<OperandType>(
+          m_mask.load(index_), m_ifTrue.load(index_), m_ifFalse.load(index_));
+    }
+    [[nodiscard]] array_overlap overlap(const void* begin_, const void* end_) const noexcept
+    {
+        return m_mask.overlap(begin_, end_) | m_ifTrue.overlap(begin_, end_)
+               | m_ifFalse.overlap(begin_, end_);
+    }
+
+private:
+    MaskType  m_mask;
+    TrueType  m_ifTrue;
+    FalseType m_ifFalse;
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise multiply-add `a * b + c`.
+ *
+ * \note        The product and the sum are written as a single expression in both the scalar and
+ *              the pack paths, so the compiler contracts them to FMA instructions when the target
+ *              supports them (ie `-mfma`) and floating-point contraction is enabled.
+ *************************************************************************************************/
+template<typename AType, typename BType, typename CType>
+class fma_expression : public array_expression<fma_expression<AType, BType, CType>>
+{
+    static_assert(std::is_same_v<typename AType::OperandType, typename BType::OperandType>
+                    && std::is_same_v<typename BType::OperandType, typename CType::OperandType>,
+                  "pel::fma requires the same item type for all its arguments");
+    static_assert((AType::count == BType::count) && (BType::count == CType::count),
+                  "pel::fma requires the same length for all its arguments");
+
+public:
+    using ResultType  = typename AType::OperandType;
+    using OperandType = typename AType::OperandType;
+
+    static constexpr std::size_t count = AType::count;
+
+    constexpr fma_expression(const AType& a_, const BType& b_, const CType& c_) noexcept
+    : m_a{a_}, m_b{b_}, m_c{c_}
+    {
+    }
+
+    [[nodiscard]] constexpr ResultType value(std::size_t index_) const noexcept
+    {
+        return operation::keep_type<ResultType>(m_a.value(index_) * m_b.value(index_)
+                                                + m_c.value(index_));
+    }
+    [[nodiscard]] simd::pack<OperandType> load(std::size_t index_) const noexcept
+    {
+        return m_a.load(index_) * m_b.load(index_) + m_c.load(index_);
+    }
+    [[nodiscard]] array_overlap overlap(const void* begin_, const void* end_) const noexcept
+    {
+        return m_a.overlap(begin_, end_) | m_b.overlap(begin_, end_) | m_c.overlap(begin_, end_);
+    }
+
+private:
+    AType m_a;
+    BType m_b;
+    CType m_c;
+};
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,505 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array.hpp"
+#include "./array_expression.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define ARRAY_TEMPLATE_DECLARATION__ typename ItemType, std::size_t ItemCount, typename BoundsCheck
+#define ARRAY_CLASS_SCOPE__          array<ItemType, ItemCount, BoundsCheck>
+
+/* Expressions with at most this many packs are evaluated in a fully unrolled sequence */
+constexpr std::size_t array_expression_max_unrolled_packs = 16;
+
+/* Expressions reading their destination both before and after each index are evaluated into a
+ * temporary array on the stack up to this size, and into a heap buffer above it */
+constexpr std::size_t array_expression_max_stack_bytes = 4096;
+
+
+/*************************************************************************************************/
+/* OPERAND CONVERSION -------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Item type and length of an array operand (an array or an expression).
+ *************************************************************************************************/
+template<typename OperandType>
+struct array_operand_traits
+{
+    using ValueType = typename OperandType::OperandType;
+
+    static constexpr std::size_t count = OperandType::count;
+};
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+struct array_operand_traits<array<ItemType, ItemCount, BoundsCheck>>
+{
+    using ValueType = ItemType;
+
+    static constexpr std::size_t count = ItemCount;
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Wrap an operand into an expression.
+ *              Arrays are referenced, expressions are kept as-is and scalars are broadcasted to
+ *              the item type and length `ItemType`, `ItemCount`.
+ *
+ * \param       operand_: Array, expression or scalar to wrap.
+ *
+ * \retval      An expression object.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename OperandType>
+[[nodiscard]] constexpr auto
+as_expression(const OperandType& operand_) noexcept
+{
+    if constexpr(array_expression_type<OperandType>)
+    {
+        return operand_;
+    }
+    else if constexpr(is_array<OperandType>)
+    {
+        return array_reference_expression<typename array_operand_traits<OperandType>::ValueType,
+                                          array_operand_traits<OperandType>::count>{
+          operand_.data()};
+    }
+    else
+    {
+        return scalar_expression<ItemType, ItemCount>{static_cast<ItemType>(operand_)};
+    }
+}
+
+template<typename ScalarType, typename ItemType>
+concept array_scalar_type =
+  std::is_arithmetic_v<ScalarType>
+  && !(std::is_floating_point_v<ScalarType> && std::is_integral_v<ItemType>);
+
+template<typename OperandType, typename ItemType>
+concept array_operand_or_scalar_type =
+  array_operand_type<OperandType> || array_scalar_type<OperandType, ItemType>;
+
+/* At least one of the operands must be an array or an expression, the other may be a scalar */
+template<typename LhsType, typename RhsType>
+concept array_operands_type =
+  (array_operand_type<LhsType>
+   && array_operand_or_scalar_type<RhsType, typename array_operand_traits<LhsType>::ValueType>)
+  || (array_operand_type<RhsType>
+      && array_scalar_type<LhsType, typename array_operand_traits<RhsType>::ValueType>);
+
+template<typename LhsType, typename RhsType>
+using array_operands_traits =
+  array_operand_traits<std::conditional_t<array_operand_type<LhsType>, LhsType, RhsType>>;
+
+
+/**
+ **************************************************************************************************
+ * \brief       Build an expression object applying `Operation` between two operands.
+ *
+ * \tparam      ExpressionTemplate: Kind of expression to build (arithmetic or comparison).
+ * \tparam      Operation:          Operation applied element-wise.
+ *
+ * \param       lhs_: Left-hand-side operand.
+ * \param       rhs_: Right-hand-side operand.
+ *************************************************************************************************/
+template<template<typename, typename, typename> typename ExpressionTemplate,
+         typename Operation,
+         typename LhsType,
+         typename RhsType>
+[[nodiscard]] constexpr auto
+make_expression(const LhsType& lhs_, const RhsType& rhs_) noexcept
+{
+    using Traits = array_operands_traits<LhsType, RhsType>;
+
+    auto lhs = as_expression<typename Traits::ValueType, Traits::count>(lhs_);
+    auto rhs = as_expression<typename Traits::ValueType, Traits::count>(rhs_);
+
+    return ExpressionTemplate<Operation, decltype(lhs), decltype(rhs)>{lhs, rhs};
+}
+
+
+/*************************************************************************************************/
+/* OPERATORS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise arithmetic and comparison operators between arrays, expressions and
+ *              scalars.
+ *
+ * \param       lhs_: Left-hand-side operand.
+ * \param       rhs_: Right-hand-side operand.
+ *
+ * \retval      A lazy expression, evaluated when assigned to a `pel::array`.
+ *
+ * \note        Like `std::valarray`, comparison operators compare element by element and result
+ *              in a mask, which can be assigned to a `pel::array<bool, N>` or fed to
+ *              `pel::select`.
+ *
+ * \note        Scalars are converted to the item type of the array operand, ie `floats * 0.5`
+ *              multiplies by `0.5f` and `bytes + 300` adds `std::uint8_t(300)`. Floating-point
+ *              scalars are rejected for integer items, rather than dropping their fractional part.
+ *************************************************************************************************/
+#define PEL_ARRAY_EXPRESSION_OPERATOR__(operator_, expression_, operation_)                        \
+    template<typename LhsType, typename RhsType>                                                   \
+    requires array_operands_type<LhsType, RhsType>                                                 \
+    [[nodiscard]] constexpr auto operator operator_(const LhsType& lhs_,                           \
+                                                    const RhsType& rhs_) noexcept                  \
+    {                                                                                              \
+        return make_expression<expression_, operation::operation_>(lhs_, rhs_);                    \
+    }
+
+PEL_ARRAY_EXPRESSION_OPERATOR__(+, binary_expression, add)
+PEL_ARRAY_EXPRESSION_OPERATOR__(-, binary_expression, subtract)
+PEL_ARRAY_EXPRESSION_OPERATOR__(*, binary_expression, multiply)
+PEL_ARRAY_EXPRESSION_OPERATOR__(/, binary_expression, divide)
+
+PEL_ARRAY_EXPRESSION_OPERATOR__(==, compare_expression, equal)
+PEL_ARRAY_EXPRESSION_OPERATOR__(!=, compare_expression, not_equal)
+PEL_ARRAY_EXPRESSION_OPERATOR__(<, compare_expression, less)
+PEL_ARRAY_EXPRESSION_OPERATOR__(<=, compare_expression, less_equal)
+PEL_ARRAY_EXPRESSION_OPERATOR__(>, compare_expression, greater)
+PEL_ARRAY_EXPRESSION_OPERATOR__(>=, compare_expression, greater_equal)
+
+#undef PEL_ARRAY_EXPRESSION_OPERATOR__
+
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise multiply-add, `a_ * b_ + c_`.
+ *
+ * \param       a_: First factor (array or expression).
+ * \param       b_: Second factor (array, expression or scalar).
+ * \param       c_: Term added to the product (array, expression or scalar).
+ *
+ * \retval      A lazy expression, evaluated when assigned to a `pel::array`.
+ *
+ * \note        Scalars are converted to the item type of `a_`, like for the operators.
+ *************************************************************************************************/
+template<array_operand_type AType, typename BType, typename CType>
+requires array_operand_or_scalar_type<BType, typename array_operand_traits<AType>::ValueType>
+         && array_operand_or_scalar_type<CType, typename array_operand_traits<AType>::ValueType>
+[[nodiscard]] constexpr auto
+fma(const AType& a_, const BType& b_, const CType& c_) noexcept
+{
+    using Traits = array_operand_traits<AType>;
+
+    auto a = as_expression<typename Traits::ValueType, Traits::count>(a_);
+    auto b = as_expression<typename Traits::ValueType, Traits::count>(b_);
+    auto c = as_expression<typename Traits::ValueType, Traits::count>(c_);
+
+    return fma_expression<decltype(a), decltype(b), decltype(c)>{a, b, c};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Element-wise selection (blend): `mask_[i] ? ifTrue_[i] : ifFalse_[i]`.
+ *
+ * \param       mask_:    Comparison expression selecting between both choices.
+ * \param       ifTrue_:  Elements picked where the mask is set (array, expression or scalar).
+ * \param       ifFalse_: Elements picked where the mask is cleared (array, expression or scalar).
+ *
+ * \retval      A lazy expression, evaluated when assigned to a `pel::array`.
+ *
+ * \note        Scalars are converted to the item type of the mask operands, like for the
+ *              operators.
+ *************************************************************************************************/
+template<array_expression_type MaskType, typename TrueType, typename FalseType>
+requires array_operand_or_scalar_type<TrueType, typename MaskType::OperandType>
+         && array_operand_or_scalar_type<FalseType, typename MaskType::OperandType>
+[[nodiscard]] constexpr auto
+select(const MaskType& mask_, const TrueType& ifTrue_, const FalseType& ifFalse_) noexcept
+{
+    using ItemType = typename MaskType::OperandType;
+
+    auto ifTrue  = as_expression<ItemType, MaskType::count>(ifTrue_);
+    auto ifFalse = as_expression<ItemType, MaskType::count>(ifFalse_);
+
+    return select_expression<MaskType, decltype(ifTrue), decltype(ifFalse)>{
+      mask_, ifTrue, ifFalse};
+}
+
+
+/*************************************************************************************************/
+/* EVALUATION ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<typename ItemType, typename ExpressionType, std::size_t... Indexes>
+inline void
+evaluate_packs([[maybe_unused]] ItemType*             destination_,
+               [[maybe_unused]] const ExpressionType& expression_,
+               std::index_sequence<Indexes...> /* indexes_ */) noexcept
+{
+    constexpr std::size_t lanes = simd::lanes<ItemType>;
+    (simd::store(destination_ + (Indexes * lanes), expression_.load(Indexes * lanes)), ...);
+}
+
+template<std::size_t Offset, typename ItemType, typename ExpressionType, std::size_t... Indexes>
+constexpr void
+evaluate_items([[maybe_unused]] ItemType*             destination_,
+               [[maybe_unused]] const ExpressionType& expression_,
+               std::index_sequence<Indexes...> /* indexes_ */) noexcept
+{
+    ((destination_[Offset + Indexes] = expression_.value(Offset + Indexes)), ...);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Evaluate an expression into `ExpressionType::count` contiguous items in a single
+ *              pass.
+ *
+ * \param       destination_: First item receiving the result of the expression.
+ * \param       expression_:  Expression to evaluate.
+ *
+ * \note        The expression is evaluated by `simd::lanes<ItemType>`-wide packs, fully unrolled
+ *              for small arrays, followed by a scalar tail whose length is known at compile-time.
+ *              Constant evaluation, and item types that cannot be vectorized, use a scalar loop.
+ *************************************************************************************************/
+template<typename ItemType, array_expression_type ExpressionType>
+constexpr void
+evaluate(ItemType* destination_, const ExpressionType& expression_) noexcept
+{
+    static_assert(std::is_same_v<typename ExpressionType::ResultType, ItemType>,
+                  "An array expression must be assigned to an array of its result type");
+
+    constexpr std::size_t count = ExpressionType::count;
+    constexpr std::size_t lanes = simd::lanes<ItemType>;
+
+    if constexpr(lanes > 1)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            constexpr std::size_t packCount = count / lanes;
+            constexpr std::size_t tailStart = packCount * lanes;
+
+            if constexpr(packCount <= array_expression_max_unrolled_packs)
+            {
+                evaluate_packs(destination_, expression_, std::make_index_sequence<packCount>{});
+            }
+            else
+            {
+                for(std::size_t i = 0; i < tailStart; i += lanes)
+                {
+                    simd::store(destination_ + i, expression_.load(i));
+                }
+            }
+
+            evaluate_items<tailStart>(
+              destination_, expression_, std::make_index_sequence<count - tailStart>{});
+            return;
+        }
+    }
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        destination_[i] = expression_.value(i);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Evaluate an expression into `ExpressionType::count` contiguous items from the last
+ *              one to the first.
+ *
+ * \param       destination_: First item receiving the result of the expression.
+ * \param       expression_:  Expression to evaluate.
+ *
+ * \note        The scalar tail is evaluated first, followed by the packs in reverse order.
+ *************************************************************************************************/
+template<typename ItemType, array_expression_type ExpressionType>
+inline void
+evaluate_backward(ItemType* destination_, const ExpressionType& expression_) noexcept
+{
+    constexpr std::size_t count = ExpressionType::count;
+    constexpr std::size_t lanes = simd::lanes<ItemType>;
+
+    std::size_t index = count;
+    if constexpr(lanes > 1)
+    {
+        for(; index % lanes != 0; --index)
+        {
+            destination_[index - 1] = expression_.value(index - 1);
+        }
+        for(; index != 0; index -= lanes)
+        {
+            simd::store(destination_ + (index - lanes), expression_.load(index - lanes));
+        }
+    }
+    for(; index != 0; --index)
+    {
+        destination_[index - 1] = expression_.value(index - 1);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Evaluate an expression into `ExpressionType::count` contiguous items that it may
+ *              read at other indexes, ie `items.slice<7>(1) = items.slice<7>(0) + 1`.
+ *
+ * \param       destination_: First item receiving the result of the expression.
+ * \param       expression_:  Expression to evaluate.
+ *
+ * \throws      std::bad_alloc if the expression reads the destination both before and after each
+ *              index, and its temporary buffer can't be allocated.
+ *
+ * \note        Each item of the result only depends on the items read at its own index, so an
+ *              expression reading the destination after each index is evaluated in place from the
+ *              first item, and one reading it before each index from the last item. Only one
+ *              reading it in both directions goes through a temporary buffer, on the stack when
+ *              it holds at most `array_expression_max_stack_bytes`.
+ *
+ * \note        Constant evaluation, which can't compare unrelated pointers, always evaluates into
+ *              the temporary buffer.
+ *************************************************************************************************/
+template<typename ItemType, array_expression_type ExpressionType>
+constexpr void
+evaluate_overlapping(ItemType* destination_, const ExpressionType& expression_) noexcept(
+  ExpressionType::count * sizeof(ItemType) <= array_expression_max_stack_bytes)
+{
+    constexpr std::size_t count = ExpressionType::count;
+    constexpr bool        fitsStack = count * sizeof(ItemType) <= array_expression_max_stack_bytes;
+
+    if(!std::is_constant_evaluated())
+    {
+        switch(expression_.overlap(destination_, destination_ + count))
+        {
+            case array_overlap::none:
+            case array_overlap::ahead:
+                evaluate(destination_, expression_);
+                return;
+            case array_overlap::behind:
+                evaluate_backward(destination_, expression_);
+                return;
+            case array_overlap::both:
+                break;
+        }
+    }
+
+    if constexpr(fitsStack)
+    {
+        array<ItemType, count, bounds_check::unchecked> result{expression_};
+        std::move(result.begin(), result.end(), destination_);
+    }
+    else
+    {
+        std::vector<ItemType> result;
+        result.reserve(count);
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            result.push_back(expression_.value(i));
+        }
+        std::move(result.begin(), result.end(), destination_);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Evaluate an expression into an array in a single pass.
+ *
+ * \param       destination_: Array receiving the result of the expression.
+ * \param       expression_:  Expression to evaluate.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__, array_expression_type ExpressionType>
+constexpr void
+evaluate(ARRAY_CLASS_SCOPE__& destination_, const ExpressionType& expression_) noexcept
+{
+    static_assert(ExpressionType::count == ItemCount,
+                  "An array expression must be assigned to an array of the same length");
+
+    evaluate(destination_.data(), expression_);
+}
+
+
+/*************************************************************************************************/
+/* ARRAY MEMBERS ------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Expression-evaluating constructor for the array class.
+ *
+ * \param       expression_: Element-wise expression to evaluate into the new array.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_expression_type ExpressionType>
+constexpr ARRAY_CLASS_SCOPE__::array(const ExpressionType& expression_)
+{
+    if constexpr(uninitialized_storage)
+    {
+        static_assert(ExpressionType::count == ItemCount,
+                      "An array expression must be assigned to an array of the same length");
+
+        construct_items(m_size,
+                        [&expression_](SizeType index_) { return expression_.value(index_); });
+    }
+    else
+    {
+        evaluate(*this, expression_);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Expression-evaluating assignment operator for the array class.
+ *
+ * \param       expression_: Element-wise expression to evaluate into the array.
+ *
+ * \note        The array may appear in the expression (ie `a = a * 2.0f + b`): each element is
+ *              read before being written.
+ *************************************************************************************************/
+template<ARRAY_TEMPLATE_DECLARATION__>
+template<array_expression_type ExpressionType>
+constexpr inline ARRAY_CLASS_SCOPE__&
+ARRAY_CLASS_SCOPE__::operator=(const ExpressionType& expression_)
+{
+    evaluate(*this, expression_);
+
+    return *this;
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef ARRAY_TEMPLATE_DECLARATION__
+#undef ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,136 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Text formatting ----------------------------------------------------------------------------- */
+
+/* Items that `std::to_chars` can format */
+template<typename ItemType>
+concept array_formattable_type =
+  (std::is_integral_v<ItemType> && !std::is_same_v<ItemType, bool>)
+  || std::is_floating_point_v<ItemType>;
+
+/**
+ **************************************************************************************************
+ * \brief       Layout of the text written by `format_to`.
+ *
+ * \note        With a negative `precision`, floating-point items are written with the shortest
+ *              representation that reads back to the same value, and `floatFormat` is ignored.
+ *************************************************************************************************/
+struct format_options
+{
+    std::string_view  prefix      = "";
+    std::string_view  separator   = ", ";
+    std::string_view  suffix      = "";
+    std::chars_format floatFormat = std::chars_format::general;
+    int               precision   = -1;
+};
+
+template<array_formattable_type ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] std::to_chars_result format_to(char*                                          first_,
+                                             char*                                          last_,
+                                             const array<ItemType, ItemCount, BoundsCheck>& arr_,
+                                             const format_options& options_ = {}) noexcept;
+
+template<array_formattable_type ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] std::string format(const array<ItemType, ItemCount, BoundsCheck>& arr_,
+                                 const format_options&                          options_ = {});
+
+
+/*************************************************************************************************/
+/* Binary serialization ------------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Binary serialization of arrays of trivially copyable items.
+ *
+ * \note        A serialized array is a 16 bytes header followed by the raw bytes of the items:
+ *              | offset | size | content                                                  |
+ *              |      0 |    4 | Magic bytes "PELA"                                       |
+ *              |      4 |    1 | Format version, `serialization_version`                  |
+ *              |      5 |    1 | Byte order of the items: 0 for little-endian, 1 for big  |
+ *              |      6 |    2 | `sizeof(ItemType)`, little-endian                        |
+ *              |      8 |    8 | `ItemCount`, little-endian                               |
+ *              |     16 |    - | The items, as laid out in memory by the writer           |
+ *
+ * \note        Items are written and read with a single bulk copy. Arithmetic items written on a
+ *              machine of the other byte order are swapped after the copy; other item types can
+ *              only be read on a machine of the writer's byte order.
+ *************************************************************************************************/
+constexpr std::uint8_t serialization_version      = 1;
+constexpr std::size_t  serialization_header_bytes = 16;
+
+/* Same as `std::to_chars_result` and `std::from_chars_result`, over bytes */
+struct serialize_result
+{
+    std::byte* ptr;
+    std::errc  ec;
+};
+
+struct deserialize_result
+{
+    const std::byte* ptr;
+    std::errc        ec;
+};
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] constexpr std::size_t
+serialized_size(const array<ItemType, ItemCount, BoundsCheck>& arr_) noexcept;
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+requires std::is_trivially_copyable_v<ItemType>
+[[nodiscard]] serialize_result
+serialize(const array<ItemType, ItemCount, BoundsCheck>& arr_,
+          std::span<std::byte>                           buffer_) noexcept;
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+requires std::is_trivially_copyable_v<ItemType>
+[[nodiscard]] deserialize_result
+deserialize(std::span<const std::byte>               buffer_,
+            array<ItemType, ItemCount, BoundsCheck>& arr_) noexcept;
+
+}        // namespace pel
+
+
+#include "./array_format.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
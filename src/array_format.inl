@@ -0,0 +1,317 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_format.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* TEXT FORMATTING ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Copy `text_` at `first_`, if it fits before `last_`.
+ *
+ * \retval      char*: End of the copied text, or `nullptr` if it didn't fit.
+ *************************************************************************************************/
+[[nodiscard]] inline char*
+format_text(char* first_, char* last_, std::string_view text_) noexcept
+{
+    if(static_cast<std::size_t>(last_ - first_) < text_.size())
+    {
+        return nullptr;
+    }
+
+    std::memcpy(first_, text_.data(), text_.size());
+    return first_ + text_.size();
+}
+
+template<array_formattable_type ItemType>
+[[nodiscard]] inline std::to_chars_result
+format_item(char* first_, char* last_, ItemType item_, const format_options& options_) noexcept
+{
+    if constexpr(std::is_floating_point_v<ItemType>)
+    {
+        if(options_.precision >= 0)
+        {
+            return std::to_chars(first_, last_, item_, options_.floatFormat, options_.precision);
+        }
+    }
+
+    return std::to_chars(first_, last_, item_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Write the items of an array as text, straight into a caller-provided buffer.
+ *
+ * \param       first_:   Beginning of the buffer.
+ * \param       last_:    End of the buffer.
+ * \param       arr_:     Array to format.
+ * \param       options_: Prefix, separator, suffix and floating-point format of the text.
+ *              [defaults : format_options{}, ie `1, 2, 3`]
+ *
+ * \retval      std::to_chars_result: End of the written text on success. On failure, `last_`
+ *              with `std::errc::value_too_large`, the content of the buffer being unspecified.
+ *
+ * \note        Items are written by `std::to_chars`: no allocation, no locale, no stream state.
+ *************************************************************************************************/
+template<array_formattable_type ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] inline std::to_chars_result
+format_to(char*                                          first_,
+          char*                                          last_,
+          const array<ItemType, ItemCount, BoundsCheck>& arr_,
+          const format_options&                          options_) noexcept
+{
+    char* out = format_text(first_, last_, options_.prefix);
+    if(out == nullptr)
+    {
+        return {last_, std::errc::value_too_large};
+    }
+
+    for(std::size_t i = 0; i < ItemCount; ++i)
+    {
+        if(i != 0)
+        {
+            out = format_text(out, last_, options_.separator);
+            if(out == nullptr)
+            {
+                return {last_, std::errc::value_too_large};
+            }
+        }
+
+        const std::to_chars_result result = format_item(out, last_, arr_.unchecked(i), options_);
+        if(result.ec != std::errc{})
+        {
+            return {last_, result.ec};
+        }
+        out = result.ptr;
+    }
+
+    out = format_text(out, last_, options_.suffix);
+    if(out == nullptr)
+    {
+        return {last_, std::errc::value_too_large};
+    }
+
+    return {out, std::errc{}};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Format the items of an array into a new string, see `format_to`.
+ *
+ * \param       arr_:     Array to format.
+ * \param       options_: Prefix, separator, suffix and floating-point format of the text.
+ *              [defaults : format_options{}, ie `1, 2, 3`]
+ *
+ * \retval      std::string: Formatted items.
+ *
+ * \note        The string is allocated once for the longest shortest-representation of the items;
+ *              only explicit precisions can require a larger buffer.
+ *************************************************************************************************/
+template<array_formattable_type ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] inline std::string
+format(const array<ItemType, ItemCount, BoundsCheck>& arr_, const format_options& options_)
+{
+    /* Sign, digits, and for floating-points the decimal point and exponent */
+    constexpr std::size_t itemChars = std::is_floating_point_v<ItemType>
+                                        ? std::numeric_limits<ItemType>::max_digits10 + 8
+                                        : std::numeric_limits<ItemType>::digits10 + 2;
+
+    std::string text(options_.prefix.size() + options_.suffix.size()
+                       + ItemCount * (itemChars + options_.separator.size()),
+                     '\0');
+
+    while(true)
+    {
+        char* first = text.data();
+
+        const std::to_chars_result result = format_to(first, first + text.size(), arr_, options_);
+        if(result.ec == std::errc{})
+        {
+            text.resize(static_cast<std::size_t>(result.ptr - first));
+            return text;
+        }
+
+        text.resize(text.size() * 2);
+    }
+}
+
+
+/*************************************************************************************************/
+/* BINARY SERIALIZATION ------------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+              "Serialization doesn't support mixed-endian targets");
+
+constexpr std::byte serialization_magic[4] = {
+  std::byte{'P'}, std::byte{'E'}, std::byte{'L'}, std::byte{'A'}};
+constexpr std::byte serialization_native_order =
+  (std::endian::native == std::endian::big) ? std::byte{1} : std::byte{0};
+
+inline void
+store_little_endian(std::byte* destination_, std::uint64_t value_, std::size_t bytes_) noexcept
+{
+    for(std::size_t i = 0; i < bytes_; ++i)
+    {
+        destination_[i] = static_cast<std::byte>(value_ >> (8 * i));
+    }
+}
+
+[[nodiscard]] inline std::uint64_t
+load_little_endian(const std::byte* source_, std::size_t bytes_) noexcept
+{
+    std::uint64_t value = 0;
+    for(std::size_t i = 0; i < bytes_; ++i)
+    {
+        value |= static_cast<std::uint64_t>(source_[i]) << (8 * i);
+    }
+    return value;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Number of bytes written by `serialize` for an array.
+ *
+ * \retval      std::size_t: Header and items size, known at compile-time.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+[[nodiscard]] constexpr std::size_t
+serialized_size([[maybe_unused]] const array<ItemType, ItemCount, BoundsCheck>& arr_) noexcept
+{
+    return serialization_header_bytes + (sizeof(ItemType) * ItemCount);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Write the header and the items of an array into a byte buffer.
+ *
+ * \param       arr_:    Array to serialize.
+ * \param       buffer_: Destination, at least `serialized_size(arr_)` bytes long.
+ *
+ * \retval      serialize_result: End of the written bytes on success. On failure, the end of the
+ *              buffer with `std::errc::value_too_large`, the buffer being left untouched.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+requires std::is_trivially_copyable_v<ItemType>
+[[nodiscard]] inline serialize_result
+serialize(const array<ItemType, ItemCount, BoundsCheck>& arr_,
+          std::span<std::byte>                           buffer_) noexcept
+{
+    constexpr std::size_t itemBytes = sizeof(ItemType) * ItemCount;
+
+    if(buffer_.size() < serialized_size(arr_))
+    {
+        return {buffer_.data() + buffer_.size(), std::errc::value_too_large};
+    }
+
+    std::byte* header = buffer_.data();
+    std::copy(std::begin(serialization_magic), std::end(serialization_magic), header);
+    header[4] = std::byte{serialization_version};
+    header[5] = serialization_native_order;
+    store_little_endian(header + 6, sizeof(ItemType), 2);
+    store_little_endian(header + 8, ItemCount, 8);
+
+    std::memcpy(header + serialization_header_bytes, arr_.data(), itemBytes);
+
+    return {header + serialization_header_bytes + itemBytes, std::errc{}};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Read an array written by `serialize`.
+ *
+ * \param       buffer_: Serialized array.
+ * \param       arr_:    Array receiving the items.
+ *
+ * \retval      deserialize_result: End of the read bytes on success. On failure, the beginning
+ *              of the buffer and, `arr_` being left untouched:
+ *              - `std::errc::invalid_argument`: Truncated buffer, wrong magic bytes, or an array
+ *                                               of another item size or length.
+ *              - `std::errc::not_supported`:    Newer format version, or non-arithmetic items
+ *                                               written with the other byte order.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+requires std::is_trivially_copyable_v<ItemType>
+[[nodiscard]] inline deserialize_result
+deserialize(std::span<const std::byte>               buffer_,
+            array<ItemType, ItemCount, BoundsCheck>& arr_) noexcept
+{
+    constexpr std::size_t itemBytes = sizeof(ItemType) * ItemCount;
+
+    const std::byte* header = buffer_.data();
+
+    if((buffer_.size() < serialized_size(arr_))
+       || !std::equal(std::begin(serialization_magic), std::end(serialization_magic), header)
+       || (load_little_endian(header + 6, 2) != sizeof(ItemType))
+       || (load_little_endian(header + 8, 8) != ItemCount))
+    {
+        return {header, std::errc::invalid_argument};
+    }
+
+    const bool swapped = (header[5] != serialization_native_order);
+    if((std::to_integer<std::uint8_t>(header[4]) > serialization_version)
+       || (swapped && !std::is_arithmetic_v<ItemType>))
+    {
+        return {header, std::errc::not_supported};
+    }
+
+    std::memcpy(arr_.data(), header + serialization_header_bytes, itemBytes);
+
+    if constexpr(std::is_arithmetic_v<ItemType> && (sizeof(ItemType) > 1))
+    {
+        if(swapped)
+        {
+            unsigned char* bytes = reinterpret_cast<unsigned char*>(arr_.data());
+            for(std::size_t i = 0; i < itemBytes; i += sizeof(ItemType))
+            {
+                std::reverse(bytes + i, bytes + i + sizeof(ItemType));
+            }
+        }
+    }
+
+    return {header + serialization_header_bytes + itemBytes, std::errc{}};
+}
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,122 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+
+/*************************************************************************************************/
+/* Configuration ------------------------------------------------------------------------------- */
+
+/* Count the constructions, copies and moves of the items of every `pel::array` instantiation.
+ * Off by default: the hooks then compile to nothing. */
+#if !defined(PEL_ARRAY_INSTRUMENTATION)
+#define PEL_ARRAY_INSTRUMENTATION 0
+#endif
+
+/* Number of instantiations counted separately, the others sharing the last slot */
+#if !defined(PEL_ARRAY_INSTRUMENTATION_SLOTS)
+#define PEL_ARRAY_INSTRUMENTATION_SLOTS 256
+#endif
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Instrumentation ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Per-instantiation counters of the work done by the arrays, to find the copy hot
+ *              spots of a program without running a profiler.
+ *
+ * \note        Every thread counts into its own block of counters, without any synchronization on
+ *              the hot path. `report` adds up the blocks of the running threads and the counts left
+ *              by the threads that exited.
+ *
+ * \note        Operations evaluated in constant expressions are not counted.
+ *************************************************************************************************/
+namespace instrumentation
+{
+constexpr bool        enabled   = PEL_ARRAY_INSTRUMENTATION != 0;
+constexpr std::size_t max_slots = PEL_ARRAY_INSTRUMENTATION_SLOTS;
+
+static_assert(max_slots > 0, "At least one instantiation must be counted");
+
+/* Events counted for each instantiation */
+enum class event : std::uint8_t
+{
+    construction,  /* Item initialized by a constructor, whatever its value comes from */
+    copy,          /* Item copied from another array or a range, on construction or assignment */
+    move,          /* Item moved from another array, on construction or assignment */
+    check_failure, /* `check_fit` found data that doesn't fit in the array */
+};
+
+constexpr std::size_t event_count = 4;
+
+/* Counts of an instantiation */
+struct counters
+{
+    std::uint64_t constructions = 0;
+    std::uint64_t copies        = 0;
+    std::uint64_t moves         = 0;
+    std::uint64_t checkFailures = 0;
+    std::uint64_t bytesMoved    = 0; /* Bytes of the items copied or moved */
+};
+
+/* Counts of an instantiation, named after its type */
+struct report_entry
+{
+    std::string_view name;
+    counters         counts;
+};
+
+
+/*************************************************************************************************/
+/* Hooks --------------------------------------------------------------------------------------- */
+template<typename ArrayType>
+constexpr void record(event event_, std::size_t itemCount_, std::size_t bytes_ = 0) noexcept;
+
+
+/*************************************************************************************************/
+/* Reports ------------------------------------------------------------------------------------- */
+[[nodiscard]] std::vector<report_entry> report();
+void                                    reset() noexcept;
+void                                    print_report(std::ostream& os_);
+void                                    report_at_exit(std::ostream& os_);
+}        // namespace instrumentation
+
+}        // namespace pel
+
+
+#include "./array_instrumentation.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,399 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_instrumentation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+
+namespace pel
+{
+namespace instrumentation
+{
+/*************************************************************************************************/
+/* Helpers ------------------------------------------------------------------------------------- */
+
+/* Index of the byte counter, after the event counters */
+constexpr std::size_t bytes_counter = event_count;
+
+/**
+ **************************************************************************************************
+ * \brief       Name of a type, as written by the compiler in the signature of this function.
+ *
+ * \retval      std::string_view: Name of `ArrayType`, or the whole signature on compilers that
+ *                                don't write template arguments as `ArrayType = ...`.
+ *************************************************************************************************/
+template<typename ArrayType>
+[[nodiscard]] std::string_view
+type_name() noexcept
+{
+    const std::string_view signature = std::source_location::current().function_name();
+    constexpr std::string_view prefix = "ArrayType = ";
+
+    const std::size_t begin = signature.find(prefix);
+    if(begin == std::string_view::npos)
+    {
+        return signature;
+    }
+
+    const std::size_t nameBegin = begin + prefix.size();
+    std::size_t       nameEnd   = signature.find(';', nameBegin);
+    if(nameEnd == std::string_view::npos)
+    {
+        nameEnd = signature.rfind(']');
+    }
+    return signature.substr(nameBegin, nameEnd - nameBegin);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Counters of a thread, one row per instantiation.
+ *
+ * \note        The owning thread counts with a relaxed load and store rather than a locked
+ *              read-modify-write: the atomics only let `report` and `reset` reach the counters
+ *              meanwhile.
+ *************************************************************************************************/
+class thread_counters
+{
+public:
+    using RowType = std::array<std::atomic<std::uint64_t>, event_count + 1>;
+
+    thread_counters() noexcept;
+    ~thread_counters();
+
+    thread_counters(const thread_counters&)            = delete;
+    thread_counters& operator=(const thread_counters&) = delete;
+
+    void add(std::size_t slot_, std::size_t counter_, std::uint64_t value_) noexcept
+    {
+        std::atomic<std::uint64_t>& count = m_rows[slot_][counter_];
+        count.store(count.load(std::memory_order_relaxed) + value_, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const RowType& row(std::size_t slot_) const noexcept
+    {
+        return m_rows[slot_];
+    }
+
+    void clear() noexcept
+    {
+        for(RowType& row : m_rows)
+        {
+            for(std::atomic<std::uint64_t>& count : row)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    std::array<RowType, max_slots> m_rows{};
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Process-wide list of the counted instantiations and of the threads counting them.
+ *
+ * \note        Never destroyed, so that threads exiting during static destruction, like the workers
+ *              of a static thread pool, can still hand their counts over.
+ *
+ * \note        `names` is reserved up front, so that naming an instantiation never allocates.
+ *************************************************************************************************/
+struct counter_registry
+{
+    counter_registry()
+    {
+        names.reserve(max_slots);
+    }
+
+    std::mutex                      mutex;
+    std::vector<std::string_view>   names;
+    std::vector<thread_counters*>   threads;
+    std::array<counters, max_slots> retired{};
+    std::ostream*                   exitStream = nullptr;
+};
+
+[[nodiscard]] inline counter_registry&
+registry()
+{
+    static counter_registry& instance = *new counter_registry;
+    return instance;
+}
+
+/* Add the counts of a row to `counters_` */
+inline void
+accumulate(counters& counters_, const thread_counters::RowType& row_) noexcept
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    counters_.constructions += row_[static_cast<std::size_t>(event::construction)].load(relaxed);
+    counters_.copies += row_[static_cast<std::size_t>(event::copy)].load(relaxed);
+    counters_.moves += row_[static_cast<std::size_t>(event::move)].load(relaxed);
+    counters_.checkFailures += row_[static_cast<std::size_t>(event::check_failure)].load(relaxed);
+    counters_.bytesMoved += row_[bytes_counter].load(relaxed);
+}
+
+inline thread_counters::thread_counters() noexcept
+{
+    try
+    {
+        counter_registry&                 counterRegistry = registry();
+        const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+        counterRegistry.threads.push_back(this);
+    }
+    catch(...)
+    {
+        /* Counted from within array constructors, which can't throw: a thread that couldn't be
+         * registered only reports its counts once it exits */
+    }
+}
+
+inline thread_counters::~thread_counters()
+{
+    try
+    {
+        counter_registry&                 counterRegistry = registry();
+        const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+
+        for(std::size_t slot = 0; slot < counterRegistry.names.size(); ++slot)
+        {
+            accumulate(counterRegistry.retired[slot], m_rows[slot]);
+        }
+        std::erase(counterRegistry.threads, this);
+    }
+    catch(...)
+    {
+        /* Only reached if the registry couldn't be created, so there is nowhere to report to */
+    }
+}
+
+/* Counters of the calling thread, registered on its first count */
+[[nodiscard]] inline thread_counters&
+local_counters() noexcept
+{
+    static thread_local thread_counters threadCounters;
+    return threadCounters;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the row of an instantiation, assigned on its first count.
+ *
+ * \retval      std::size_t: Row of `ArrayType`, the last row being shared once they are all taken,
+ *                           or if the registry couldn't be created.
+ *************************************************************************************************/
+template<typename ArrayType>
+[[nodiscard]] inline std::size_t
+instantiation_slot() noexcept
+{
+    static const std::size_t slot = []() noexcept -> std::size_t
+    {
+        try
+        {
+            counter_registry&                 counterRegistry = registry();
+            const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+
+            if(counterRegistry.names.size() + 1 < max_slots)
+            {
+                counterRegistry.names.push_back(type_name<ArrayType>());
+                return counterRegistry.names.size() - 1;
+            }
+            if(counterRegistry.names.size() + 1 == max_slots)
+            {
+                counterRegistry.names.emplace_back("(other instantiations)");
+            }
+        }
+        catch(...)
+        {
+            /* Counting must not throw out of array constructors: share the last row instead */
+        }
+        return max_slots - 1;
+    }();
+    return slot;
+}
+
+template<typename ArrayType>
+inline void
+count(event event_, std::size_t itemCount_, std::size_t bytes_) noexcept
+{
+    const std::size_t slot           = instantiation_slot<ArrayType>();
+    thread_counters&  threadCounters = local_counters();
+
+    threadCounters.add(slot, static_cast<std::size_t>(event_), itemCount_);
+    if(bytes_ != 0)
+    {
+        threadCounters.add(slot, bytes_counter, bytes_);
+    }
+}
+
+
+/*************************************************************************************************/
+/* HOOKS --------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Count an event of an instantiation.
+ *
+ * \param       event_:     Event to count.
+ * \param       itemCount_: Number of items concerned.
+ * \param       bytes_:     Number of bytes copied or moved.
+ *
+ * \note        Compiles to nothing unless `PEL_ARRAY_INSTRUMENTATION` is set.
+ *************************************************************************************************/
+template<typename ArrayType>
+constexpr void
+record([[maybe_unused]] event       event_,
+       [[maybe_unused]] std::size_t itemCount_,
+       [[maybe_unused]] std::size_t bytes_) noexcept
+{
+    if constexpr(enabled)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            count<ArrayType>(event_, itemCount_, bytes_);
+        }
+    }
+}
+
+
+/*************************************************************************************************/
+/* REPORTS ------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Read the counts of every instantiation counted so far.
+ *
+ * \retval      std::vector<report_entry>: Counts of the running and exited threads, added up, in
+ *                                         the order the instantiations were first counted.
+ *
+ * \note        The counts of the running threads are read while they keep counting: each counter is
+ *              exact, but they aren't all read at the same instant.
+ *************************************************************************************************/
+[[nodiscard]] inline std::vector<report_entry>
+report()
+{
+    counter_registry&                 counterRegistry = registry();
+    const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+
+    std::vector<report_entry> entries;
+    entries.reserve(counterRegistry.names.size());
+    for(std::size_t slot = 0; slot < counterRegistry.names.size(); ++slot)
+    {
+        report_entry entry{counterRegistry.names[slot], counterRegistry.retired[slot]};
+        for(const thread_counters* threadCounters : counterRegistry.threads)
+        {
+            accumulate(entry.counts, threadCounters->row(slot));
+        }
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Reset the counts of every instantiation.
+ *
+ * \note        Counts made by other threads while resetting may be lost.
+ *************************************************************************************************/
+inline void
+reset() noexcept
+{
+    counter_registry&                 counterRegistry = registry();
+    const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+
+    counterRegistry.retired.fill(counters{});
+    for(thread_counters* threadCounters : counterRegistry.threads)
+    {
+        threadCounters->clear();
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Print the counts of every instantiation, most bytes moved first.
+ *
+ * \param       os_: Output stream to print to.
+ *************************************************************************************************/
+inline void
+print_report(std::ostream& os_)
+{
+    std::vector<report_entry> entries = report();
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const report_entry& lhs_, const report_entry& rhs_)
+                     {
+                         return lhs_.counts.bytesMoved > rhs_.counts.bytesMoved;
+                     });
+
+    os_ << std::setw(14) << "constructions" << std::setw(14) << "copies" << std::setw(14)
+        << "moves" << std::setw(10) << "failures" << std::setw(16) << "bytes moved"
+        << "  instantiation\n";
+    for(const report_entry& entry : entries)
+    {
+        os_ << std::setw(14) << entry.counts.constructions << std::setw(14) << entry.counts.copies
+            << std::setw(14) << entry.counts.moves << std::setw(10) << entry.counts.checkFailures
+            << std::setw(16) << entry.counts.bytesMoved << "  " << entry.name << '\n';
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Print the report to `os_` when the program exits normally.
+ *
+ * \param       os_: Output stream to print to, which must outlive the static objects of the
+ *                   program, like `std::clog`.
+ *************************************************************************************************/
+inline void
+report_at_exit(std::ostream& os_)
+{
+    counter_registry& counterRegistry = registry();
+    {
+        const std::lock_guard<std::mutex> lock{counterRegistry.mutex};
+        if(std::exchange(counterRegistry.exitStream, &os_) != nullptr)
+        {
+            return;
+        }
+    }
+
+    std::atexit([] { print_report(*registry().exitStream); });
+}
+
+}        // namespace instrumentation
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
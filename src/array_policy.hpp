@@ -0,0 +1,191 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <span>
+#include <type_traits>
+
+
+/*************************************************************************************************/
+/* Configuration ------------------------------------------------------------------------------- */
+
+/* Share the size-independent code of the arrays between all their sizes: loops over the items,
+ * formatting and failed checks are compiled once per item type, out of line, instead of once per
+ * `ItemCount`. Set to 0 to let the compiler inline everything instead. */
+#if !defined(PEL_ARRAY_SHARED_CODE)
+#define PEL_ARRAY_SHARED_CODE 1
+#endif
+
+/* Arrays of trivially copyable items up to this size keep their loops inline, where they unroll
+ * into fewer instructions than a call */
+#if !defined(PEL_ARRAY_SHARED_CODE_BYTES)
+#define PEL_ARRAY_SHARED_CODE_BYTES 64
+#endif
+
+#if (PEL_ARRAY_SHARED_CODE == 1) && (defined(__GNUC__) || defined(__clang__))
+#define PEL_ARRAY_NOINLINE __attribute__((noinline))
+#elif (PEL_ARRAY_SHARED_CODE == 1) && defined(_MSC_VER)
+#define PEL_ARRAY_NOINLINE __declspec(noinline)
+#else
+#define PEL_ARRAY_NOINLINE
+#endif
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Bounds checking policies -------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Bounds checking policies of `pel::array`, chosen per instantiation.
+ *
+ * \note        Every policy exposes:
+ *              - `nothrow`:           `true` if a failed check never throws.
+ *              - `check<E>(c, msg)`:  Handle a check whose condition `c` must hold, `E` being the
+ *                                     exception thrown by policies that throw.
+ *              - `subscript`:         Policy applied by `operator[]`, the same policy except for
+ *                                     `sizes_only`.
+ *
+ * \note        A failed check in a constant expression is always a compile error.
+ *************************************************************************************************/
+namespace bounds_check
+{
+/* Builds and throws the exception out of line, once per exception type instead of at each check */
+template<typename ExceptionType>
+[[noreturn]] PEL_ARRAY_NOINLINE void
+throw_failure(const char* message_)
+{
+    throw(ExceptionType(message_));
+}
+
+/* Throw `ExceptionType` on failure */
+struct checked
+{
+    using subscript = checked;
+
+    static constexpr bool nothrow = false;
+
+    template<typename ExceptionType>
+    static constexpr void check(bool condition_, const char* message_)
+    {
+        if(!condition_) [[unlikely]]
+        {
+            throw_failure<ExceptionType>(message_);
+        }
+    }
+};
+
+/* Never check, the caller guarantees every access is in bounds */
+struct unchecked
+{
+    using subscript = unchecked;
+
+    static constexpr bool nothrow = true;
+
+    template<typename ExceptionType>
+    static constexpr void check([[maybe_unused]] bool        condition_,
+                                [[maybe_unused]] const char* message_) noexcept
+    {
+    }
+};
+
+/* `assert` on failure: checked in debug builds, unchecked when `NDEBUG` is defined */
+struct assert_only
+{
+    using subscript = assert_only;
+
+    static constexpr bool nothrow = true;
+
+    template<typename ExceptionType>
+    static constexpr void check([[maybe_unused]] bool        condition_,
+                                [[maybe_unused]] const char* message_) noexcept
+    {
+        assert(condition_ && message_);
+    }
+};
+
+/* Abort the program on failure, without unwinding nor any exception support */
+struct trap
+{
+    using subscript = trap;
+
+    static constexpr bool nothrow = true;
+
+    template<typename ExceptionType>
+    static constexpr void check(bool condition_, [[maybe_unused]] const char* message_) noexcept
+    {
+        if(!condition_) [[unlikely]]
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_trap();
+#else
+            std::abort();
+#endif
+        }
+    }
+};
+
+/* Throw on failed size and range checks like `checked`, but leave `operator[]` unchecked, at the
+ * cost of a built-in array's: the policy of arrays that do not name one */
+struct sizes_only : checked
+{
+    using subscript = unchecked;
+};
+}        // namespace bounds_check
+
+/* Global switch selecting the policy of arrays that do not name one */
+constexpr bool array_safeness = true;
+
+using default_bounds_check =
+  std::conditional_t<array_safeness, bounds_check::sizes_only, bounds_check::unchecked>;
+
+
+/*************************************************************************************************/
+/* Forward declarations ------------------------------------------------------------------------ */
+
+/* Extent of the views whose length is only known at run-time */
+constexpr std::size_t dynamic_extent = std::dynamic_extent;
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck = default_bounds_check>
+class array;
+
+template<typename ItemType,
+         std::size_t Extent   = dynamic_extent,
+         typename BoundsCheck = default_bounds_check>
+class array_view;
+
+template<typename ItemType, typename BoundsCheck = default_bounds_check>
+class strided_view;
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,224 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aligned_array.hpp"
+#include "./array.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+
+/*************************************************************************************************/
+/* Configuration ------------------------------------------------------------------------------- */
+
+/* Number of threads keeping their own cache of free slots in each pool. The threads started after
+ * them share the pool's free list directly. */
+#if !defined(PEL_ARRAY_POOL_MAX_THREADS)
+#define PEL_ARRAY_POOL_MAX_THREADS 64
+#endif
+
+
+namespace pel
+{
+constexpr std::size_t pool_max_threads = PEL_ARRAY_POOL_MAX_THREADS;
+
+[[nodiscard]] std::size_t pool_thread_index();
+
+
+/*************************************************************************************************/
+/* Array pool ---------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Allocator of short-lived arrays, handing out array-sized slots from large chunks
+ *              instead of calling `malloc` for each of them.
+ *
+ * \note        Slots are taken, in order:
+ *              - From the magazine of the calling thread: a small stack of free slots only that
+ *                thread touches, without any atomic operation.
+ *              - From the pool's free list, a lock-free stack, refilling half the magazine.
+ *              - From the never used slots of the chunks, a new chunk being allocated once they
+ *                are all taken.
+ *              Freed slots go back to the magazine of the freeing thread, half of a full magazine
+ *              being returned to the free list at once.
+ *
+ * \note        `make` returns a `handle` owning the array, which destroys it and frees its slot.
+ *              `reset` frees every slot at once, for arena-style lifetimes where all the arrays of
+ *              a request or a frame die together.
+ *
+ * \note        The pool must outlive its handles. Chunks are only released by its destructor.
+ *************************************************************************************************/
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck      = default_bounds_check,
+         std::size_t ChunkCapacity = 0>
+class array_pool
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+    using ArrayType = array<ItemType, ItemCount, BoundsCheck>;
+    using SizeType  = std::size_t;
+    using IndexType = std::uint32_t;
+
+    /* Slots per chunk: enough to fill about 64 KiB unless specified */
+    static constexpr SizeType slot_bytes =
+      (sizeof(ArrayType) + alignof(ArrayType) - 1) / alignof(ArrayType) * alignof(ArrayType);
+    static constexpr SizeType chunk_capacity =
+      ChunkCapacity != 0 ? ChunkCapacity : std::max<SizeType>(1, (SizeType{1} << 16) / slot_bytes);
+    static constexpr SizeType max_chunks    = 4096;
+    static constexpr SizeType magazine_size = 32;
+
+    static_assert(chunk_capacity * max_chunks < (SizeType{1} << 32), "Too many slots in a pool");
+
+    class handle;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    array_pool() = default;
+    array_pool(const array_pool&)            = delete;
+    array_pool& operator=(const array_pool&) = delete;
+    ~array_pool();
+
+
+    /*********************************************************************************************/
+    /* Allocation ------------------------------------------------------------------------------ */
+    template<typename... Args>
+    [[nodiscard]] handle make(Args&&... args_);
+    [[nodiscard]] handle make_for_overwrite() requires(std::is_trivially_copyable_v<ItemType>);
+
+    void reset() noexcept requires(std::is_trivially_destructible_v<ArrayType>);
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] SizeType chunk_count() const noexcept;
+    [[nodiscard]] SizeType capacity() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    struct chunk
+    {
+        alignas(ArrayType) std::byte slots[chunk_capacity][slot_bytes];
+        std::atomic<IndexType> links[chunk_capacity];
+    };
+
+    struct magazine
+    {
+        SizeType                             count = 0;
+        std::array<IndexType, magazine_size> slots;
+    };
+
+    [[nodiscard]] IndexType allocate();
+    void                    deallocate(IndexType slot_) noexcept;
+
+    [[nodiscard]] IndexType take_unused();
+    [[nodiscard]] IndexType pop_free() noexcept;
+    void                    push_free(IndexType first_, IndexType last_) noexcept;
+
+    [[nodiscard]] void*                   slot_address(IndexType slot_) const noexcept;
+    [[nodiscard]] std::atomic<IndexType>& link(IndexType slot_) const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    static constexpr IndexType no_slot = ~IndexType{0};
+
+    /* Free list head: index of the first free slot plus one, and a tag changed by every update so
+     * that a head popped and pushed back meanwhile doesn't pass for unchanged (ABA) */
+    alignas(cache_line_bytes) std::atomic<std::uint64_t> m_freeHead = 0;
+    alignas(cache_line_bytes) std::atomic<IndexType> m_unused = 0;
+
+    std::array<std::atomic<chunk*>, max_chunks> m_chunks{};
+    std::atomic<SizeType>                       m_chunkCount = 0;
+    std::mutex                                  m_growMutex;
+
+    std::array<padded_item<magazine>, pool_max_threads> m_magazines{};
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Owner of an array allocated by an `array_pool`, destroying it and freeing its slot
+ *              when destroyed.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, std::size_t ChunkCapacity>
+class array_pool<ItemType, ItemCount, BoundsCheck, ChunkCapacity>::handle
+{
+public:
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    handle() noexcept = default;
+    handle(handle&& move_) noexcept;
+    handle& operator=(handle&& move_) noexcept;
+    ~handle();
+
+
+    /*********************************************************************************************/
+    /* Accessors ------------------------------------------------------------------------------- */
+    [[nodiscard]] ArrayType* get() const noexcept;
+    [[nodiscard]] ArrayType& operator*() const noexcept;
+    [[nodiscard]] ArrayType* operator->() const noexcept;
+    [[nodiscard]] explicit   operator bool() const noexcept;
+
+    void                     reset() noexcept;
+    [[nodiscard]] ArrayType* release() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    friend class array_pool;
+
+    handle(array_pool* pool_, IndexType slot_, ArrayType* items_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    array_pool* m_pool  = nullptr;
+    IndexType   m_slot  = 0;
+    ArrayType*  m_items = nullptr;
+};
+
+}        // namespace pel
+
+
+#include "./array_pool.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,507 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_pool.hpp"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define ARRAY_POOL_TEMPLATE_DECLARATION__                                                          \
+    typename ItemType, std::size_t ItemCount, typename BoundsCheck, std::size_t ChunkCapacity
+#define ARRAY_POOL_CLASS_SCOPE__ array_pool<ItemType, ItemCount, BoundsCheck, ChunkCapacity>
+
+
+/*************************************************************************************************/
+/* Thread indices ------------------------------------------------------------------------------ */
+
+/* Indices of the running threads, those of exited threads being handed out again first. Never
+ * destroyed, so that threads exiting during static destruction can still return theirs. */
+struct pool_thread_registry
+{
+    std::mutex               mutex;
+    std::vector<std::size_t> freeIndices;
+    std::size_t              nextIndex = 0;
+};
+
+[[nodiscard]] inline pool_thread_registry&
+thread_registry()
+{
+    static pool_thread_registry& instance = *new pool_thread_registry;
+    return instance;
+}
+
+/* Index held by a thread for as long as it runs */
+struct pool_thread_slot
+{
+    pool_thread_slot()
+    {
+        pool_thread_registry&             registry = thread_registry();
+        const std::lock_guard<std::mutex> lock{registry.mutex};
+
+        if(registry.freeIndices.empty())
+        {
+            index = registry.nextIndex++;
+        }
+        else
+        {
+            index = registry.freeIndices.back();
+            registry.freeIndices.pop_back();
+        }
+    }
+
+    ~pool_thread_slot()
+    {
+        pool_thread_registry&             registry = thread_registry();
+        const std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.freeIndices.push_back(index);
+    }
+
+    pool_thread_slot(const pool_thread_slot&)            = delete;
+    pool_thread_slot& operator=(const pool_thread_slot&) = delete;
+
+    std::size_t index = 0;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Get the index of the calling thread, among the threads currently running.
+ *
+ * \retval      std::size_t: Index of the magazines of the calling thread in every pool.
+ *
+ * \note        A thread started after another one exited takes its index, and with it the free
+ *              slots left in its magazines: they are never lost.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+pool_thread_index()
+{
+    static thread_local const pool_thread_slot slot;
+    return slot.index;
+}
+
+
+/*************************************************************************************************/
+/* CONSTRUCTORS & DESTRUCTORS ------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Destructor releasing every chunk.
+ *
+ * \note        The arrays still alive aren't destroyed: their handles must be gone by now.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+ARRAY_POOL_CLASS_SCOPE__::~array_pool()
+{
+    for(std::atomic<chunk*>& allocatedChunk : m_chunks)
+    {
+        delete allocatedChunk.load(std::memory_order_relaxed);
+    }
+}
+
+
+/*************************************************************************************************/
+/* ALLOCATION ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Build an array in a free slot of the pool.
+ *
+ * \param       args_: Arguments forwarded to the constructor of the array, ie `pel::for_overwrite`
+ *                     to leave scratch buffers uninitialized.
+ *
+ * \retval      handle: Owner of the new array.
+ *
+ * \throws      std::bad_alloc if the pool is out of chunks or a chunk can't be allocated.
+ *
+ * \note        Without arguments, the array is value-initialized: arithmetic items are zeroed,
+ *              which writes the whole slot on every call. `make_for_overwrite` skips it.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+template<typename... Args>
+inline typename ARRAY_POOL_CLASS_SCOPE__::handle
+ARRAY_POOL_CLASS_SCOPE__::make(Args&&... args_)
+{
+    const IndexType slot = allocate();
+    try
+    {
+        ArrayType* items = ::new(slot_address(slot)) ArrayType(std::forward<Args>(args_)...);
+        return handle{this, slot, items};
+    }
+    catch(...)
+    {
+        deallocate(slot);
+        throw;
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build an array with uninitialized items in a free slot of the pool, for scratch
+ *              buffers that are about to be overwritten.
+ *
+ * \retval      handle: Owner of the new array.
+ *
+ * \throws      std::bad_alloc if the pool is out of chunks or a chunk can't be allocated.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::handle
+ARRAY_POOL_CLASS_SCOPE__::make_for_overwrite() requires(std::is_trivially_copyable_v<ItemType>)
+{
+    return make(for_overwrite);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Free every slot at once, without destroying the arrays they hold.
+ *
+ * \note        Every handle still alive must be released with `handle::release` first, and no
+ *              other thread may use the pool meanwhile. The chunks are kept for the next arrays.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline void
+ARRAY_POOL_CLASS_SCOPE__::reset() noexcept requires(std::is_trivially_destructible_v<ArrayType>)
+{
+    for(padded_item<magazine>& cache : m_magazines)
+    {
+        cache.value.count = 0;
+    }
+    m_freeHead.store(0, std::memory_order_relaxed);
+    m_unused.store(0, std::memory_order_relaxed);
+}
+
+
+/*************************************************************************************************/
+/* SIZE ---------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of chunks allocated by the pool.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::SizeType
+ARRAY_POOL_CLASS_SCOPE__::chunk_count() const noexcept
+{
+    return m_chunkCount.load(std::memory_order_relaxed);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of arrays the allocated chunks can hold.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::SizeType
+ARRAY_POOL_CLASS_SCOPE__::capacity() const noexcept
+{
+    return chunk_count() * chunk_capacity;
+}
+
+
+/*************************************************************************************************/
+/* PRIVATE METHODS ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Take a free slot, from the magazine of the calling thread if it has one.
+ *              An empty magazine is refilled halfway from the free list.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::IndexType
+ARRAY_POOL_CLASS_SCOPE__::allocate()
+{
+    const std::size_t thread = pool_thread_index();
+    if(thread >= pool_max_threads)
+    {
+        const IndexType slot = pop_free();
+        return slot != no_slot ? slot : take_unused();
+    }
+
+    magazine& cache = m_magazines[thread].value;
+    if(cache.count == 0)
+    {
+        for(; cache.count < magazine_size / 2; ++cache.count)
+        {
+            const IndexType slot = pop_free();
+            if(slot == no_slot)
+            {
+                break;
+            }
+            cache.slots[cache.count] = slot;
+        }
+        if(cache.count == 0)
+        {
+            return take_unused();
+        }
+    }
+    return cache.slots[--cache.count];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Give a slot back, to the magazine of the calling thread if it has one.
+ *              The older half of a full magazine is pushed on the free list first, in one step.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline void
+ARRAY_POOL_CLASS_SCOPE__::deallocate(IndexType slot_) noexcept
+{
+    const std::size_t thread = pool_thread_index();
+    if(thread >= pool_max_threads)
+    {
+        push_free(slot_, slot_);
+        return;
+    }
+
+    magazine& cache = m_magazines[thread].value;
+    if(cache.count == magazine_size)
+    {
+        constexpr SizeType half = magazine_size / 2;
+        for(SizeType i = 0; i + 1 < half; ++i)
+        {
+            link(cache.slots[i]).store(cache.slots[i + 1] + 1, std::memory_order_relaxed);
+        }
+        push_free(cache.slots[0], cache.slots[half - 1]);
+
+        std::copy(cache.slots.begin() + half, cache.slots.end(), cache.slots.begin());
+        cache.count = magazine_size - half;
+    }
+    cache.slots[cache.count++] = slot_;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Take the next slot never used since the pool was built or reset, allocating its
+ *              chunk if it's the first slot taken from it.
+ *
+ * \throws      std::bad_alloc if every chunk is taken or a chunk can't be allocated.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::IndexType
+ARRAY_POOL_CLASS_SCOPE__::take_unused()
+{
+    IndexType slot = m_unused.load(std::memory_order_relaxed);
+    do
+    {
+        if(slot == chunk_capacity * max_chunks)
+        {
+            throw std::bad_alloc();
+        }
+    } while(!m_unused.compare_exchange_weak(slot, slot + 1, std::memory_order_relaxed));
+
+    std::atomic<chunk*>& slotChunk = m_chunks[slot / chunk_capacity];
+    if(slotChunk.load(std::memory_order_acquire) == nullptr)
+    {
+        const std::lock_guard<std::mutex> lock{m_growMutex};
+        if(slotChunk.load(std::memory_order_relaxed) == nullptr)
+        {
+            slotChunk.store(new chunk, std::memory_order_release);
+            m_chunkCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return slot;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Pop the first slot of the free list.
+ *
+ * \retval      IndexType: Slot taken, `no_slot` if the list is empty.
+ *
+ * \note        The link of a slot popped by another thread meanwhile may be stale, but its tagged
+ *              head no longer matches: the compare-exchange fails and the pop starts over.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::IndexType
+ARRAY_POOL_CLASS_SCOPE__::pop_free() noexcept
+{
+    std::uint64_t head = m_freeHead.load(std::memory_order_acquire);
+    while(static_cast<IndexType>(head) != 0)
+    {
+        const IndexType     slot    = static_cast<IndexType>(head) - 1;
+        const IndexType     next    = link(slot).load(std::memory_order_relaxed);
+        const std::uint64_t newHead = (((head >> 32U) + 1) << 32U) | next;
+        if(m_freeHead.compare_exchange_weak(
+             head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+    return no_slot;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Push a chain of slots, already linked from `first_` to `last_`, on the free list.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline void
+ARRAY_POOL_CLASS_SCOPE__::push_free(IndexType first_, IndexType last_) noexcept
+{
+    std::uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+    std::uint64_t newHead;
+    do
+    {
+        link(last_).store(static_cast<IndexType>(head), std::memory_order_relaxed);
+        newHead = (((head >> 32U) + 1) << 32U) | (first_ + 1);
+    } while(!m_freeHead.compare_exchange_weak(
+      head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline void*
+ARRAY_POOL_CLASS_SCOPE__::slot_address(IndexType slot_) const noexcept
+{
+    chunk* slotChunk = m_chunks[slot_ / chunk_capacity].load(std::memory_order_acquire);
+    return slotChunk->slots[slot_ % chunk_capacity];
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline std::atomic<typename ARRAY_POOL_CLASS_SCOPE__::IndexType>&
+ARRAY_POOL_CLASS_SCOPE__::link(IndexType slot_) const noexcept
+{
+    chunk* slotChunk = m_chunks[slot_ / chunk_capacity].load(std::memory_order_acquire);
+    return slotChunk->links[slot_ % chunk_capacity];
+}
+
+
+/*************************************************************************************************/
+/* HANDLE -------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline ARRAY_POOL_CLASS_SCOPE__::handle::handle(array_pool* pool_,
+                                                IndexType   slot_,
+                                                ArrayType*  items_) noexcept
+: m_pool{pool_}, m_slot{slot_}, m_items{items_}
+{
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline ARRAY_POOL_CLASS_SCOPE__::handle::handle(handle&& move_) noexcept
+: m_pool{std::exchange(move_.m_pool, nullptr)},
+  m_slot{move_.m_slot},
+  m_items{std::exchange(move_.m_items, nullptr)}
+{
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::handle&
+ARRAY_POOL_CLASS_SCOPE__::handle::operator=(handle&& move_) noexcept
+{
+    if(this != &move_)
+    {
+        reset();
+        m_pool  = std::exchange(move_.m_pool, nullptr);
+        m_slot  = move_.m_slot;
+        m_items = std::exchange(move_.m_items, nullptr);
+    }
+    return *this;
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline ARRAY_POOL_CLASS_SCOPE__::handle::~handle()
+{
+    reset();
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::ArrayType*
+ARRAY_POOL_CLASS_SCOPE__::handle::get() const noexcept
+{
+    return m_items;
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::ArrayType&
+ARRAY_POOL_CLASS_SCOPE__::handle::operator*() const noexcept
+{
+    return *m_items;
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::ArrayType*
+ARRAY_POOL_CLASS_SCOPE__::handle::operator->() const noexcept
+{
+    return m_items;
+}
+
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline ARRAY_POOL_CLASS_SCOPE__::handle::operator bool() const noexcept
+{
+    return m_items != nullptr;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destroy the array and give its slot back to the pool.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline void
+ARRAY_POOL_CLASS_SCOPE__::handle::reset() noexcept
+{
+    if(m_items != nullptr)
+    {
+        std::destroy_at(m_items);
+        m_pool->deallocate(m_slot);
+        m_items = nullptr;
+        m_pool  = nullptr;
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Stop owning the array without destroying it or freeing its slot, which the next
+ *              `array_pool::reset` frees.
+ *
+ * \retval      ArrayType*: Array given up.
+ *************************************************************************************************/
+template<ARRAY_POOL_TEMPLATE_DECLARATION__>
+inline typename ARRAY_POOL_CLASS_SCOPE__::ArrayType*
+ARRAY_POOL_CLASS_SCOPE__::handle::release() noexcept
+{
+    m_pool = nullptr;
+    return std::exchange(m_items, nullptr);
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef ARRAY_POOL_TEMPLATE_DECLARATION__
+#undef ARRAY_POOL_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,103 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+namespace pel
+{
+/**
+ **************************************************************************************************
+ * \brief       Order in which a reduction combines the elements of an array.
+ *
+ * \note        `unordered` reductions split the array over multiple accumulators and SIMD lanes.
+ *              Their order is fixed at compile-time, so they are reproducible for a given build,
+ *              but floating-point results can differ from a left-to-right accumulation and
+ *              between targets with different vector widths.
+ *              `sequential` reductions combine elements strictly from first to last, like
+ *              `std::accumulate`, giving the same floating-point result on every target.
+ *************************************************************************************************/
+enum class reduction_order
+{
+    unordered,
+    sequential,
+};
+
+
+/**
+ **************************************************************************************************
+ * \brief       Type in which `sum` and `dot` accumulate items of type `ItemType` by default.
+ *
+ * \note        Integers narrower than `int` are accumulated as `int`, like `std::accumulate` with
+ *              an `int` initial value, so that sums of small items don't wrap around. Other items,
+ *              floating-point ones included, are accumulated in their own type so that their
+ *              reductions stay vectorized: pass `double` as `ResultType` for wider float sums.
+ *************************************************************************************************/
+template<typename ItemType>
+using reduction_result_t =
+  std::conditional_t<std::is_integral_v<ItemType>, std::common_type_t<ItemType, int>, ItemType>;
+
+
+/*************************************************************************************************/
+/* Reductions ---------------------------------------------------------------------------------- */
+template<reduction_order Order = reduction_order::unordered,
+         typename ResultType   = void,
+         array_operand_type OperandType>
+[[nodiscard]] constexpr auto sum(const OperandType& operand_) noexcept;
+
+template<reduction_order Order = reduction_order::unordered,
+         typename ResultType   = void,
+         array_operand_type LhsType,
+         array_operand_type RhsType>
+[[nodiscard]] constexpr auto dot(const LhsType& lhs_, const RhsType& rhs_) noexcept;
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr auto min(const OperandType& operand_) noexcept;
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr auto max(const OperandType& operand_) noexcept;
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr std::size_t argmin(const OperandType& operand_) noexcept;
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr std::size_t argmax(const OperandType& operand_) noexcept;
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr bool any(const OperandType& mask_) noexcept;
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr bool all(const OperandType& mask_) noexcept;
+
+}        // namespace pel
+
+
+#include "./array_reduce.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,625 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_reduce.hpp"
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+
+/* Number of independent accumulators used by unordered reductions, to hide the latency of the
+ * combining operation */
+constexpr std::size_t array_reduction_accumulators = 4;
+
+
+/*************************************************************************************************/
+/* OPERATIONS ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/* Like the arithmetic operations, these apply to single items and to packs of items. NaNs are
+ * skipped like `std::fmin` and `std::fmax` do: a NaN is only kept against another NaN. */
+namespace operation
+{
+template<typename ItemType>
+struct lane_type
+{
+    using type = ItemType;
+};
+template<typename ItemType>
+requires requires(const ItemType& pack_) { pack_[0]; }
+struct lane_type<ItemType>
+{
+    using type = std::remove_cvref_t<decltype(std::declval<const ItemType&>()[0])>;
+};
+
+struct minimum
+{
+    template<typename ItemType>
+    [[nodiscard]] static constexpr ItemType apply(const ItemType& lhs_,
+                                                  const ItemType& rhs_) noexcept
+    {
+        if constexpr(std::is_floating_point_v<typename lane_type<ItemType>::type>)
+        {
+            return ((rhs_ < lhs_) | (lhs_ != lhs_)) ? rhs_ : lhs_;
+        }
+        else
+        {
+            return (rhs_ < lhs_) ? rhs_ : lhs_;
+        }
+    }
+};
+
+struct maximum
+{
+    template<typename ItemType>
+    [[nodiscard]] static constexpr ItemType apply(const ItemType& lhs_,
+                                                  const ItemType& rhs_) noexcept
+    {
+        if constexpr(std::is_floating_point_v<typename lane_type<ItemType>::type>)
+        {
+            return ((lhs_ < rhs_) | (lhs_ != lhs_)) ? rhs_ : lhs_;
+        }
+        else
+        {
+            return (lhs_ < rhs_) ? rhs_ : lhs_;
+        }
+    }
+};
+}        // namespace operation
+
+
+/*************************************************************************************************/
+/* REDUCTION ENGINE ---------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Combine all the elements of an expression, from first to last.
+ *
+ * \param       expression_: Expression to reduce.
+ *
+ * \retval      Result of `op(...op(op(e[0], e[1]), e[2])..., e[N - 1])`.
+ *************************************************************************************************/
+template<typename Operation, typename ExpressionType>
+[[nodiscard]] constexpr typename ExpressionType::ResultType
+reduce_sequential(const ExpressionType& expression_) noexcept
+{
+    typename ExpressionType::ResultType result = expression_.value(0);
+
+    for(std::size_t i = 1; i < ExpressionType::count; ++i)
+    {
+        result = Operation::apply(result, expression_.value(i));
+    }
+
+    return result;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Combine all the elements of an expression using multiple accumulators.
+ *
+ * \param       expression_: Expression to reduce. `Operation` must be associative and
+ *                           commutative.
+ *
+ * \retval      Combination of all the elements of the expression.
+ *
+ * \note        Outside of constant evaluation, vectorizable items are accumulated in
+ *              `array_reduction_accumulators` independent packs, which are then combined and
+ *              reduced horizontally; the remaining items are folded in one by one.
+ *              All counts are derived from `ExpressionType::count` at compile-time.
+ *************************************************************************************************/
+template<typename Operation, typename ExpressionType>
+[[nodiscard]] constexpr typename ExpressionType::ResultType
+reduce_unordered(const ExpressionType& expression_) noexcept
+{
+    using ItemType = typename ExpressionType::ResultType;
+
+    constexpr std::size_t count = ExpressionType::count;
+    constexpr std::size_t lanes = simd::lanes<ItemType>;
+
+    if constexpr((lanes > 1) && (count >= lanes))
+    {
+        if(!std::is_constant_evaluated())
+        {
+            constexpr std::size_t packCount = count / lanes;
+            constexpr std::size_t accumulatorCount =
+              std::min(array_reduction_accumulators, packCount);
+
+            simd::pack<ItemType> accumulators[accumulatorCount];
+            for(std::size_t a = 0; a < accumulatorCount; ++a)
+            {
+                accumulators[a] = expression_.load(a * lanes);
+            }
+
+            /* Packs past `blockEnd` don't fill a whole block of accumulators */
+            constexpr std::size_t blockEnd = packCount - (packCount % accumulatorCount);
+
+            for(std::size_t pack = accumulatorCount; pack < blockEnd; pack += accumulatorCount)
+            {
+                for(std::size_t a = 0; a < accumulatorCount; ++a)
+                {
+                    accumulators[a] =
+                      Operation::apply(accumulators[a], expression_.load((pack + a) * lanes));
+                }
+            }
+            for(std::size_t pack = blockEnd; pack < packCount; ++pack)
+            {
+                accumulators[0] = Operation::apply(accumulators[0], expression_.load(pack * lanes));
+            }
+
+            /* Combine the accumulators, then the lanes of the last one */
+            for(std::size_t a = 1; a < accumulatorCount; ++a)
+            {
+                accumulators[0] = Operation::apply(accumulators[0], accumulators[a]);
+            }
+
+            ItemType result = accumulators[0][0];
+            for(std::size_t lane = 1; lane < lanes; ++lane)
+            {
+                result = Operation::apply(result, ItemType{accumulators[0][lane]});
+            }
+
+            for(std::size_t i = packCount * lanes; i < count; ++i)
+            {
+                result = Operation::apply(result, expression_.value(i));
+            }
+
+            return result;
+        }
+    }
+
+    /* Scalar path: still break the dependency chain over multiple accumulators */
+    constexpr std::size_t accumulatorCount = std::min(array_reduction_accumulators, count);
+
+    ItemType accumulators[accumulatorCount] = {};
+    for(std::size_t a = 0; a < accumulatorCount; ++a)
+    {
+        accumulators[a] = expression_.value(a);
+    }
+
+    std::size_t i = accumulatorCount;
+    for(; i + accumulatorCount <= count; i += accumulatorCount)
+    {
+        for(std::size_t a = 0; a < accumulatorCount; ++a)
+        {
+            accumulators[a] = Operation::apply(accumulators[a], expression_.value(i + a));
+        }
+    }
+    for(; i < count; ++i)
+    {
+        accumulators[0] = Operation::apply(accumulators[0], expression_.value(i));
+    }
+
+    for(std::size_t a = 1; a < accumulatorCount; ++a)
+    {
+        accumulators[0] = Operation::apply(accumulators[0], accumulators[a]);
+    }
+
+    return accumulators[0];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Add up `Count` terms computed in an accumulator type wider than the items.
+ *
+ * \param       term_: Callable giving term `i` already converted to `AccumulatorType`.
+ *
+ * \retval      Sum of the terms, from first to last for `sequential` reductions.
+ *
+ * \note        Unordered floating-point sums are split over `array_reduction_accumulators`
+ *              accumulators, like `reduce_unordered`. The conversions aren't written with packs,
+ *              whose lane counts differ between the item and accumulator types: integer sums,
+ *              which can be reordered, are vectorized by the compiler instead.
+ *************************************************************************************************/
+template<reduction_order Order, std::size_t Count, typename AccumulatorType, typename TermType>
+[[nodiscard]] constexpr AccumulatorType
+accumulate_widened(const TermType& term_) noexcept
+{
+    /* Integer sums vectorize best from a single accumulator, which the compiler splits itself */
+    constexpr std::size_t accumulatorCount =
+      ((Order == reduction_order::sequential) || std::is_integral_v<AccumulatorType>)
+        ? 1
+        : std::min(array_reduction_accumulators, Count);
+
+    /* Terms past `blockEnd` don't fill a whole block of accumulators */
+    constexpr std::size_t blockEnd = Count - (Count % accumulatorCount);
+
+    AccumulatorType accumulators[accumulatorCount] = {};
+    for(std::size_t i = 0; i < blockEnd; i += accumulatorCount)
+    {
+        for(std::size_t a = 0; a < accumulatorCount; ++a)
+        {
+            accumulators[a] += term_(i + a);
+        }
+    }
+    for(std::size_t i = blockEnd; i < Count; ++i)
+    {
+        accumulators[0] += term_(i);
+    }
+
+    for(std::size_t a = 1; a < accumulatorCount; ++a)
+    {
+        accumulators[0] += accumulators[a];
+    }
+
+    return accumulators[0];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Find the index of the first element of an expression equal to `value_`.
+ *
+ * \param       expression_: Expression to search.
+ * \param       value_:      Value to search for.
+ *
+ * \retval      std::size_t: Index of the first match, or `count` if there is none.
+ *************************************************************************************************/
+template<typename ExpressionType>
+[[nodiscard]] constexpr std::size_t
+find_first(const ExpressionType& expression_, typename ExpressionType::ResultType value_) noexcept
+{
+    using ItemType = typename ExpressionType::ResultType;
+
+    constexpr std::size_t count     = ExpressionType::count;
+    constexpr std::size_t lanes     = simd::lanes<ItemType>;
+    constexpr std::size_t packCount = count / lanes;
+
+    std::size_t i = 0;
+
+    if constexpr(lanes > 1)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            const simd::pack<ItemType> values = simd::broadcast(value_);
+
+            /* Skip whole packs without any match */
+            for(; i < packCount * lanes; i += lanes)
+            {
+                const simd::mask<ItemType> matches = expression_.load(i) == values;
+
+                bool found = false;
+                for(std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    found = found || (matches[lane] != 0);
+                }
+                if(found)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    for(; i < count; ++i)
+    {
+        if(expression_.value(i) == value_)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+
+/*************************************************************************************************/
+/* REDUCTIONS ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Sum of all the elements of an array or expression.
+ *
+ * \tparam      Order:      Order in which the elements are added.
+ *              [defaults : reduction_order::unordered]
+ * \tparam      ResultType: Type in which the elements are accumulated.
+ *              [defaults : reduction_result_t of the item type]
+ * \param       operand_:   Array or expression to sum.
+ *
+ * \retval      Sum of the elements, in `ResultType`.
+ *************************************************************************************************/
+template<reduction_order Order, typename ResultType, array_operand_type OperandType>
+[[nodiscard]] constexpr auto
+sum(const OperandType& operand_) noexcept
+{
+    using Traits          = array_operand_traits<OperandType>;
+    using ItemType        = typename Traits::ValueType;
+    using AccumulatorType = std::
+      conditional_t<std::is_void_v<ResultType>, reduction_result_t<ItemType>, ResultType>;
+
+    const auto expression = as_expression<ItemType, Traits::count>(operand_);
+
+    if constexpr(!std::is_same_v<AccumulatorType, ItemType>)
+    {
+        return accumulate_widened<Order, Traits::count, AccumulatorType>(
+          [&](std::size_t index_)
+          { return static_cast<AccumulatorType>(expression.value(index_)); });
+    }
+    else if constexpr(Order == reduction_order::sequential)
+    {
+        return reduce_sequential<operation::add>(expression);
+    }
+    else
+    {
+        return reduce_unordered<operation::add>(expression);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Dot product of two arrays or expressions.
+ *
+ * \tparam      Order:      Order in which the products are added.
+ *              [defaults : reduction_order::unordered]
+ * \tparam      ResultType: Type in which the products are computed and accumulated.
+ *              [defaults : reduction_result_t of the item type]
+ * \param       lhs_:       Left-hand-side operand.
+ * \param       rhs_:       Right-hand-side operand.
+ *
+ * \retval      Sum of the element-wise products, computed in a single pass.
+ *************************************************************************************************/
+template<reduction_order Order,
+         typename ResultType,
+         array_operand_type LhsType,
+         array_operand_type RhsType>
+[[nodiscard]] constexpr auto
+dot(const LhsType& lhs_, const RhsType& rhs_) noexcept
+{
+    using ItemType        = typename array_operand_traits<LhsType>::ValueType;
+    using AccumulatorType = std::
+      conditional_t<std::is_void_v<ResultType>, reduction_result_t<ItemType>, ResultType>;
+
+    if constexpr(!std::is_same_v<AccumulatorType, ItemType>)
+    {
+        /* Products are widened too, the products of small items overflowing them */
+        using LhsTraits = array_operand_traits<LhsType>;
+        using RhsTraits = array_operand_traits<RhsType>;
+
+        const auto lhs = as_expression<ItemType, LhsTraits::count>(lhs_);
+        const auto rhs = as_expression<typename RhsTraits::ValueType, RhsTraits::count>(rhs_);
+        static_assert(std::is_same_v<ItemType, typename RhsTraits::ValueType>,
+                      "Both sides of a dot product must have the same item type");
+        static_assert(LhsTraits::count == RhsTraits::count,
+                      "Both sides of a dot product must have the same length");
+
+        return accumulate_widened<Order, LhsTraits::count, AccumulatorType>(
+          [&](std::size_t index_)
+          {
+              return operation::keep_type<AccumulatorType>(
+                static_cast<AccumulatorType>(lhs.value(index_))
+                * static_cast<AccumulatorType>(rhs.value(index_)));
+          });
+    }
+    else
+    {
+        return sum<Order, AccumulatorType>(lhs_ * rhs_);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Smallest (`min`) or largest (`max`) element of an array or expression.
+ *
+ * \param       operand_: Array or expression to search.
+ *
+ * \retval      Value of the smallest or largest element.
+ *
+ * \note        NaN elements are skipped, like `std::fmin` and `std::fmax` do: the result is only
+ *              NaN if every element is.
+ *************************************************************************************************/
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr auto
+min(const OperandType& operand_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    return reduce_unordered<operation::minimum>(
+      as_expression<typename Traits::ValueType, Traits::count>(operand_));
+}
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr auto
+max(const OperandType& operand_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    return reduce_unordered<operation::maximum>(
+      as_expression<typename Traits::ValueType, Traits::count>(operand_));
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Index of the first smallest (`argmin`) or largest (`argmax`) element of an array or
+ *              expression.
+ *
+ * \param       operand_: Array or expression to search.
+ *
+ * \retval      std::size_t: Index of the first element equal to the minimum or maximum.
+ *
+ * \note        The value is found with a vectorized reduction, then its index with a vectorized
+ *              search: expressions are therefore evaluated twice.
+ *
+ * \note        NaN elements are skipped like in `min` and `max`. If every element is NaN, the
+ *              index is 0.
+ *************************************************************************************************/
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr std::size_t
+argmin(const OperandType& operand_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    const auto expression = as_expression<typename Traits::ValueType, Traits::count>(operand_);
+
+    const std::size_t index =
+      find_first(expression, reduce_unordered<operation::minimum>(expression));
+
+    /* A NaN extremum, when every element is NaN, is equal to no element */
+    return (index == Traits::count) ? 0 : index;
+}
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr std::size_t
+argmax(const OperandType& operand_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    const auto expression = as_expression<typename Traits::ValueType, Traits::count>(operand_);
+
+    const std::size_t index =
+      find_first(expression, reduce_unordered<operation::maximum>(expression));
+
+    /* A NaN extremum, when every element is NaN, is equal to no element */
+    return (index == Traits::count) ? 0 : index;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Check whether any (`any`) or all (`all`) elements of a mask are set.
+ *
+ * \param       mask_: Comparison expression (ie `a > 0.0f`) or array of `bool`.
+ *
+ * \retval      bool: Whether any or all elements are set.
+ *
+ * \note        Comparison expressions are combined pack by pack with bitwise operations, and the
+ *              lanes are only inspected once at the end.
+ *************************************************************************************************/
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr bool
+any(const OperandType& mask_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    const auto expression = as_expression<typename Traits::ValueType, Traits::count>(mask_);
+    using ExpressionType  = std::remove_const_t<decltype(expression)>;
+    using ItemType        = typename ExpressionType::OperandType;
+
+    static_assert(std::is_same_v<typename ExpressionType::ResultType, bool>,
+                  "pel::any requires a comparison expression or an array of bool");
+
+    constexpr std::size_t count     = ExpressionType::count;
+    constexpr std::size_t lanes     = simd::lanes<ItemType>;
+    constexpr std::size_t packCount = count / lanes;
+
+    if constexpr((lanes > 1) && (packCount > 0))
+    {
+        if(!std::is_constant_evaluated())
+        {
+            simd::mask<ItemType> combined = expression.load(0);
+            for(std::size_t i = lanes; i < packCount * lanes; i += lanes)
+            {
+                combined |= expression.load(i);
+            }
+
+            bool result = false;
+            for(std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                result = result || (combined[lane] != 0);
+            }
+            for(std::size_t i = packCount * lanes; i < count; ++i)
+            {
+                result = result || expression.value(i);
+            }
+
+            return result;
+        }
+    }
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(expression.value(i))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<array_operand_type OperandType>
+[[nodiscard]] constexpr bool
+all(const OperandType& mask_) noexcept
+{
+    using Traits = array_operand_traits<OperandType>;
+
+    const auto expression = as_expression<typename Traits::ValueType, Traits::count>(mask_);
+    using ExpressionType  = std::remove_const_t<decltype(expression)>;
+    using ItemType        = typename ExpressionType::OperandType;
+
+    static_assert(std::is_same_v<typename ExpressionType::ResultType, bool>,
+                  "pel::all requires a comparison expression or an array of bool");
+
+    constexpr std::size_t count     = ExpressionType::count;
+    constexpr std::size_t lanes     = simd::lanes<ItemType>;
+    constexpr std::size_t packCount = count / lanes;
+
+    if constexpr((lanes > 1) && (packCount > 0))
+    {
+        if(!std::is_constant_evaluated())
+        {
+            simd::mask<ItemType> combined = expression.load(0);
+            for(std::size_t i = lanes; i < packCount * lanes; i += lanes)
+            {
+                combined &= expression.load(i);
+            }
+
+            bool result = true;
+            for(std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                result = result && (combined[lane] != 0);
+            }
+            for(std::size_t i = packCount * lanes; i < count; ++i)
+            {
+                result = result && expression.value(i);
+            }
+
+            return result;
+        }
+    }
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(!expression.value(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
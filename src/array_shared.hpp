@@ -0,0 +1,107 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array_policy.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Shared code --------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Size-independent code of the arrays, working on `(items, count)` pairs.
+ *
+ * \note        Each routine is compiled once per item type (and bounds checking policy), whatever
+ *              the number of array sizes using it: the members of `pel::array` are thin shims that
+ *              check their sizes against `ItemCount` and call these with a pointer to their items.
+ *              The routines are kept out of line by `PEL_ARRAY_NOINLINE`, so that every
+ *              instantiation calls the same copy instead of inlining its own.
+ *
+ * \note        The caller is responsible for checking that `count_` items fit in the destination.
+ *************************************************************************************************/
+namespace shared
+{
+/*************************************************************************************************/
+/* Formatting ---------------------------------------------------------------------------------- */
+template<typename IteratorType>
+void print_items(std::ostream& os_, IteratorType items_, std::size_t count_);
+template<typename IteratorType>
+[[nodiscard]] std::string format_items(IteratorType items_, std::size_t count_);
+
+
+/*************************************************************************************************/
+/* Copies and moves between live items --------------------------------------------------------- */
+template<typename ItemType>
+constexpr void copy_items(ItemType* destination_, const ItemType* source_, std::size_t count_);
+template<typename ItemType>
+constexpr void move_items(ItemType* destination_, ItemType* source_, std::size_t count_);
+template<typename ItemType>
+constexpr void fill_items(ItemType* destination_, const ItemType& value_, std::size_t count_);
+
+
+/*************************************************************************************************/
+/* Construction and destruction in uninitialized storage --------------------------------------- */
+template<typename ItemType, typename ProducerType>
+constexpr void construct_items(ItemType*      destination_,
+                               std::size_t    capacity_,
+                               std::size_t    count_,
+                               ProducerType&& producer_);
+
+template<typename ItemType>
+constexpr void construct_defaults(ItemType* destination_, std::size_t capacity_);
+template<typename ItemType>
+constexpr void construct_fill(ItemType*       destination_,
+                              std::size_t     capacity_,
+                              const ItemType& value_);
+template<typename ItemType>
+constexpr void construct_copies(ItemType*       destination_,
+                                std::size_t     capacity_,
+                                const ItemType* source_,
+                                std::size_t     count_);
+template<typename ItemType>
+constexpr void construct_moves(ItemType*   destination_,
+                               std::size_t capacity_,
+                               ItemType*   source_,
+                               std::size_t count_);
+
+template<typename ItemType>
+constexpr void destroy_items(ItemType* items_, std::size_t count_) noexcept;
+}        // namespace shared
+
+}        // namespace pel
+
+
+#include "./array_shared.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,318 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_shared.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace pel
+{
+/* Destroys the items already built by a constructor that throws before building them all */
+template<typename ItemType>
+struct array_construction_guard
+{
+    ItemType*   items;
+    std::size_t built = 0;
+
+    constexpr ~array_construction_guard()
+    {
+        std::destroy_n(items, built);
+    }
+};
+
+namespace shared
+{
+/*************************************************************************************************/
+/* FORMATTING ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Print a length header, then each item on its own line.
+ *
+ * \param       os_:    Output stream to print to.
+ * \param       items_: Pointer or random-access iterator to the first item to print.
+ * \param       count_: Number of items to print.
+ *************************************************************************************************/
+template<typename IteratorType>
+PEL_ARRAY_NOINLINE void
+print_items(std::ostream& os_, IteratorType items_, std::size_t count_)
+{
+    /* Add capacity and length header */
+    os_ << "Length: [" << count_ << "]\n";
+
+    for(std::size_t i = 0; i < count_; ++i)
+    {
+        os_ << items_[static_cast<std::ptrdiff_t>(i)] << '\n';
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Print items to a string, in the format of `print_items`.
+ *
+ * \param       items_: Pointer or random-access iterator to the first item to print.
+ * \param       count_: Number of items to print.
+ *
+ * \retval      std::string: Printed items.
+ *************************************************************************************************/
+template<typename IteratorType>
+[[nodiscard]] PEL_ARRAY_NOINLINE std::string
+format_items(IteratorType items_, std::size_t count_)
+{
+    std::ostringstream os;
+    print_items(os, items_, count_);
+    return os.str();
+}
+
+
+/*************************************************************************************************/
+/* COPIES AND MOVES ---------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Copy-assign `count_` items from `source_` to `destination_`.
+ *
+ * \param       destination_: Pointer to the first item to assign.
+ * \param       source_:      Pointer to the first item to copy.
+ * \param       count_:       Number of items to copy.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+copy_items(ItemType* destination_, const ItemType* source_, std::size_t count_)
+{
+    std::copy_n(source_, count_, destination_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Move-assign `count_` items from `source_` to `destination_`.
+ *
+ * \param       destination_: Pointer to the first item to assign.
+ * \param       source_:      Pointer to the first item to move, left in its moved-from state.
+ * \param       count_:       Number of items to move.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+move_items(ItemType* destination_, ItemType* source_, std::size_t count_)
+{
+    std::move(source_, source_ + count_, destination_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Assign `value_` to `count_` items.
+ *
+ * \param       destination_: Pointer to the first item to assign.
+ * \param       value_:       Value to assign to each item.
+ * \param       count_:       Number of items to assign.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+fill_items(ItemType* destination_, const ItemType& value_, std::size_t count_)
+{
+    std::fill_n(destination_, count_, value_);
+}
+
+
+/*************************************************************************************************/
+/* CONSTRUCTION AND DESTRUCTION ---------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Build the `capacity_` items of uninitialized storage, the first `count_` from the
+ *              results of `producer_`.
+ *
+ * \param       destination_: Pointer to the first item to build.
+ * \param       capacity_:    Number of items to build.
+ * \param       count_:       Number of items to build from `producer_`.
+ * \param       producer_:    Callable taking the index of an item and returning its value, or a
+ *                            reference to the value to copy or move.
+ *
+ * \note        Each item is constructed exactly once, directly from the result of `producer_`, and
+ *              the items after `count_` are value-initialized. The items already built are
+ *              destroyed if a construction throws.
+ *              Items without a default constructor must all come from `producer_`: this is checked
+ *              whatever the bounds checking policy, since the destructor would otherwise destroy
+ *              items that were never built.
+ *
+ * \note        Inlined in its callers, since each producer is a different type. The routines below
+ *              wrap it for the producers that don't depend on the array.
+ *************************************************************************************************/
+template<typename ItemType, typename ProducerType>
+constexpr inline void
+construct_items(ItemType*      destination_,
+                std::size_t    capacity_,
+                std::size_t    count_,
+                ProducerType&& producer_)
+{
+    array_construction_guard<ItemType> guard{destination_};
+    for(; guard.built < count_; ++guard.built)
+    {
+        ItemType* const item = destination_ + guard.built;
+        if(std::is_constant_evaluated())
+        {
+            std::construct_at(item, producer_(guard.built));
+        }
+        else
+        {
+            /* Constructs prvalue results in place, without a temporary to move from */
+            ::new(static_cast<void*>(item)) ItemType(producer_(guard.built));
+        }
+    }
+    if constexpr(std::is_default_constructible_v<ItemType>)
+    {
+        for(; guard.built < capacity_; ++guard.built)
+        {
+            std::construct_at(destination_ + guard.built);
+        }
+    }
+    else
+    {
+        bounds_check::checked::check<std::length_error>(
+          count_ == capacity_, "Items without a default constructor must all be provided");
+    }
+
+    /* The caller owns the items from now on */
+    guard.built = 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Value-initialize the `capacity_` items of uninitialized storage.
+ *
+ * \param       destination_: Pointer to the first item to build.
+ * \param       capacity_:    Number of items to build.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+construct_defaults(ItemType* destination_, std::size_t capacity_)
+{
+    array_construction_guard<ItemType> guard{destination_};
+    for(; guard.built < capacity_; ++guard.built)
+    {
+        std::construct_at(destination_ + guard.built);
+    }
+
+    /* The caller owns the items from now on */
+    guard.built = 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Copy-construct the `capacity_` items of uninitialized storage from `value_`.
+ *
+ * \param       destination_: Pointer to the first item to build.
+ * \param       capacity_:    Number of items to build.
+ * \param       value_:       Value to copy into each item.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+construct_fill(ItemType* destination_, std::size_t capacity_, const ItemType& value_)
+{
+    construct_items(
+      destination_, capacity_, capacity_, [&value_](std::size_t) -> const ItemType&
+      {
+          return value_;
+      });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build the `capacity_` items of uninitialized storage, the first `count_` copied from
+ *              `source_`.
+ *
+ * \param       destination_: Pointer to the first item to build.
+ * \param       capacity_:    Number of items to build.
+ * \param       source_:      Pointer to the first item to copy.
+ * \param       count_:       Number of items to copy.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+construct_copies(ItemType*       destination_,
+                 std::size_t     capacity_,
+                 const ItemType* source_,
+                 std::size_t     count_)
+{
+    construct_items(
+      destination_, capacity_, count_, [source_](std::size_t index_) -> const ItemType&
+      {
+          return source_[index_];
+      });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build the `capacity_` items of uninitialized storage, the first `count_` moved from
+ *              `source_`.
+ *
+ * \param       destination_: Pointer to the first item to build.
+ * \param       capacity_:    Number of items to build.
+ * \param       source_:      Pointer to the first item to move, left in its moved-from state.
+ * \param       count_:       Number of items to move.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+construct_moves(ItemType*   destination_,
+                std::size_t capacity_,
+                ItemType*   source_,
+                std::size_t count_)
+{
+    construct_items(
+      destination_, capacity_, count_, [source_](std::size_t index_) -> ItemType&&
+      {
+          return std::move(source_[index_]);
+      });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destroy `count_` items.
+ *
+ * \param       items_: Pointer to the first item to destroy.
+ * \param       count_: Number of items to destroy.
+ *************************************************************************************************/
+template<typename ItemType>
+PEL_ARRAY_NOINLINE constexpr void
+destroy_items(ItemType* items_, std::size_t count_) noexcept
+{
+    std::destroy_n(items_, count_);
+}
+}        // namespace shared
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
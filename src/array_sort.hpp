@@ -0,0 +1,130 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aligned_array.hpp"
+#include "./array.hpp"
+
+#include <cstddef>
+#include <functional>
+
+
+namespace pel
+{
+/* Arrays of up to this many items are sorted by a sorting network unrolled at compile-time */
+constexpr std::size_t sort_network_limit = 32;
+
+/* Arrays of integers of at least this many items are radix sorted outside of constant evaluation,
+ * when sorted in ascending order */
+constexpr std::size_t radix_sort_threshold = 1024;
+
+
+/*************************************************************************************************/
+/* Sorting and searching ----------------------------------------------------------------------- */
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck,
+         typename CompareType = std::less<>>
+constexpr void sort(array<ItemType, ItemCount, BoundsCheck>& array_, CompareType compare_ = {});
+
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck,
+         typename ValueType,
+         typename CompareType = std::less<>>
+[[nodiscard]] constexpr std::size_t
+lower_bound(const array<ItemType, ItemCount, BoundsCheck>& array_,
+            const ValueType&                               value_,
+            CompareType                                    compare_ = {});
+
+
+/**
+ **************************************************************************************************
+ * \brief       Read-mostly sorted table of `ItemCount` items, stored in Eytzinger (breadth-first)
+ *              order for faster lookups.
+ *
+ * \tparam      ItemType:    Type of the items, which must be default constructible.
+ * \tparam      ItemCount:   Number of items in the table.
+ * \tparam      CompareType: Strict weak ordering of the items.
+ *
+ * \note        A binary search over a sorted array touches a new cache line at each of its last
+ *              steps. In Eytzinger order the children of item `k` are items `2k` and `2k + 1`:
+ *              the top of the tree stays in cache, the search loop has no unpredictable branch,
+ *              and the items a few levels down are contiguous, so they are prefetched ahead.
+ *              The layout is 1-based, the slot 0 being unused.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename CompareType = std::less<>>
+class eytzinger_array
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType = std::size_t;
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+
+    template<typename BoundsCheck>
+    constexpr explicit eytzinger_array(const array<ItemType, ItemCount, BoundsCheck>& items_,
+                                       CompareType compare_ = {});
+
+    /*********************************************************************************************/
+    /* Lookups --------------------------------------------------------------------------------- */
+
+    template<typename ValueType>
+    [[nodiscard]] constexpr const ItemType* lower_bound(const ValueType& value_) const;
+    template<typename ValueType>
+    [[nodiscard]] constexpr bool contains(const ValueType& value_) const;
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    constexpr SizeType lay_out(const ItemType* sorted_, SizeType next_, SizeType node_);
+
+
+    /*********************************************************************************************/
+    /* Private member variables ---------------------------------------------------------------- */
+
+    /* Aligned so that the descendants of an item a few levels down share a cache line */
+    alignas(cache_line_bytes) array<ItemType, ItemCount + 1> m_items;
+
+    [[no_unique_address]] CompareType m_compare;
+};
+
+}        // namespace pel
+
+
+#include "./array_sort.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
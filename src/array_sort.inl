@@ -0,0 +1,445 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_sort.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define EYTZINGER_ARRAY_TEMPLATE_DECLARATION__                                                     \
+    typename ItemType, std::size_t ItemCount, typename CompareType
+#define EYTZINGER_ARRAY_CLASS_SCOPE__ eytzinger_array<ItemType, ItemCount, CompareType>
+
+
+/*************************************************************************************************/
+/* SORTING NETWORKS ---------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Pair of positions a sorting network orders, the smaller item going to `lhs`.
+ *************************************************************************************************/
+struct sort_comparator
+{
+    std::uint8_t lhs;
+    std::uint8_t rhs;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Visit the comparators of Batcher's odd-even merge sort of `count_` items, stage by
+ *              stage.
+ *
+ * \param       count_:  Number of items to sort, which doesn't need to be a power of two.
+ * \param       visitor_: Called with the positions of each comparator.
+ *
+ * \note        Up to 8 items, these networks are as small as the best known ones, and stay within
+ *              4 comparators of them up to 16 items. Comparators of the same stage are independent,
+ *              which lets them execute in parallel.
+ *************************************************************************************************/
+template<typename VisitorType>
+constexpr void
+visit_sort_network(std::size_t count_, VisitorType&& visitor_)
+{
+    for(std::size_t p = 1; p < count_; p *= 2)
+    {
+        for(std::size_t k = p; k >= 1; k /= 2)
+        {
+            for(std::size_t j = k % p; j + k < count_; j += 2 * k)
+            {
+                for(std::size_t i = 0; i < std::min(k, count_ - j - k); ++i)
+                {
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        visitor_(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<std::size_t ItemCount>
+[[nodiscard]] consteval std::size_t
+sort_network_size()
+{
+    std::size_t size = 0;
+    visit_sort_network(ItemCount, [&size](std::size_t, std::size_t) { ++size; });
+    return size;
+}
+
+template<std::size_t ItemCount>
+[[nodiscard]] consteval auto
+make_sort_network()
+{
+    array<sort_comparator, sort_network_size<ItemCount>()> network{};
+
+    std::size_t next = 0;
+    visit_sort_network(ItemCount,
+                       [&](std::size_t lhs_, std::size_t rhs_)
+                       {
+                           network[next++] = sort_comparator{static_cast<std::uint8_t>(lhs_),
+                                                             static_cast<std::uint8_t>(rhs_)};
+                       });
+    return network;
+}
+
+template<std::size_t ItemCount>
+constexpr auto sort_network = make_sort_network<ItemCount>();
+
+
+/**
+ **************************************************************************************************
+ * \brief       Order two items, the smaller one going to `lhs_`.
+ *
+ * \note        Arithmetic items are selected rather than swapped under a branch: the selects
+ *              lower to `min`/`max` or conditional moves, so the network runs without a single
+ *              mispredicted branch whatever the data.
+ *************************************************************************************************/
+template<typename ItemType, typename CompareType>
+constexpr void
+compare_exchange(ItemType& lhs_, ItemType& rhs_, CompareType& compare_)
+{
+    if constexpr(std::is_arithmetic_v<ItemType>)
+    {
+        const ItemType lhs = lhs_;
+        const ItemType rhs = rhs_;
+
+        /* Both selections test the same comparison, so that tied or unordered items (NaN) are
+         * both kept. Written as two selections matching the `min` and `max` patterns rather than
+         * a branch on the comparison, which compilers tend to keep */
+        lhs_ = compare_(rhs, lhs) ? rhs : lhs;
+        rhs_ = compare_(rhs, lhs) ? lhs : rhs;
+    }
+    else if(compare_(rhs_, lhs_))
+    {
+        std::ranges::swap(lhs_, rhs_);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Sort `ItemCount` items with the sorting network of that size, fully unrolled.
+ *************************************************************************************************/
+template<std::size_t ItemCount, typename ItemType, typename CompareType>
+constexpr void
+network_sort(ItemType* items_, CompareType& compare_)
+{
+    constexpr const auto& network = sort_network<ItemCount>;
+
+    [&]<std::size_t... Comparator>(std::index_sequence<Comparator...>)
+    {
+        (compare_exchange(
+           items_[network[Comparator].lhs], items_[network[Comparator].rhs], compare_),
+         ...);
+    }(std::make_index_sequence<network.size()>{});
+}
+
+
+/*************************************************************************************************/
+/* RADIX SORT ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<typename ItemType, typename CompareType>
+constexpr bool is_radix_sortable =
+  std::is_integral_v<ItemType> && !std::is_same_v<ItemType, bool>
+  && (std::is_same_v<CompareType, std::less<>> || std::is_same_v<CompareType, std::less<ItemType>>);
+
+/**
+ **************************************************************************************************
+ * \brief       Sort integers in ascending order, one byte at a time from the least significant.
+ *
+ * \param       items_: Items to sort.
+ * \param       count_: Number of items to sort.
+ *
+ * \note        Each pass is a stable counting sort into a scratch buffer of `count_` items. A pass
+ *              is skipped when all the items share the same byte, as the high bytes of small
+ *              values do. Signed items have their sign bit flipped to order negative values first.
+ *************************************************************************************************/
+template<typename ItemType>
+void
+radix_sort(ItemType* items_, std::size_t count_)
+{
+    using KeyType = std::make_unsigned_t<ItemType>;
+
+    constexpr KeyType signBit =
+      std::is_signed_v<ItemType> ? static_cast<KeyType>(KeyType{1} << (sizeof(ItemType) * 8 - 1))
+                                 : KeyType{0};
+
+    std::unique_ptr<ItemType[]> buffer = std::make_unique_for_overwrite<ItemType[]>(count_);
+
+    ItemType* source = items_;
+    ItemType* target = buffer.get();
+    for(std::size_t shift = 0; shift < sizeof(ItemType) * 8; shift += 8)
+    {
+        const auto digit = [shift](ItemType item_)
+        {
+            const KeyType key = static_cast<KeyType>(static_cast<KeyType>(item_) ^ signBit);
+            return static_cast<std::size_t>(key >> shift) & 0xFFU;
+        };
+
+        std::size_t offsets[256] = {};
+        for(std::size_t i = 0; i < count_; ++i)
+        {
+            ++offsets[digit(source[i])];
+        }
+        if(offsets[digit(source[0])] == count_)
+        {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for(std::size_t& bucket : offsets)
+        {
+            offset += std::exchange(bucket, offset);
+        }
+        for(std::size_t i = 0; i < count_; ++i)
+        {
+            target[offsets[digit(source[i])]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+
+    if(source != items_)
+    {
+        std::copy_n(source, count_, items_);
+    }
+}
+
+
+/*************************************************************************************************/
+/* SORTING AND SEARCHING ----------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Sort the items of an array.
+ *
+ * \param       array_:   Array to sort.
+ * \param       compare_: Strict weak ordering of the items, ascending by default.
+ *
+ * \note        The algorithm is chosen from `ItemCount` at compile-time:
+ *              up to `sort_network_limit` items, an unrolled sorting network;
+ *              from `radix_sort_threshold` integers sorted in ascending order, a radix sort
+ *              (introsort during constant evaluation, as the radix sort uses a heap buffer);
+ *              otherwise, an introsort (`std::sort`).
+ *              The sort is not stable.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, typename CompareType>
+constexpr void
+sort(array<ItemType, ItemCount, BoundsCheck>& array_, CompareType compare_)
+{
+    if constexpr(ItemCount <= sort_network_limit)
+    {
+        network_sort<ItemCount>(array_.data(), compare_);
+    }
+    else
+    {
+        if constexpr((ItemCount >= radix_sort_threshold)
+                     && is_radix_sortable<ItemType, CompareType>)
+        {
+            if(!std::is_constant_evaluated())
+            {
+                radix_sort(array_.data(), ItemCount);
+                return;
+            }
+        }
+        std::sort(array_.data(), array_.data() + ItemCount, compare_);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Index of the first item of a sorted array that isn't ordered before `value_`.
+ *
+ * \param       array_:   Array sorted according to `compare_`.
+ * \param       value_:   Value to search for.
+ * \param       compare_: Strict weak ordering of the items, ascending by default.
+ *
+ * \retval      std::size_t: Index of the first item `i` for which `!compare_(item, value_)`,
+ *                           `ItemCount` if there is none.
+ *
+ * \note        The search range is halved at every step whatever the comparison, its base moving
+ *              by the comparison result times half the range: there is no branch to mispredict.
+ *              The number of steps only depends on `ItemCount`.
+ *************************************************************************************************/
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck,
+         typename ValueType,
+         typename CompareType>
+[[nodiscard]] constexpr std::size_t
+lower_bound(const array<ItemType, ItemCount, BoundsCheck>& array_,
+            const ValueType&                               value_,
+            CompareType                                    compare_)
+{
+    if constexpr(ItemCount == 0)
+    {
+        return 0;
+    }
+    else
+    {
+        const ItemType* base = array_.data();
+        for(std::size_t length = ItemCount; length > 1;)
+        {
+            const std::size_t half = length / 2;
+
+            base += static_cast<std::size_t>(compare_(base[half - 1], value_)) * half;
+            length -= half;
+        }
+
+        return static_cast<std::size_t>(base - array_.data())
+               + static_cast<std::size_t>(compare_(*base, value_));
+    }
+}
+
+
+/*************************************************************************************************/
+/* EYTZINGER ARRAY ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a lookup table holding the items of an array.
+ *
+ * \param       items_:   Items of the table, in any order.
+ * \param       compare_: Strict weak ordering of the items.
+ *************************************************************************************************/
+template<EYTZINGER_ARRAY_TEMPLATE_DECLARATION__>
+template<typename BoundsCheck>
+constexpr EYTZINGER_ARRAY_CLASS_SCOPE__::eytzinger_array(
+  const array<ItemType, ItemCount, BoundsCheck>& items_, CompareType compare_)
+: m_items{}, m_compare{compare_}
+{
+    /* On the heap, as lookup tables can be larger than the stack */
+    std::vector<ItemType> sorted(items_.begin(), items_.end());
+    std::sort(sorted.begin(), sorted.end(), m_compare);
+
+    lay_out(sorted.data(), 0, 1);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Find the first item of the table, in sorted order, not ordered before `value_`.
+ *
+ * \param       value_: Value to search for.
+ *
+ * \retval      const ItemType*: Pointer to that item, `nullptr` if every item is ordered before
+ *                               `value_`.
+ *
+ * \note        The search descends to a leaf, going right whenever the item is ordered before
+ *              `value_`; the trailing right turns are then undone, leaving the last item where it
+ *              went left. The items a cache line below are prefetched at each step.
+ *************************************************************************************************/
+template<EYTZINGER_ARRAY_TEMPLATE_DECLARATION__>
+template<typename ValueType>
+[[nodiscard]] constexpr const ItemType*
+EYTZINGER_ARRAY_CLASS_SCOPE__::lower_bound(const ValueType& value_) const
+{
+    /* Descendants of node `k` at this depth are the `prefetchStride` nodes from `k * stride` */
+    constexpr SizeType prefetchStride = std::bit_floor(std::max<SizeType>(
+      cache_line_bytes / sizeof(ItemType), 1));
+
+    SizeType node = 1;
+    while(node <= ItemCount)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if(!std::is_constant_evaluated() && (node * prefetchStride <= ItemCount))
+        {
+            __builtin_prefetch(m_items.data() + node * prefetchStride);
+        }
+#endif
+        node = 2 * node + static_cast<SizeType>(m_compare(m_items.unchecked(node), value_));
+    }
+    node >>= std::countr_one(node) + 1;
+
+    return (node == 0) ? nullptr : m_items.data() + node;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Check whether an item of the table is equivalent to `value_`.
+ *************************************************************************************************/
+template<EYTZINGER_ARRAY_TEMPLATE_DECLARATION__>
+template<typename ValueType>
+[[nodiscard]] constexpr bool
+EYTZINGER_ARRAY_CLASS_SCOPE__::contains(const ValueType& value_) const
+{
+    const ItemType* item = lower_bound(value_);
+    return (item != nullptr) && !m_compare(value_, *item);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Number of items in the table.
+ *************************************************************************************************/
+template<EYTZINGER_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename EYTZINGER_ARRAY_CLASS_SCOPE__::SizeType
+EYTZINGER_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return ItemCount;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Store the sorted items from `next_` in the subtree rooted at `node_`, in order.
+ *
+ * \retval      SizeType: Index of the next sorted item to store.
+ *************************************************************************************************/
+template<EYTZINGER_ARRAY_TEMPLATE_DECLARATION__>
+constexpr typename EYTZINGER_ARRAY_CLASS_SCOPE__::SizeType
+EYTZINGER_ARRAY_CLASS_SCOPE__::lay_out(const ItemType* sorted_, SizeType next_, SizeType node_)
+{
+    if(node_ <= ItemCount)
+    {
+        next_                    = lay_out(sorted_, next_, 2 * node_);
+        m_items.unchecked(node_) = sorted_[next_++];
+        next_                    = lay_out(sorted_, next_, 2 * node_ + 1);
+    }
+    return next_;
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef EYTZINGER_ARRAY_TEMPLATE_DECLARATION__
+#undef EYTZINGER_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
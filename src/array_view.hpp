@@ -0,0 +1,391 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* View extent --------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Length of a view: empty when known at compile-time, stored otherwise.
+ *************************************************************************************************/
+template<std::size_t Extent>
+class view_extent
+{
+public:
+    constexpr view_extent() noexcept = default;
+    constexpr explicit view_extent(std::size_t /* size_ */) noexcept
+    {
+    }
+
+    [[nodiscard]] static constexpr std::size_t value() noexcept
+    {
+        return Extent;
+    }
+};
+
+template<>
+class view_extent<dynamic_extent>
+{
+public:
+    constexpr view_extent() noexcept = default;
+    constexpr explicit view_extent(std::size_t size_) noexcept : m_size{size_}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t value() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+    std::size_t m_size = 0;
+};
+
+
+/*************************************************************************************************/
+/* Contiguous view ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Non-owning view over contiguous items of a `pel::array` (or any other contiguous
+ *              storage).
+ *
+ * \tparam      ItemType:    Type of the items, `const`-qualified for read-only views.
+ * \tparam      Extent:      Number of items known at compile-time, or `dynamic_extent`.
+ * \tparam      BoundsCheck: Policy applied to the creation of sub-views, and through
+ *                           `BoundsCheck::subscript` to `operator[]`.
+ *
+ * \note        Like `std::span`, the view is a pointer (and a length, for dynamic extents):
+ *              copying it never copies the items, its accessors are `const` and give access to
+ *              the viewed items, and assigning a view to another rebinds it.
+ *
+ * \note        Views with a compile-time extent are array operands: they can be read by array
+ *              expressions and reductions (ie `pel::sum(arr.slice<64>(offset))`), and array
+ *              expressions can be evaluated into them.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t Extent, typename BoundsCheck>
+class array_view
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType        = std::size_t;
+    using DifferenceType  = std::ptrdiff_t;
+    using ValueType       = std::remove_cv_t<ItemType>;
+    using IteratorType    = array_iterator<ItemType>;
+    using RIteratorType   = typename IteratorType::ReverseIteratorType;
+    using BoundsCheckType = BoundsCheck;
+
+    static constexpr SizeType extent = Extent;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr array_view() noexcept requires(Extent == dynamic_extent || Extent == 0) = default;
+    constexpr explicit(Extent != dynamic_extent)
+      array_view(ItemType* data_, SizeType count_) noexcept(BoundsCheck::nothrow);
+
+    template<SizeType OtherCount, typename OtherBoundsCheck>
+    requires(Extent == dynamic_extent || Extent == OtherCount)
+    constexpr array_view(array<ValueType, OtherCount, OtherBoundsCheck>& array_) noexcept;
+    template<SizeType OtherCount, typename OtherBoundsCheck>
+    requires(std::is_const_v<ItemType> && (Extent == dynamic_extent || Extent == OtherCount))
+    constexpr array_view(const array<ValueType, OtherCount, OtherBoundsCheck>& array_) noexcept;
+
+    template<typename OtherItemType, SizeType OtherExtent>
+    requires(std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+             && (Extent == dynamic_extent || Extent == OtherExtent))
+    constexpr array_view(
+      const array_view<OtherItemType, OtherExtent, BoundsCheck>& other_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Operators ------------------------------------------------------------------------------- */
+    template<array_expression_type ExpressionType>
+    requires(Extent != dynamic_extent && !std::is_const_v<ItemType>)
+    constexpr const array_view& operator=(const ExpressionType& expression_) const
+      noexcept(Extent * sizeof(ItemType) <= array_expression_max_stack_bytes);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType  begin() const noexcept;
+    [[nodiscard]] constexpr IteratorType  end() const noexcept;
+    [[nodiscard]] constexpr RIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ItemType& operator[](SizeType index_) const
+      noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr ItemType& at(SizeType index_) const;
+    [[nodiscard]] constexpr ItemType& unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ItemType& front() const noexcept;
+    [[nodiscard]] constexpr ItemType& back() const noexcept;
+    [[nodiscard]] constexpr ItemType* data() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Sub-views ------------------------------------------------------------------------------- */
+    using ViewType = array_view<ItemType, dynamic_extent, BoundsCheck>;
+
+    template<SizeType Offset, SizeType Count = Extent - Offset>
+    requires(Extent != dynamic_extent)
+    [[nodiscard]] constexpr array_view<ItemType, Count, BoundsCheck> subarray() const noexcept;
+
+    [[nodiscard]] constexpr ViewType slice(SizeType offset_, SizeType count_) const;
+    template<SizeType Count>
+    [[nodiscard]] constexpr array_view<ItemType, Count, BoundsCheck> slice(SizeType offset_) const;
+
+    [[nodiscard]] constexpr strided_view<ItemType, BoundsCheck> strided(SizeType step_,
+                                                                        SizeType offset_ = 0) const;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] constexpr SizeType length() const noexcept;
+    [[nodiscard]] constexpr SizeType size() const noexcept;
+    [[nodiscard]] constexpr bool     empty() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    ItemType*                                 m_data = nullptr;
+    [[no_unique_address]] view_extent<Extent> m_size;
+};
+
+template<typename ItemType, std::size_t Extent, typename BoundsCheck>
+requires(Extent != dynamic_extent)
+constexpr bool is_array<array_view<ItemType, Extent, BoundsCheck>> = true;
+
+
+/*************************************************************************************************/
+/* Strided view -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Random-access iterator over every `stride`-th item of a contiguous storage.
+ *
+ * \note        The iterator keeps the index of its item rather than a pointer to it, so that the
+ *              end iterator of a view never points past the end of the viewed storage.
+ *************************************************************************************************/
+template<typename ItemType>
+class strided_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type        = std::remove_cv_t<ItemType>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = ItemType*;
+    using reference         = ItemType&;
+
+    using ReverseIteratorType = std::reverse_iterator<strided_iterator>;
+
+    constexpr strided_iterator() noexcept = default;
+    constexpr strided_iterator(ItemType* data_, difference_type index_, difference_type stride_)
+      noexcept
+    : m_data{data_}, m_index{index_}, m_stride{stride_}
+    {
+    }
+
+    [[nodiscard]] constexpr ItemType& operator*() const noexcept
+    {
+        return m_data[m_index * m_stride];
+    }
+    [[nodiscard]] constexpr ItemType* operator->() const noexcept
+    {
+        return m_data + (m_index * m_stride);
+    }
+    [[nodiscard]] constexpr ItemType& operator[](difference_type offset_) const noexcept
+    {
+        return m_data[(m_index + offset_) * m_stride];
+    }
+
+    constexpr strided_iterator& operator++() noexcept
+    {
+        ++m_index;
+        return *this;
+    }
+    constexpr strided_iterator operator++(int) noexcept
+    {
+        strided_iterator previous = *this;
+        ++m_index;
+        return previous;
+    }
+    constexpr strided_iterator& operator--() noexcept
+    {
+        --m_index;
+        return *this;
+    }
+    constexpr strided_iterator operator--(int) noexcept
+    {
+        strided_iterator previous = *this;
+        --m_index;
+        return previous;
+    }
+
+    constexpr strided_iterator& operator+=(difference_type offset_) noexcept
+    {
+        m_index += offset_;
+        return *this;
+    }
+    constexpr strided_iterator& operator-=(difference_type offset_) noexcept
+    {
+        m_index -= offset_;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr strided_iterator operator+(strided_iterator it_,
+                                                              difference_type  offset_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr strided_iterator operator+(difference_type  offset_,
+                                                              strided_iterator it_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr strided_iterator operator-(strided_iterator it_,
+                                                              difference_type  offset_) noexcept
+    {
+        return it_ -= offset_;
+    }
+    [[nodiscard]] friend constexpr difference_type
+    operator-(const strided_iterator& lhs_, const strided_iterator& rhs_) noexcept
+    {
+        return lhs_.m_index - rhs_.m_index;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const strided_iterator& other_) const noexcept
+    {
+        return m_index == other_.m_index;
+    }
+    [[nodiscard]] constexpr auto operator<=>(const strided_iterator& other_) const noexcept
+    {
+        return m_index <=> other_.m_index;
+    }
+
+private:
+    ItemType*       m_data   = nullptr;
+    difference_type m_index  = 0;
+    difference_type m_stride = 1;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Non-owning view over every `stride`-th item of a contiguous storage, ie one
+ *              channel of interleaved data.
+ *
+ * \note        The items of the view are not contiguous: the view has no `data()` and can't be
+ *              used in array expressions, but its iterators work with the standard algorithms.
+ *************************************************************************************************/
+template<typename ItemType, typename BoundsCheck>
+class strided_view
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType        = std::size_t;
+    using DifferenceType  = std::ptrdiff_t;
+    using ValueType       = std::remove_cv_t<ItemType>;
+    using IteratorType    = strided_iterator<ItemType>;
+    using RIteratorType   = typename IteratorType::ReverseIteratorType;
+    using BoundsCheckType = BoundsCheck;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr strided_view() noexcept = default;
+    constexpr strided_view(ItemType* data_, SizeType count_, SizeType stride_) noexcept;
+
+    template<typename OtherItemType>
+    requires std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+    constexpr strided_view(const strided_view<OtherItemType, BoundsCheck>& other_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType  begin() const noexcept;
+    [[nodiscard]] constexpr IteratorType  end() const noexcept;
+    [[nodiscard]] constexpr RIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ItemType& operator[](SizeType index_) const
+      noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr ItemType& at(SizeType index_) const;
+    [[nodiscard]] constexpr ItemType& unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ItemType& front() const noexcept;
+    [[nodiscard]] constexpr ItemType& back() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] constexpr SizeType length() const noexcept;
+    [[nodiscard]] constexpr SizeType size() const noexcept;
+    [[nodiscard]] constexpr SizeType stride() const noexcept;
+    [[nodiscard]] constexpr bool     empty() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    template<typename, typename>
+    friend class strided_view;
+
+    ItemType* m_data   = nullptr;
+    SizeType  m_size   = 0;
+    SizeType  m_stride = 1;
+};
+
+}        // namespace pel
+
+
+#include "./array_view.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,633 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./array_view.hpp"
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define ARRAY_VIEW_TEMPLATE_DECLARATION__                                                          \
+    typename ItemType, std::size_t Extent, typename BoundsCheck
+#define ARRAY_VIEW_CLASS_SCOPE__ array_view<ItemType, Extent, BoundsCheck>
+
+#define STRIDED_VIEW_TEMPLATE_DECLARATION__ typename ItemType, typename BoundsCheck
+#define STRIDED_VIEW_CLASS_SCOPE__          strided_view<ItemType, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* ARRAY VIEW ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Item type and length of a view operand with a compile-time extent.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+requires(Extent != dynamic_extent)
+struct array_operand_traits<ARRAY_VIEW_CLASS_SCOPE__>
+{
+    using ValueType = std::remove_cv_t<ItemType>;
+
+    static constexpr std::size_t count = Extent;
+};
+
+
+/*************************************************************************************************/
+/* Constructors -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor viewing `count_` contiguous items.
+ *
+ * \param       data_:  Pointer to the first item of the view.
+ * \param       count_: Number of items in the view, which must be `Extent` for static extents.
+ *
+ * \throws      std::length_error if `count_` doesn't match a static extent and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+constexpr ARRAY_VIEW_CLASS_SCOPE__::array_view(ItemType* data_, SizeType count_) noexcept(
+  BoundsCheck::nothrow)
+: m_data{data_}, m_size{count_}
+{
+    BoundsCheck::template check<std::length_error>(
+      (Extent == dynamic_extent) || (count_ == Extent), "View length doesn't match its extent");
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor viewing every item of an array.
+ *
+ * \param       array_: Array to view, which must outlive the view.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<std::size_t OtherCount, typename OtherBoundsCheck>
+requires(Extent == dynamic_extent || Extent == OtherCount)
+constexpr ARRAY_VIEW_CLASS_SCOPE__::array_view(
+  array<ValueType, OtherCount, OtherBoundsCheck>& array_) noexcept
+: m_data{array_.data()}, m_size{OtherCount}
+{
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<std::size_t OtherCount, typename OtherBoundsCheck>
+requires(std::is_const_v<ItemType> && (Extent == dynamic_extent || Extent == OtherCount))
+constexpr ARRAY_VIEW_CLASS_SCOPE__::array_view(
+  const array<ValueType, OtherCount, OtherBoundsCheck>& array_) noexcept
+: m_data{array_.data()}, m_size{OtherCount}
+{
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Converting constructor, from a mutable view to a read-only one, or from a static
+ *              extent to a dynamic one.
+ *
+ * \param       other_: View to copy.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<typename OtherItemType, std::size_t OtherExtent>
+requires(std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+         && (Extent == dynamic_extent || Extent == OtherExtent))
+constexpr ARRAY_VIEW_CLASS_SCOPE__::array_view(
+  const array_view<OtherItemType, OtherExtent, BoundsCheck>& other_) noexcept
+: m_data{other_.data()}, m_size{other_.size()}
+{
+}
+
+
+/*************************************************************************************************/
+/* Operators ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Evaluate an array expression into the viewed items, in a single pass.
+ *
+ * \param       expression_: Element-wise expression to evaluate into the viewed items.
+ *
+ * \retval      const array_view&: Reference to this view.
+ *
+ * \note        Unlike copy assignment, which rebinds the view, this writes through the view.
+ *
+ * \throws      std::bad_alloc if the expression needs a temporary buffer that can't be allocated.
+ *
+ * \note        When the expression reads the viewed items at other indexes than their own, ie
+ *              `items.slice<7>(1) = items.slice<7>(0) + 1`, it is evaluated from the end of the
+ *              view, so that no item is overwritten before being read. Only expressions reading
+ *              the viewed items both before and after their own index go through a temporary
+ *              buffer, on the heap above `array_expression_max_stack_bytes`.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<array_expression_type ExpressionType>
+requires(Extent != dynamic_extent && !std::is_const_v<ItemType>)
+constexpr const ARRAY_VIEW_CLASS_SCOPE__&
+ARRAY_VIEW_CLASS_SCOPE__::operator=(const ExpressionType& expression_) const
+  noexcept(Extent * sizeof(ItemType) <= array_expression_max_stack_bytes)
+{
+    static_assert(ExpressionType::count == Extent,
+                  "An array expression must be assigned to a view of the same length");
+
+    evaluate_overlapping(m_data, expression_);
+    return *this;
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first or past the last item of the view.
+ *
+ * \retval      IteratorType: Iterator pointing to the first item, or past the last item.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::IteratorType
+ARRAY_VIEW_CLASS_SCOPE__::begin() const noexcept
+{
+    return IteratorType{m_data};
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::IteratorType
+ARRAY_VIEW_CLASS_SCOPE__::end() const noexcept
+{
+    return IteratorType{m_data + size()};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a reverse iterator to the last or before the first item of the view.
+ *
+ * \retval      RIteratorType: Reverse iterator pointing to the last item, or before the first.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::RIteratorType
+ARRAY_VIEW_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::RIteratorType
+ARRAY_VIEW_CLASS_SCOPE__::rend() const noexcept
+{
+    return RIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view, checked according to the `BoundsCheck` policy.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_VIEW_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < size(),
+                                                              "Index out of view bounds");
+    return m_data[index_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view, always checking its bounds.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds, whatever the policy.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_VIEW_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < size(), "Index out of view bounds");
+    return m_data[index_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view without bounds checking, whatever the policy.
+ *
+ * \param       index_: Index of the item to access, which must be lower than `size()`.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_VIEW_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return m_data[index_];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the first or the last item of a non-empty view.
+ *
+ * \retval      ItemType&: Reference to the first or the last item.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_VIEW_CLASS_SCOPE__::front() const noexcept
+{
+    return m_data[0];
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+ARRAY_VIEW_CLASS_SCOPE__::back() const noexcept
+{
+    return m_data[size() - 1];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a pointer to the first item of the view.
+ *
+ * \retval      ItemType*: Pointer to the first item of the view.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType*
+ARRAY_VIEW_CLASS_SCOPE__::data() const noexcept
+{
+    return m_data;
+}
+
+
+/*************************************************************************************************/
+/* Sub-views ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `Count` items starting at `Offset`, both known at compile-time.
+ *
+ * \tparam      Offset: Index of the first item of the sub-view.
+ * \tparam      Count:  Number of items in the sub-view.
+ *              [defaults : every item from `Offset` to the end of the view]
+ *
+ * \retval      array_view<ItemType, Count, BoundsCheck>: Sub-view of this view.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<std::size_t Offset, std::size_t Count>
+requires(Extent != dynamic_extent)
+[[nodiscard]] constexpr inline array_view<ItemType, Count, BoundsCheck>
+ARRAY_VIEW_CLASS_SCOPE__::subarray() const noexcept
+{
+    static_assert(Offset <= Extent && Count <= Extent - Offset, "A subarray must fit in its view");
+
+    return array_view<ItemType, Count, BoundsCheck>{m_data + Offset, Count};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `count_` items starting at `offset_`, checked according to the
+ *              `BoundsCheck` policy.
+ *
+ * \param       offset_: Index of the first item of the sub-view.
+ * \param       count_:  Number of items in the sub-view.
+ *
+ * \retval      ViewType: Sub-view of this view.
+ *
+ * \throws      std::out_of_range if the slice doesn't fit in the view and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::ViewType
+ARRAY_VIEW_CLASS_SCOPE__::slice(SizeType offset_, SizeType count_) const
+{
+    BoundsCheck::template check<std::out_of_range>(
+      (offset_ <= size()) && (count_ <= size() - offset_), "Slice out of view bounds");
+
+    return ViewType{m_data + offset_, count_};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over `Count` items, known at compile-time, starting at `offset_`.
+ *
+ * \tparam      Count:   Number of items in the sub-view.
+ * \param       offset_: Index of the first item of the sub-view.
+ *
+ * \retval      array_view<ItemType, Count, BoundsCheck>: Sub-view of this view.
+ *
+ * \throws      std::out_of_range if the slice doesn't fit in the view and the policy throws.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+template<std::size_t Count>
+[[nodiscard]] constexpr inline array_view<ItemType, Count, BoundsCheck>
+ARRAY_VIEW_CLASS_SCOPE__::slice(SizeType offset_) const
+{
+    static_assert(Extent == dynamic_extent || Count <= Extent, "A slice must fit in its view");
+    BoundsCheck::template check<std::out_of_range>(
+      (Count <= size()) && (offset_ <= size() - Count), "Slice out of view bounds");
+
+    return array_view<ItemType, Count, BoundsCheck>{m_data + offset_, Count};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over every `step_`-th item, starting at `offset_`.
+ *
+ * \param       step_:   Distance between two items of the sub-view, greater than 0.
+ * \param       offset_: Index of the first item of the sub-view.
+ *              [defaults : 0]
+ *
+ * \retval      strided_view<ItemType, BoundsCheck>: Strided view over the items of this view.
+ *
+ * \throws      std::out_of_range if `offset_` is past the end of the view or `step_` is 0, and
+ *              the policy throws.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline strided_view<ItemType, BoundsCheck>
+ARRAY_VIEW_CLASS_SCOPE__::strided(SizeType step_, SizeType offset_) const
+{
+    BoundsCheck::template check<std::out_of_range>((step_ > 0) && (offset_ <= size()),
+                                                   "Strided view out of view bounds");
+
+    const SizeType count = (offset_ < size()) ? ((size() - offset_ - 1) / step_) + 1 : 0;
+    return strided_view<ItemType, BoundsCheck>{m_data + offset_, count, step_};
+}
+
+
+/*************************************************************************************************/
+/* Size ---------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of items in the view.
+ *
+ * \retval      SizeType: `Extent` for static extents, the viewed length otherwise.
+ *************************************************************************************************/
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::SizeType
+ARRAY_VIEW_CLASS_SCOPE__::length() const noexcept
+{
+    return m_size.value();
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename ARRAY_VIEW_CLASS_SCOPE__::SizeType
+ARRAY_VIEW_CLASS_SCOPE__::size() const noexcept
+{
+    return m_size.value();
+}
+
+template<ARRAY_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+ARRAY_VIEW_CLASS_SCOPE__::empty() const noexcept
+{
+    return m_size.value() == 0;
+}
+
+
+/*************************************************************************************************/
+/* STRIDED VIEW -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor viewing `count_` items, `stride_` items apart.
+ *
+ * \param       data_:   Pointer to the first item of the view.
+ * \param       count_:  Number of items in the view.
+ * \param       stride_: Distance between two items of the view, greater than 0.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+constexpr STRIDED_VIEW_CLASS_SCOPE__::strided_view(ItemType* data_,
+                                                   SizeType  count_,
+                                                   SizeType  stride_) noexcept
+: m_data{data_}, m_size{count_}, m_stride{stride_}
+{
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Converting constructor, from a mutable view to a read-only one.
+ *
+ * \param       other_: View to copy.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+template<typename OtherItemType>
+requires std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+constexpr STRIDED_VIEW_CLASS_SCOPE__::strided_view(
+  const strided_view<OtherItemType, BoundsCheck>& other_) noexcept
+: m_data{other_.m_data}, m_size{other_.m_size}, m_stride{other_.m_stride}
+{
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first or past the last item of the view.
+ *
+ * \retval      IteratorType: Iterator pointing to the first item, or past the last item.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::IteratorType
+STRIDED_VIEW_CLASS_SCOPE__::begin() const noexcept
+{
+    return IteratorType{m_data, 0, static_cast<DifferenceType>(m_stride)};
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::IteratorType
+STRIDED_VIEW_CLASS_SCOPE__::end() const noexcept
+{
+    return IteratorType{
+      m_data, static_cast<DifferenceType>(m_size), static_cast<DifferenceType>(m_stride)};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a reverse iterator to the last or before the first item of the view.
+ *
+ * \retval      RIteratorType: Reverse iterator pointing to the last item, or before the first.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::RIteratorType
+STRIDED_VIEW_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::RIteratorType
+STRIDED_VIEW_CLASS_SCOPE__::rend() const noexcept
+{
+    return RIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view, checked according to the `BoundsCheck` policy.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STRIDED_VIEW_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of view bounds");
+    return m_data[index_ * m_stride];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view, always checking its bounds.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds, whatever the policy.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STRIDED_VIEW_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of view bounds");
+    return m_data[index_ * m_stride];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the view without bounds checking, whatever the policy.
+ *
+ * \param       index_: Index of the item to access, which must be lower than `size()`.
+ *
+ * \retval      ItemType&: Reference to the item at `index_`.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STRIDED_VIEW_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return m_data[index_ * m_stride];
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the first or the last item of a non-empty view.
+ *
+ * \retval      ItemType&: Reference to the first or the last item.
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STRIDED_VIEW_CLASS_SCOPE__::front() const noexcept
+{
+    return m_data[0];
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STRIDED_VIEW_CLASS_SCOPE__::back() const noexcept
+{
+    return m_data[(m_size - 1) * m_stride];
+}
+
+
+/*************************************************************************************************/
+/* Size ---------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of items in the view, or the distance between two of its items.
+ *
+ * \retval      SizeType: Number of items (`length`, `size`) or distance between them (`stride`).
+ *************************************************************************************************/
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::SizeType
+STRIDED_VIEW_CLASS_SCOPE__::length() const noexcept
+{
+    return m_size;
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::SizeType
+STRIDED_VIEW_CLASS_SCOPE__::size() const noexcept
+{
+    return m_size;
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STRIDED_VIEW_CLASS_SCOPE__::SizeType
+STRIDED_VIEW_CLASS_SCOPE__::stride() const noexcept
+{
+    return m_stride;
+}
+
+template<STRIDED_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+STRIDED_VIEW_CLASS_SCOPE__::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef ARRAY_VIEW_TEMPLATE_DECLARATION__
+#undef ARRAY_VIEW_CLASS_SCOPE__
+#undef STRIDED_VIEW_TEMPLATE_DECLARATION__
+#undef STRIDED_VIEW_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,297 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+#include "./simd.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Hashing ------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Default hash of the flat tables, usable in constant expressions.
+ *
+ * \note        Integers and enumerations are mixed with the MurmurHash3 finalizer, and strings
+ *              hashed with FNV-1a then mixed: the low and high bits of the result are both well
+ *              distributed, as the tables use both. Other keys fall back on `std::hash`, which is
+ *              not usable in constant expressions.
+ *************************************************************************************************/
+template<typename KeyType>
+struct flat_hash
+{
+    [[nodiscard]] constexpr std::uint64_t operator()(const KeyType& key_) const noexcept;
+};
+
+
+/*************************************************************************************************/
+/* Flat table ---------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Open-addressing table of up to `ItemCount` keys, shared by `fixed_flat_map` and
+ *              `fixed_flat_set`.
+ *
+ * \note        Slots are split in groups of `group_width` slots, each with a control byte:
+ *              `empty`, `deleted`, or the 7 low bits of the hash of its key. A lookup starts at
+ *              the group picked by the high bits of the hash, and compares the whole group of
+ *              control bytes with the low bits at once, with SIMD outside of constant evaluation.
+ *              Only the keys of the matching slots are compared. The lookup stops at the first
+ *              group holding an `empty` slot, otherwise it probes the next groups quadratically.
+ *
+ * \note        There is always at least 1/8th of the slots `empty`, so that lookups of missing
+ *              keys stay short: once keys and `deleted` slots would take more, the keys are first
+ *              rehashed in place, which drops the `deleted` slots. Every slot holds a key:
+ *              `KeyType` must be default constructible, and free slots hold a default-constructed
+ *              key.
+ *************************************************************************************************/
+template<typename KeyType,
+         std::size_t ItemCount,
+         typename HashType,
+         typename KeyEqualType,
+         typename BoundsCheck>
+class flat_table
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType    = std::size_t;
+    using ControlType = std::int8_t;
+
+    static constexpr SizeType group_width = 16;
+    static constexpr SizeType slot_count =
+      std::bit_ceil(std::max(ItemCount + ItemCount / 7 + 1, group_width));
+
+    /*********************************************************************************************/
+    /* Lookups --------------------------------------------------------------------------------- */
+
+    [[nodiscard]] constexpr bool contains(const KeyType& key_) const;
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+
+    [[nodiscard]] constexpr SizeType        size() const noexcept;
+    [[nodiscard]] constexpr bool            empty() const noexcept;
+    [[nodiscard]] static constexpr SizeType capacity() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Protected methods ----------------------------------------------------------------------- */
+protected:
+    static constexpr SizeType    npos            = static_cast<SizeType>(-1);
+    static constexpr ControlType empty_control   = -128;
+    static constexpr ControlType deleted_control = -2;
+
+    constexpr flat_table() noexcept(std::is_nothrow_default_constructible_v<KeyType>);
+
+    [[nodiscard]] constexpr SizeType find_slot(const KeyType& key_) const;
+    template<typename SwapType>
+    [[nodiscard]] constexpr std::pair<SizeType, bool> claim_slot(const KeyType& key_,
+                                                                 SwapType&&     swapValues_);
+    constexpr void release_slot(SizeType slot_);
+    constexpr void release_slots();
+
+    template<typename VisitorType>
+    constexpr void visit_slots(VisitorType&& visitor_) const;
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    static constexpr SizeType group_count = slot_count / group_width;
+    static constexpr SizeType max_used    = slot_count - slot_count / 8;
+
+    [[nodiscard]] constexpr SizeType      find_free(std::uint64_t hash_) const;
+    [[nodiscard]] constexpr std::uint32_t match(SizeType group_, ControlType control_) const;
+    [[nodiscard]] constexpr std::uint32_t match_free(SizeType group_) const;
+
+    template<typename SwapType>
+    constexpr void drop_deleted(SwapType& swapValues_);
+
+
+    /*********************************************************************************************/
+    /* Protected member variables -------------------------------------------------------------- */
+protected:
+    array<ControlType, slot_count> m_control;
+    array<KeyType, slot_count>     m_keys;
+    SizeType                       m_size    = 0;
+    SizeType                       m_deleted = 0;
+
+    [[no_unique_address]] HashType     m_hash;
+    [[no_unique_address]] KeyEqualType m_keyEqual;
+};
+
+
+/*************************************************************************************************/
+/* Fixed flat map ------------------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Hash map of up to `ItemCount` entries in inline storage, that never allocates.
+ *
+ * \tparam      KeyType:      Type of the keys, default constructible.
+ * \tparam      ValueType:    Type of the values, default constructible.
+ * \tparam      ItemCount:    Maximum number of entries.
+ * \tparam      HashType:     Hash of the keys.
+ * \tparam      KeyEqualType: Equality of the keys.
+ * \tparam      BoundsCheck:  Policy applied when inserting into a full map, which throws
+ *                            `std::length_error` with the `checked` policy.
+ *
+ * \note        Keys and values are stored in two separate arrays, so that probing only touches
+ *              the control bytes and the keys. Maps can be built and queried in constant
+ *              expressions, ie for static lookup tables:
+ *              `constexpr pel::fixed_flat_map<std::string_view, int, 4> codes{{"ok", 200}};`
+ *************************************************************************************************/
+template<typename KeyType,
+         typename ValueType,
+         std::size_t ItemCount,
+         typename HashType     = flat_hash<KeyType>,
+         typename KeyEqualType = std::equal_to<>,
+         typename BoundsCheck  = default_bounds_check>
+class fixed_flat_map : public flat_table<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>
+{
+    using TableType = flat_table<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>;
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType            = typename TableType::SizeType;
+    using EntryType           = std::pair<KeyType, ValueType>;
+    using InitializerListType = std::initializer_list<EntryType>;
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+
+    constexpr fixed_flat_map() = default;
+    constexpr fixed_flat_map(InitializerListType ilist_);
+
+    /*********************************************************************************************/
+    /* Lookups --------------------------------------------------------------------------------- */
+
+    [[nodiscard]] constexpr ValueType*       find(const KeyType& key_);
+    [[nodiscard]] constexpr const ValueType* find(const KeyType& key_) const;
+
+    [[nodiscard]] constexpr ValueType&       at(const KeyType& key_);
+    [[nodiscard]] constexpr const ValueType& at(const KeyType& key_) const;
+
+    /*********************************************************************************************/
+    /* Modifiers ------------------------------------------------------------------------------- */
+
+    constexpr std::pair<ValueType*, bool> insert(const KeyType& key_, const ValueType& value_);
+    constexpr std::pair<ValueType*, bool> insert_or_assign(const KeyType&   key_,
+                                                           const ValueType& value_);
+    constexpr ValueType&                  operator[](const KeyType& key_);
+
+    constexpr bool erase(const KeyType& key_);
+    constexpr void clear();
+
+    /*********************************************************************************************/
+    /* Iteration ------------------------------------------------------------------------------- */
+
+    template<typename VisitorType>
+    constexpr void for_each(VisitorType&& visitor_);
+    template<typename VisitorType>
+    constexpr void for_each(VisitorType&& visitor_) const;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    [[nodiscard]] constexpr std::pair<SizeType, bool> claim_entry(const KeyType& key_);
+
+
+    /*********************************************************************************************/
+    /* Private member variables ---------------------------------------------------------------- */
+private:
+    array<ValueType, TableType::slot_count> m_values{};
+};
+
+
+/*************************************************************************************************/
+/* Fixed flat set ------------------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Hash set of up to `ItemCount` keys in inline storage, that never allocates.
+ *
+ * \note        Same table as `fixed_flat_map`, without the values.
+ *************************************************************************************************/
+template<typename KeyType,
+         std::size_t ItemCount,
+         typename HashType     = flat_hash<KeyType>,
+         typename KeyEqualType = std::equal_to<>,
+         typename BoundsCheck  = default_bounds_check>
+class fixed_flat_set : public flat_table<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>
+{
+    using TableType = flat_table<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>;
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType            = typename TableType::SizeType;
+    using InitializerListType = std::initializer_list<KeyType>;
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+
+    constexpr fixed_flat_set() = default;
+    constexpr fixed_flat_set(InitializerListType ilist_);
+
+    /*********************************************************************************************/
+    /* Modifiers ------------------------------------------------------------------------------- */
+
+    constexpr bool insert(const KeyType& key_);
+    constexpr bool erase(const KeyType& key_);
+    constexpr void clear();
+
+    /*********************************************************************************************/
+    /* Iteration ------------------------------------------------------------------------------- */
+
+    template<typename VisitorType>
+    constexpr void for_each(VisitorType&& visitor_) const;
+};
+
+}        // namespace pel
+
+
+#include "./fixed_flat_map.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,733 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./fixed_flat_map.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define FLAT_TABLE_TEMPLATE_DECLARATION__                                                          \
+    typename KeyType, std::size_t ItemCount, typename HashType, typename KeyEqualType,             \
+      typename BoundsCheck
+#define FLAT_TABLE_CLASS_SCOPE__ flat_table<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>
+
+#define FIXED_FLAT_MAP_TEMPLATE_DECLARATION__                                                      \
+    typename KeyType, typename ValueType, std::size_t ItemCount, typename HashType,                \
+      typename KeyEqualType, typename BoundsCheck
+#define FIXED_FLAT_MAP_CLASS_SCOPE__                                                               \
+    fixed_flat_map<KeyType, ValueType, ItemCount, HashType, KeyEqualType, BoundsCheck>
+
+#define FIXED_FLAT_SET_TEMPLATE_DECLARATION__ FLAT_TABLE_TEMPLATE_DECLARATION__
+#define FIXED_FLAT_SET_CLASS_SCOPE__                                                               \
+    fixed_flat_set<KeyType, ItemCount, HashType, KeyEqualType, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* HASHING ------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       MurmurHash3 64-bit finalizer: every bit of the input affects every bit of the
+ *              result.
+ *************************************************************************************************/
+[[nodiscard]] constexpr std::uint64_t
+mix_hash(std::uint64_t hash_) noexcept
+{
+    hash_ ^= hash_ >> 33U;
+    hash_ *= 0xFF51AFD7ED558CCDULL;
+    hash_ ^= hash_ >> 33U;
+    hash_ *= 0xC4CEB9FE1A85EC53ULL;
+    hash_ ^= hash_ >> 33U;
+    return hash_;
+}
+
+template<typename KeyType>
+[[nodiscard]] constexpr std::uint64_t
+flat_hash<KeyType>::operator()(const KeyType& key_) const noexcept
+{
+    if constexpr(std::is_integral_v<KeyType>)
+    {
+        return mix_hash(static_cast<std::uint64_t>(key_));
+    }
+    else if constexpr(std::is_enum_v<KeyType>)
+    {
+        using UnderlyingType = std::underlying_type_t<KeyType>;
+        return mix_hash(static_cast<std::uint64_t>(static_cast<UnderlyingType>(key_)));
+    }
+    else if constexpr(std::is_convertible_v<const KeyType&, std::string_view>)
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ULL;
+        for(const char character : std::string_view{key_})
+        {
+            hash = (hash ^ static_cast<unsigned char>(character)) * 0x100000001B3ULL;
+        }
+        return mix_hash(hash);
+    }
+    else
+    {
+        return mix_hash(static_cast<std::uint64_t>(std::hash<KeyType>{}(key_)));
+    }
+}
+
+
+/*************************************************************************************************/
+/* FLAT TABLE ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of an empty table, every slot being `empty`.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+constexpr FLAT_TABLE_CLASS_SCOPE__::flat_table() noexcept(
+  std::is_nothrow_default_constructible_v<KeyType>)
+: m_control(empty_control), m_keys{}
+{
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Check whether the table holds a key equal to `key_`.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr bool
+FLAT_TABLE_CLASS_SCOPE__::contains(const KeyType& key_) const
+{
+    return find_slot(key_) != npos;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Number of keys in the table.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename FLAT_TABLE_CLASS_SCOPE__::SizeType
+FLAT_TABLE_CLASS_SCOPE__::size() const noexcept
+{
+    return m_size;
+}
+
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr bool
+FLAT_TABLE_CLASS_SCOPE__::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Maximum number of keys in the table.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename FLAT_TABLE_CLASS_SCOPE__::SizeType
+FLAT_TABLE_CLASS_SCOPE__::capacity() noexcept
+{
+    return ItemCount;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Find the slot holding a key equal to `key_`.
+ *
+ * \retval      SizeType: Index of the slot, `npos` if there is none.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename FLAT_TABLE_CLASS_SCOPE__::SizeType
+FLAT_TABLE_CLASS_SCOPE__::find_slot(const KeyType& key_) const
+{
+    const std::uint64_t hash    = m_hash(key_);
+    const ControlType   control = static_cast<ControlType>(hash & 0x7FU);
+
+    SizeType group = (hash >> 7U) & (group_count - 1);
+    for(SizeType probe = 1; probe <= group_count; ++probe)
+    {
+        for(std::uint32_t matches = match(group, control); matches != 0; matches &= matches - 1)
+        {
+            const SizeType slot =
+              group * group_width + static_cast<SizeType>(std::countr_zero(matches));
+            if(m_keyEqual(m_keys.unchecked(slot), key_)) [[likely]]
+            {
+                return slot;
+            }
+        }
+        if(match(group, empty_control) != 0) [[likely]]
+        {
+            return npos;
+        }
+
+        /* Triangular probing visits every group, as their count is a power of two */
+        group = (group + probe) & (group_count - 1);
+    }
+    return npos;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Find the slot holding a key equal to `key_`, or store `key_` in a free slot.
+ *
+ * \param       key_:        Key to find or store.
+ * \param       swapValues_: Callable swapping whatever the owner stores alongside two slots,
+ *                           called if the keys are rehashed to make room for `key_`.
+ *
+ * \retval      std::pair<SizeType, bool>: Index of the slot, `npos` if the key is missing and the
+ *                                         table full; and whether the key was stored.
+ *
+ * \throws      std::length_error if the key is missing, the table full, and the policy throws.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+template<typename SwapType>
+[[nodiscard]] constexpr std::pair<typename FLAT_TABLE_CLASS_SCOPE__::SizeType, bool>
+FLAT_TABLE_CLASS_SCOPE__::claim_slot(const KeyType& key_, SwapType&& swapValues_)
+{
+    if(const SizeType slot = find_slot(key_); slot != npos)
+    {
+        return {slot, false};
+    }
+
+    BoundsCheck::template check<std::length_error>(m_size < ItemCount, "Flat table is full");
+    if(m_size == ItemCount)
+    {
+        return {npos, false};
+    }
+
+    if(m_size + m_deleted >= max_used)
+    {
+        drop_deleted(swapValues_);
+    }
+
+    const std::uint64_t hash = m_hash(key_);
+    const SizeType      slot = find_free(hash);
+
+    if(m_control.unchecked(slot) == deleted_control)
+    {
+        --m_deleted;
+    }
+    m_keys.unchecked(slot)    = key_;
+    m_control.unchecked(slot) = static_cast<ControlType>(hash & 0x7FU);
+    ++m_size;
+    return {slot, true};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Free a slot holding a key.
+ *
+ * \note        Lookups stop at the first group with an `empty` slot. If the group of the slot has
+ *              one, no lookup goes past this group and the slot can be `empty` too, otherwise it
+ *              is marked `deleted` so that lookups keep probing past it.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+constexpr void
+FLAT_TABLE_CLASS_SCOPE__::release_slot(SizeType slot_)
+{
+    const SizeType group = slot_ / group_width;
+
+    if(match(group, empty_control) != 0)
+    {
+        m_control.unchecked(slot_) = empty_control;
+    }
+    else
+    {
+        m_control.unchecked(slot_) = deleted_control;
+        ++m_deleted;
+    }
+    m_keys.unchecked(slot_) = KeyType{};
+    --m_size;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Free every slot.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+constexpr void
+FLAT_TABLE_CLASS_SCOPE__::release_slots()
+{
+    m_control.fill(empty_control);
+    m_keys.fill(KeyType{});
+    m_size    = 0;
+    m_deleted = 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Call `visitor_(slot)` for each slot holding a key, in slot order.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+template<typename VisitorType>
+constexpr void
+FLAT_TABLE_CLASS_SCOPE__::visit_slots(VisitorType&& visitor_) const
+{
+    for(SizeType slot = 0; slot < slot_count; ++slot)
+    {
+        if(m_control.unchecked(slot) >= 0)
+        {
+            visitor_(slot);
+        }
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       First `empty` or `deleted` slot on the probe sequence of a hash.
+ *
+ * \note        The table always has free slots, and triangular probing visits every group.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename FLAT_TABLE_CLASS_SCOPE__::SizeType
+FLAT_TABLE_CLASS_SCOPE__::find_free(std::uint64_t hash_) const
+{
+    SizeType group = (hash_ >> 7U) & (group_count - 1);
+    for(SizeType probe = 1;; ++probe)
+    {
+        if(const std::uint32_t frees = match_free(group); frees != 0)
+        {
+            return group * group_width + static_cast<SizeType>(std::countr_zero(frees));
+        }
+        group = (group + probe) & (group_count - 1);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Rehash the keys in place, turning every `deleted` slot back into an `empty` one.
+ *
+ * \param       swapValues_: Callable swapping whatever the owner stores alongside two slots.
+ *
+ * \note        Same algorithm as Abseil's Swiss tables: free slots are first marked `empty` and
+ *              keys `deleted`. Each `deleted` key then goes to the first free slot of its probe
+ *              sequence, unless that slot is in its own group. Moved to an `empty` slot, it
+ *              leaves an `empty` slot behind. Swapped with a `deleted` key, that key is handled
+ *              next from the same slot. Placed keys never move again, so the groups probed past
+ *              to reach them never get an `empty` slot.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+template<typename SwapType>
+constexpr void
+FLAT_TABLE_CLASS_SCOPE__::drop_deleted(SwapType& swapValues_)
+{
+    for(ControlType& control : m_control)
+    {
+        control = (control >= 0) ? deleted_control : empty_control;
+    }
+
+    for(SizeType slot = 0; slot < slot_count; ++slot)
+    {
+        while(m_control.unchecked(slot) == deleted_control)
+        {
+            const std::uint64_t hash    = m_hash(m_keys.unchecked(slot));
+            const ControlType   control = static_cast<ControlType>(hash & 0x7FU);
+            const SizeType      target  = find_free(hash);
+
+            if(target / group_width == slot / group_width)
+            {
+                m_control.unchecked(slot) = control;
+                break;
+            }
+
+            using std::swap;
+            swap(m_keys.unchecked(slot), m_keys.unchecked(target));
+            swapValues_(slot, target);
+            if(m_control.unchecked(target) == empty_control)
+            {
+                m_control.unchecked(slot) = empty_control;
+            }
+            m_control.unchecked(target) = control;
+        }
+    }
+
+    m_deleted = 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Bit mask of the slots of a group whose control byte is `control_`.
+ *
+ * \note        Outside of constant evaluation, the 16 control bytes are compared at once and their
+ *              sign bits gathered with `movemask` on SSE2 targets.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr std::uint32_t
+FLAT_TABLE_CLASS_SCOPE__::match(SizeType group_, ControlType control_) const
+{
+    const ControlType* controls = m_control.data() + group_ * group_width;
+
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__SSE2__)
+    if(!std::is_constant_evaluated())
+    {
+        __m128i group;
+        std::memcpy(&group, controls, sizeof(group));
+        return static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(control_))));
+    }
+#endif
+
+    std::uint32_t matches = 0;
+    for(SizeType slot = 0; slot < group_width; ++slot)
+    {
+        matches |= static_cast<std::uint32_t>(controls[slot] == control_) << slot;
+    }
+    return matches;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Bit mask of the `empty` and `deleted` slots of a group, whose control bytes are
+ *              the only negative ones.
+ *************************************************************************************************/
+template<FLAT_TABLE_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr std::uint32_t
+FLAT_TABLE_CLASS_SCOPE__::match_free(SizeType group_) const
+{
+    const ControlType* controls = m_control.data() + group_ * group_width;
+
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__SSE2__)
+    if(!std::is_constant_evaluated())
+    {
+        __m128i group;
+        std::memcpy(&group, controls, sizeof(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(group));
+    }
+#endif
+
+    std::uint32_t frees = 0;
+    for(SizeType slot = 0; slot < group_width; ++slot)
+    {
+        frees |= static_cast<std::uint32_t>(controls[slot] < 0) << slot;
+    }
+    return frees;
+}
+
+
+/*************************************************************************************************/
+/* FIXED FLAT MAP ------------------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a map holding the entries of a list. Later duplicates of a key are
+ *              ignored.
+ *
+ * \throws      std::length_error if there are more than `ItemCount` keys and the policy throws.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr FIXED_FLAT_MAP_CLASS_SCOPE__::fixed_flat_map(InitializerListType ilist_)
+{
+    for(const EntryType& entry : ilist_)
+    {
+        insert(entry.first, entry.second);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Find the value of a key.
+ *
+ * \retval      ValueType*: Pointer to the value, `nullptr` if the key is missing.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr ValueType*
+FIXED_FLAT_MAP_CLASS_SCOPE__::find(const KeyType& key_)
+{
+    const SizeType slot = this->find_slot(key_);
+    return (slot == TableType::npos) ? nullptr : &m_values.unchecked(slot);
+}
+
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr const ValueType*
+FIXED_FLAT_MAP_CLASS_SCOPE__::find(const KeyType& key_) const
+{
+    const SizeType slot = this->find_slot(key_);
+    return (slot == TableType::npos) ? nullptr : &m_values.unchecked(slot);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access the value of a key, whatever the policy.
+ *
+ * \throws      std::out_of_range if the key is missing.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr ValueType&
+FIXED_FLAT_MAP_CLASS_SCOPE__::at(const KeyType& key_)
+{
+    ValueType* value = find(key_);
+    bounds_check::checked::check<std::out_of_range>(value != nullptr, "Key not in fixed_flat_map");
+    return *value;
+}
+
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr const ValueType&
+FIXED_FLAT_MAP_CLASS_SCOPE__::at(const KeyType& key_) const
+{
+    const ValueType* value = find(key_);
+    bounds_check::checked::check<std::out_of_range>(value != nullptr, "Key not in fixed_flat_map");
+    return *value;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Insert an entry, unless the key is already in the map.
+ *
+ * \retval      std::pair<ValueType*, bool>: Value of the key, `nullptr` if the map is full; and
+ *                                           whether the entry was inserted.
+ *
+ * \throws      std::length_error if the map is full and the policy throws.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr std::pair<ValueType*, bool>
+FIXED_FLAT_MAP_CLASS_SCOPE__::insert(const KeyType& key_, const ValueType& value_)
+{
+    const auto [slot, inserted] = claim_entry(key_);
+    if(slot == TableType::npos)
+    {
+        return {nullptr, false};
+    }
+
+    if(inserted)
+    {
+        m_values.unchecked(slot) = value_;
+    }
+    return {&m_values.unchecked(slot), inserted};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Insert an entry, or assign `value_` to the key if it's already in the map.
+ *
+ * \retval      std::pair<ValueType*, bool>: Value of the key, `nullptr` if the map is full; and
+ *                                           whether the entry was inserted.
+ *
+ * \throws      std::length_error if the map is full and the policy throws.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr std::pair<ValueType*, bool>
+FIXED_FLAT_MAP_CLASS_SCOPE__::insert_or_assign(const KeyType& key_, const ValueType& value_)
+{
+    const auto [slot, inserted] = claim_entry(key_);
+    if(slot == TableType::npos)
+    {
+        return {nullptr, false};
+    }
+
+    m_values.unchecked(slot) = value_;
+    return {&m_values.unchecked(slot), inserted};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access the value of a key, inserting a value-initialized value if it's missing.
+ *
+ * \throws      std::length_error if the key is missing and the map full, whatever the policy.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr ValueType&
+FIXED_FLAT_MAP_CLASS_SCOPE__::operator[](const KeyType& key_)
+{
+    const SizeType slot = claim_entry(key_).first;
+    bounds_check::checked::check<std::length_error>(slot != TableType::npos,
+                                                    "fixed_flat_map is full");
+    return m_values.unchecked(slot);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove the entry of a key.
+ *
+ * \retval      bool: Whether the key was in the map.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr bool
+FIXED_FLAT_MAP_CLASS_SCOPE__::erase(const KeyType& key_)
+{
+    const SizeType slot = this->find_slot(key_);
+    if(slot == TableType::npos)
+    {
+        return false;
+    }
+
+    this->release_slot(slot);
+    m_values.unchecked(slot) = ValueType{};
+    return true;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove every entry.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+constexpr void
+FIXED_FLAT_MAP_CLASS_SCOPE__::clear()
+{
+    this->release_slots();
+    m_values.fill(ValueType{});
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Call `visitor_(key, value)` for each entry, in an unspecified order.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+template<typename VisitorType>
+constexpr void
+FIXED_FLAT_MAP_CLASS_SCOPE__::for_each(VisitorType&& visitor_)
+{
+    this->visit_slots(
+      [&](SizeType slot_)
+      {
+          visitor_(std::as_const(this->m_keys.unchecked(slot_)), m_values.unchecked(slot_));
+      });
+}
+
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+template<typename VisitorType>
+constexpr void
+FIXED_FLAT_MAP_CLASS_SCOPE__::for_each(VisitorType&& visitor_) const
+{
+    this->visit_slots([&](SizeType slot_)
+                      { visitor_(this->m_keys.unchecked(slot_), m_values.unchecked(slot_)); });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Find the slot of a key or store it, see `flat_table::claim_slot`, moving the values
+ *              along with their keys if the table is rehashed.
+ *************************************************************************************************/
+template<FIXED_FLAT_MAP_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr std::pair<typename FIXED_FLAT_MAP_CLASS_SCOPE__::SizeType, bool>
+FIXED_FLAT_MAP_CLASS_SCOPE__::claim_entry(const KeyType& key_)
+{
+    return this->claim_slot(key_,
+                            [this](SizeType lhs_, SizeType rhs_)
+                            {
+                                using std::swap;
+                                swap(m_values.unchecked(lhs_), m_values.unchecked(rhs_));
+                            });
+}
+
+
+/*************************************************************************************************/
+/* FIXED FLAT SET ------------------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a set holding the keys of a list.
+ *
+ * \throws      std::length_error if there are more than `ItemCount` keys and the policy throws.
+ *************************************************************************************************/
+template<FIXED_FLAT_SET_TEMPLATE_DECLARATION__>
+constexpr FIXED_FLAT_SET_CLASS_SCOPE__::fixed_flat_set(InitializerListType ilist_)
+{
+    for(const KeyType& key : ilist_)
+    {
+        insert(key);
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Insert a key, unless it's already in the set.
+ *
+ * \retval      bool: Whether the key was inserted.
+ *
+ * \throws      std::length_error if the set is full and the policy throws.
+ *************************************************************************************************/
+template<FIXED_FLAT_SET_TEMPLATE_DECLARATION__>
+constexpr bool
+FIXED_FLAT_SET_CLASS_SCOPE__::insert(const KeyType& key_)
+{
+    return this->claim_slot(key_, [](SizeType /* lhs_ */, SizeType /* rhs_ */) {}).second;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove a key.
+ *
+ * \retval      bool: Whether the key was in the set.
+ *************************************************************************************************/
+template<FIXED_FLAT_SET_TEMPLATE_DECLARATION__>
+constexpr bool
+FIXED_FLAT_SET_CLASS_SCOPE__::erase(const KeyType& key_)
+{
+    const SizeType slot = this->find_slot(key_);
+    if(slot == TableType::npos)
+    {
+        return false;
+    }
+
+    this->release_slot(slot);
+    return true;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove every key.
+ *************************************************************************************************/
+template<FIXED_FLAT_SET_TEMPLATE_DECLARATION__>
+constexpr void
+FIXED_FLAT_SET_CLASS_SCOPE__::clear()
+{
+    this->release_slots();
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Call `visitor_(key)` for each key, in an unspecified order.
+ *************************************************************************************************/
+template<FIXED_FLAT_SET_TEMPLATE_DECLARATION__>
+template<typename VisitorType>
+constexpr void
+FIXED_FLAT_SET_CLASS_SCOPE__::for_each(VisitorType&& visitor_) const
+{
+    this->visit_slots([&](SizeType slot_) { visitor_(this->m_keys.unchecked(slot_)); });
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef FLAT_TABLE_TEMPLATE_DECLARATION__
+#undef FLAT_TABLE_CLASS_SCOPE__
+#undef FIXED_FLAT_MAP_TEMPLATE_DECLARATION__
+#undef FIXED_FLAT_MAP_CLASS_SCOPE__
+#undef FIXED_FLAT_SET_TEMPLATE_DECLARATION__
+#undef FIXED_FLAT_SET_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,233 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+#include "./thread_pool.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+
+/*************************************************************************************************/
+/* Target detection ---------------------------------------------------------------------------- */
+
+/* Size, in bytes, of the huge pages requested for large heap arrays: a single TLB entry then maps
+ * 512 times more memory than with 4 KiB pages. Can be overridden on the command line. */
+#if !defined(PEL_HUGE_PAGE_BYTES)
+#define PEL_HUGE_PAGE_BYTES (2 * 1024 * 1024)
+#endif
+
+/* Pages are mapped with `mmap` on POSIX targets, and allocated with aligned `operator new`
+ * elsewhere */
+#if defined(__unix__) || defined(__APPLE__)
+#define PEL_HEAP_ARRAY_MMAP 1
+#else
+#define PEL_HEAP_ARRAY_MMAP 0
+#endif
+
+
+namespace pel
+{
+constexpr std::size_t huge_page_bytes = PEL_HUGE_PAGE_BYTES;
+
+
+/*************************************************************************************************/
+/* Options ------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       When the pages of a heap array are first written to, which is when the OS backs
+ *              them with physical memory, on the NUMA node of the writing thread.
+ *
+ * \note        `lazy`:     On first use, by whichever thread touches them first.
+ *              `populate`: On construction, by the constructing thread.
+ *              `parallel`: On construction, by the threads of the default pool, each touching a
+ *                          contiguous range of pages like the ranges the `pel::parallel`
+ *                          algorithms start from, so that they later mostly work on local memory.
+ *************************************************************************************************/
+enum class page_touch
+{
+    lazy,
+    populate,
+    parallel,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Allocation options of a heap array.
+ *
+ * \note        Huge pages are only requested for arrays of at least `huge_page_bytes`, from the
+ *              hugetlbfs pool first, then as transparent huge pages (`madvise`). They are a hint:
+ *              the array works the same, with small pages, where the OS doesn't provide them.
+ *************************************************************************************************/
+struct heap_options
+{
+    bool       hugePages = true;             /* Back large arrays with huge pages if possible */
+    page_touch touch     = page_touch::lazy; /* When the pages are first written to */
+};
+
+
+/*************************************************************************************************/
+/* Page mapping -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Owner of a zero-filled, page-aligned block of memory mapped for a heap array.
+ *************************************************************************************************/
+class page_mapping
+{
+public:
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    page_mapping() noexcept = default;
+    page_mapping(std::size_t bytes_, const heap_options& options_);
+    page_mapping(page_mapping&& move_) noexcept;
+    page_mapping& operator=(page_mapping&& move_) noexcept;
+    ~page_mapping();
+
+
+    /*********************************************************************************************/
+    /* Accessors ------------------------------------------------------------------------------- */
+    [[nodiscard]] void*       data() const noexcept;
+    [[nodiscard]] std::size_t bytes() const noexcept;
+    [[nodiscard]] bool        huge_pages() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    void map(std::size_t bytes_, bool hugePages_);
+    void touch(page_touch touch_);
+    void release() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    void*       m_data      = nullptr;
+    std::size_t m_bytes     = 0;
+    std::size_t m_alignment = 0; /* Alignment of the block, when allocated with `operator new` */
+    bool        m_hugePages = false;
+};
+
+
+/*************************************************************************************************/
+/* Heap array ---------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       `pel::array` of `ItemCount` items stored out of line, in memory mapped for it.
+ *
+ * \tparam      ItemType:    Type of the items.
+ * \tparam      ItemCount:   Number of items.
+ * \tparam      BoundsCheck: Bounds checking policy of the array.
+ *
+ * \note        Arrays too large for the stack (ie `pel::array<double, 1 << 24>`, 128 MiB) or for
+ *              .bss keep their fixed-size interface: the whole `pel::array` is reached with `*`,
+ *              `->` or `items()`, and the most common members are forwarded. The array is
+ *              built inside the mapping, which is only allocated on construction.
+ *
+ * \note        Mapped pages are zero-filled: trivially default constructible items start at zero,
+ *              without the constructor writing to, and therefore touching, every page.
+ *
+ * \note        A moved-from heap array holds no items, and may only be assigned to or destroyed.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck = default_bounds_check>
+class heap_array
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using ArrayType         = array<ItemType, ItemCount, BoundsCheck>;
+    using SizeType          = typename ArrayType::SizeType;
+    using IteratorType      = typename ArrayType::IteratorType;
+    using ConstIteratorType = typename ArrayType::ConstIteratorType;
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+
+    explicit heap_array(const heap_options& options_ = {});
+    explicit heap_array(const ItemType& value_, const heap_options& options_ = {});
+
+    heap_array(const heap_array& copy_);
+    heap_array& operator=(const heap_array& copy_);
+    heap_array(heap_array&& move_) noexcept;
+    heap_array& operator=(heap_array&& move_) noexcept;
+
+    ~heap_array();
+
+    /*********************************************************************************************/
+    /* Array access ---------------------------------------------------------------------------- */
+
+    [[nodiscard]] ArrayType&       items() noexcept;
+    [[nodiscard]] const ArrayType& items() const noexcept;
+    [[nodiscard]] ArrayType&       operator*() noexcept;
+    [[nodiscard]] const ArrayType& operator*() const noexcept;
+    [[nodiscard]] ArrayType*       operator->() noexcept;
+    [[nodiscard]] const ArrayType* operator->() const noexcept;
+
+    /*********************************************************************************************/
+    /* Forwarded members ----------------------------------------------------------------------- */
+
+    [[nodiscard]] IteratorType      begin() noexcept;
+    [[nodiscard]] ConstIteratorType begin() const noexcept;
+    [[nodiscard]] IteratorType      end() noexcept;
+    [[nodiscard]] ConstIteratorType end() const noexcept;
+
+    [[nodiscard]] ItemType&
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] const ItemType&
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] ItemType*       data() noexcept;
+    [[nodiscard]] const ItemType* data() const noexcept;
+
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+    /*********************************************************************************************/
+    /* Mapping --------------------------------------------------------------------------------- */
+
+    [[nodiscard]] bool        huge_pages() const noexcept;
+    [[nodiscard]] std::size_t mapped_bytes() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    heap_options m_options;
+    page_mapping m_mapping;
+    ArrayType*   m_items = nullptr;
+};
+
+}        // namespace pel
+
+
+#include "./heap_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
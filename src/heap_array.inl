@@ -0,0 +1,527 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./heap_array.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if PEL_HEAP_ARRAY_MMAP == 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define HEAP_ARRAY_TEMPLATE_DECLARATION__                                                          \
+    typename ItemType, std::size_t ItemCount, typename BoundsCheck
+#define HEAP_ARRAY_CLASS_SCOPE__ heap_array<ItemType, ItemCount, BoundsCheck>
+
+/* Pages are touched every `page_touch_stride` bytes, the smallest page size of the targets */
+constexpr std::size_t page_touch_stride = 4096;
+
+[[nodiscard]] constexpr std::size_t
+round_up_to(std::size_t value_, std::size_t multiple_) noexcept
+{
+    return (value_ + multiple_ - 1) / multiple_ * multiple_;
+}
+
+
+/*************************************************************************************************/
+/* PAGE MAPPING -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Map a zero-filled block of at least `bytes_` bytes.
+ *
+ * \param       bytes_:   Number of bytes to map.
+ * \param       options_: Page size and touch options.
+ *
+ * \throws      std::bad_alloc if the memory can't be mapped.
+ *************************************************************************************************/
+inline page_mapping::page_mapping(std::size_t bytes_, const heap_options& options_)
+{
+    map(std::max<std::size_t>(bytes_, 1), options_.hugePages && (bytes_ >= huge_page_bytes));
+    try
+    {
+        touch(options_.touch);
+    }
+    catch(...)
+    {
+        /* The destructor of a partially constructed object isn't called */
+        release();
+        throw;
+    }
+}
+
+inline page_mapping::page_mapping(page_mapping&& move_) noexcept
+: m_data{std::exchange(move_.m_data, nullptr)},
+  m_bytes{std::exchange(move_.m_bytes, 0)},
+  m_alignment{std::exchange(move_.m_alignment, 0)},
+  m_hugePages{std::exchange(move_.m_hugePages, false)}
+{
+}
+
+inline page_mapping&
+page_mapping::operator=(page_mapping&& move_) noexcept
+{
+    if(this != &move_)
+    {
+        release();
+        m_data      = std::exchange(move_.m_data, nullptr);
+        m_bytes     = std::exchange(move_.m_bytes, 0);
+        m_alignment = std::exchange(move_.m_alignment, 0);
+        m_hugePages = std::exchange(move_.m_hugePages, false);
+    }
+    return *this;
+}
+
+inline page_mapping::~page_mapping()
+{
+    release();
+}
+
+
+[[nodiscard]] inline void*
+page_mapping::data() const noexcept
+{
+    return m_data;
+}
+
+[[nodiscard]] inline std::size_t
+page_mapping::bytes() const noexcept
+{
+    return m_bytes;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Whether the OS accepted to back the mapping with huge pages.
+ *
+ * \note        Transparent huge pages are only promised by `madvise`: the kernel still falls back
+ *              to small pages for the parts it can't find huge pages for.
+ *************************************************************************************************/
+[[nodiscard]] inline bool
+page_mapping::huge_pages() const noexcept
+{
+    return m_hugePages;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Map the block, from huge pages when `hugePages_` is set and the OS provides them.
+ *
+ * \throws      std::bad_alloc if the memory can't be mapped.
+ *************************************************************************************************/
+inline void
+page_mapping::map(std::size_t bytes_, bool hugePages_)
+{
+#if PEL_HEAP_ARRAY_MMAP == 1
+    constexpr int protection = PROT_READ | PROT_WRITE;
+    constexpr int flags      = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    if(hugePages_)
+    {
+        m_bytes = round_up_to(bytes_, huge_page_bytes);
+
+#if defined(MAP_HUGETLB)
+        /* Huge pages reserved by the administrator, often none */
+        if(void* data = ::mmap(nullptr, m_bytes, protection, flags | MAP_HUGETLB, -1, 0);
+           data != MAP_FAILED)
+        {
+            m_data      = data;
+            m_hugePages = true;
+            return;
+        }
+#endif
+
+        /* Transparent huge pages only back whole aligned huge pages: map one more, then unmap
+         * the unaligned head and tail */
+        const std::size_t paddedBytes = m_bytes + huge_page_bytes;
+        void*             padded      = ::mmap(nullptr, paddedBytes, protection, flags, -1, 0);
+        if(padded == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        const std::uintptr_t address   = reinterpret_cast<std::uintptr_t>(padded);
+        const std::size_t    headBytes = round_up_to(address, huge_page_bytes) - address;
+        const std::size_t    tailBytes = paddedBytes - headBytes - m_bytes;
+
+        m_data = static_cast<unsigned char*>(padded) + headBytes;
+        if(headBytes != 0)
+        {
+            ::munmap(padded, headBytes);
+        }
+        if(tailBytes != 0)
+        {
+            ::munmap(static_cast<unsigned char*>(m_data) + m_bytes, tailBytes);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        m_hugePages = (::madvise(m_data, m_bytes, MADV_HUGEPAGE) == 0);
+#endif
+        return;
+    }
+
+    m_bytes    = round_up_to(bytes_, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+    void* data = ::mmap(nullptr, m_bytes, protection, flags, -1, 0);
+    if(data == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    m_data = data;
+#else
+    /* Without huge pages from the OS, `m_hugePages` stays cleared: the alignment given to
+     * `operator new` is kept for `operator delete` */
+    m_alignment = hugePages_ ? huge_page_bytes : page_touch_stride;
+    m_bytes     = round_up_to(bytes_, m_alignment);
+    m_data      = ::operator new(m_bytes, std::align_val_t{m_alignment});
+
+    /* Zero-filled, like mapped pages */
+    std::memset(m_data, 0, m_bytes);
+#endif
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Write to every page of the block, for the OS to back it with physical memory.
+ *
+ * \note        In `parallel`, the pages are split in huge-page sized chunks, and the pool hands
+ *              each thread a contiguous range of chunks first.
+ *************************************************************************************************/
+inline void
+page_mapping::touch(page_touch touch_)
+{
+    unsigned char* bytes = static_cast<unsigned char*>(m_data);
+
+    const auto touchRange = [bytes](std::size_t begin_, std::size_t end_)
+    {
+        for(std::size_t offset = begin_; offset < end_; offset += page_touch_stride)
+        {
+            bytes[offset] = 0;
+        }
+    };
+
+    switch(touch_)
+    {
+        case page_touch::lazy:
+            break;
+
+        case page_touch::populate:
+            touchRange(0, m_bytes);
+            break;
+
+        case page_touch::parallel:
+        {
+            const std::size_t chunkCount = (m_bytes + huge_page_bytes - 1) / huge_page_bytes;
+            default_thread_pool().run(chunkCount,
+                                      [&](std::size_t chunk_)
+                                      {
+                                          touchRange(chunk_ * huge_page_bytes,
+                                                     std::min((chunk_ + 1) * huge_page_bytes,
+                                                              m_bytes));
+                                      });
+            break;
+        }
+    }
+}
+
+inline void
+page_mapping::release() noexcept
+{
+    if(m_data == nullptr)
+    {
+        return;
+    }
+
+#if PEL_HEAP_ARRAY_MMAP == 1
+    ::munmap(m_data, m_bytes);
+#else
+    ::operator delete(m_data, std::align_val_t{m_alignment});
+#endif
+    m_data      = nullptr;
+    m_bytes     = 0;
+    m_alignment = 0;
+}
+
+
+/*************************************************************************************************/
+/* HEAP ARRAY ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a heap array of default-initialized items.
+ *
+ * \param       options_: Allocation options.
+ *
+ * \throws      std::bad_alloc if the memory can't be mapped.
+ *
+ * \note        Trivially default constructible items are left as the zero-filled pages hold
+ *              them, so that the pages are only touched as `options_.touch` requests.
+ *************************************************************************************************/
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__::heap_array(const heap_options& options_)
+: m_options{options_}, m_mapping{sizeof(ArrayType), options_}
+{
+    if constexpr(std::is_trivially_default_constructible_v<ItemType>)
+    {
+        m_items = ::new(m_mapping.data()) ArrayType;
+    }
+    else
+    {
+        m_items = ::new(m_mapping.data()) ArrayType();
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a heap array of copies of `value_`.
+ *
+ * \param       value_:   Value of every item.
+ * \param       options_: Allocation options, the pages being touched before the items are built.
+ *
+ * \throws      std::bad_alloc if the memory can't be mapped.
+ *************************************************************************************************/
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__::heap_array(const ItemType& value_, const heap_options& options_)
+: m_options{options_}, m_mapping{sizeof(ArrayType), options_}
+{
+    m_items = ::new(m_mapping.data()) ArrayType(value_);
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__::heap_array(const heap_array& copy_)
+: m_options{copy_.m_options}, m_mapping{sizeof(ArrayType), copy_.m_options}
+{
+    m_items = ::new(m_mapping.data()) ArrayType(*copy_.m_items);
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__&
+HEAP_ARRAY_CLASS_SCOPE__::operator=(const heap_array& copy_)
+{
+    if(m_items == nullptr)
+    {
+        *this = heap_array(copy_);
+    }
+    else if(this != &copy_)
+    {
+        *m_items = *copy_.m_items;
+    }
+    return *this;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__::heap_array(heap_array&& move_) noexcept
+: m_options{move_.m_options},
+  m_mapping{std::move(move_.m_mapping)},
+  m_items{std::exchange(move_.m_items, nullptr)}
+{
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__&
+HEAP_ARRAY_CLASS_SCOPE__::operator=(heap_array&& move_) noexcept
+{
+    if(this != &move_)
+    {
+        if(m_items != nullptr)
+        {
+            std::destroy_at(m_items);
+        }
+        m_options = move_.m_options;
+        m_mapping = std::move(move_.m_mapping);
+        m_items   = std::exchange(move_.m_items, nullptr);
+    }
+    return *this;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+HEAP_ARRAY_CLASS_SCOPE__::~heap_array()
+{
+    if(m_items != nullptr)
+    {
+        std::destroy_at(m_items);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the `pel::array` holding the items.
+ *************************************************************************************************/
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType&
+HEAP_ARRAY_CLASS_SCOPE__::items() noexcept
+{
+    return *m_items;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline const typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType&
+HEAP_ARRAY_CLASS_SCOPE__::items() const noexcept
+{
+    return *m_items;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType&
+HEAP_ARRAY_CLASS_SCOPE__::operator*() noexcept
+{
+    return *m_items;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline const typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType&
+HEAP_ARRAY_CLASS_SCOPE__::operator*() const noexcept
+{
+    return *m_items;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType*
+HEAP_ARRAY_CLASS_SCOPE__::operator->() noexcept
+{
+    return m_items;
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline const typename HEAP_ARRAY_CLASS_SCOPE__::ArrayType*
+HEAP_ARRAY_CLASS_SCOPE__::operator->() const noexcept
+{
+    return m_items;
+}
+
+
+/*************************************************************************************************/
+/* FORWARDED MEMBERS --------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::IteratorType
+HEAP_ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return m_items->begin();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::ConstIteratorType
+HEAP_ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return std::as_const(*m_items).begin();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::IteratorType
+HEAP_ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return m_items->end();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename HEAP_ARRAY_CLASS_SCOPE__::ConstIteratorType
+HEAP_ARRAY_CLASS_SCOPE__::end() const noexcept
+{
+    return std::as_const(*m_items).end();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline ItemType&
+HEAP_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    return (*m_items)[index_];
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline const ItemType&
+HEAP_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    return std::as_const(*m_items)[index_];
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline ItemType*
+HEAP_ARRAY_CLASS_SCOPE__::data() noexcept
+{
+    return m_items->data();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline const ItemType*
+HEAP_ARRAY_CLASS_SCOPE__::data() const noexcept
+{
+    return std::as_const(*m_items).data();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr typename HEAP_ARRAY_CLASS_SCOPE__::SizeType
+HEAP_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return ItemCount;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Whether the items are backed by huge pages, and the number of bytes mapped for
+ *              them, rounded up to whole pages.
+ *************************************************************************************************/
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline bool
+HEAP_ARRAY_CLASS_SCOPE__::huge_pages() const noexcept
+{
+    return m_mapping.huge_pages();
+}
+
+template<HEAP_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline std::size_t
+HEAP_ARRAY_CLASS_SCOPE__::mapped_bytes() const noexcept
+{
+    return m_mapping.bytes();
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef HEAP_ARRAY_TEMPLATE_DECLARATION__
+#undef HEAP_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -1,60 +1,925 @@
+﻿#include "./aligned_array.hpp"
 #include "./array.hpp"
+#include "./array_format.hpp"
+#include "./array_pool.hpp"
+#include "./array_reduce.hpp"
+#include "./array_sort.hpp"
+#include "./fixed_flat_map.hpp"
+#include "./heap_array.hpp"
+#include "./md_array.hpp"
+#include "./packed_array.hpp"
+#include "./parallel.hpp"
+#include "./ring_array.hpp"
+#include "./soa_array.hpp"
+#include "./static_vector.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-// constexpr std::size_t
-// foo()
-//{
-//    pel::array<int, 5> myArr{5, 4, 3, 2, 1};
-//    myArr.replace_back(10);
-//    constexpr std::size_t var = myArr.length();
-//
-//    return var;
-//}
 
-template<typename T>
-struct AAAA
+/*************************************************************************************************/
+/* Layout guarantees --------------------------------------------------------------------------- */
+static_assert(sizeof(pel::array<float, 4>) == sizeof(float[4]));
+static_assert(sizeof(pel::array<std::uint8_t, 16>) == sizeof(std::uint8_t[16]));
+static_assert(sizeof(pel::array<double, 3>) == sizeof(double[3]));
+static_assert(alignof(pel::array<double, 3>) == alignof(double));
+
+static_assert(!std::is_polymorphic_v<pel::array<float, 4>>);
+static_assert(std::is_trivially_copyable_v<pel::array<float, 4>>);
+static_assert(std::is_trivially_copyable_v<pel::array<std::uint8_t, 16>>);
+static_assert(std::is_trivially_destructible_v<pel::array<float, 4>>);
+static_assert(std::is_standard_layout_v<pel::array<float, 4>>);
+static_assert(!std::is_trivially_copyable_v<pel::array<std::string, 4>>);
+
+static_assert(sizeof(pel::array<pel::array<float, 4>, 4>) == sizeof(float[4][4]));
+static_assert(std::is_trivially_copyable_v<pel::array<pel::array<float, 4>, 4>>);
+
+/* Containers of arrays move them instead of copying them when they grow */
+static_assert(std::is_nothrow_move_constructible_v<pel::array<std::string, 4>>);
+static_assert(std::is_nothrow_move_assignable_v<pel::array<std::string, 4>>);
+static_assert(std::is_trivially_move_constructible_v<pel::array<float, 4>>);
+static_assert(pel::is_trivially_relocatable_v<pel::array<std::unique_ptr<int>, 4>>);
+static_assert(!pel::is_trivially_relocatable_v<pel::array<std::string, 4>>);
+
+
+/*************************************************************************************************/
+/* Bounds checking policies -------------------------------------------------------------------- */
+using UncheckedFloats = pel::array<float, 4, pel::bounds_check::unchecked>;
+using TrappingFloats  = pel::array<float, 4, pel::bounds_check::trap>;
+
+static_assert(sizeof(UncheckedFloats) == sizeof(float[4]));
+static_assert(std::is_trivially_copyable_v<UncheckedFloats>);
+static_assert(noexcept(std::declval<UncheckedFloats&>()[0]));
+static_assert(noexcept(std::declval<TrappingFloats&>()[0]));
+static_assert(noexcept(std::declval<pel::array<float, 4>&>()[0]));
+static_assert(!noexcept(std::declval<pel::array<float, 4, pel::bounds_check::checked>&>()[0]));
+static_assert(!noexcept(std::declval<UncheckedFloats&>().at(0)));
+
+constexpr UncheckedFloats uncheckedCopy{pel::array<float, 4>{1.0f, 2.0f, 3.0f, 4.0f}};
+static_assert(uncheckedCopy.unchecked(3) == 4.0f && uncheckedCopy.at(0) == 1.0f);
+
+
+/*************************************************************************************************/
+/* Construction -------------------------------------------------------------------------------- */
+struct Counted
 {
-    constexpr AAAA(T* ptr) : pointer{ptr}
+    constexpr explicit Counted(int* constructions_) : constructions{constructions_}
     {
+        ++*constructions;
     }
-    T* pointer;
-
-    constexpr virtual std::ptrdiff_t
-    operator-(const AAAA& other)
+    constexpr Counted(const Counted& copy_) : constructions{copy_.constructions}
     {
-        return pointer - other.pointer;
+        ++*constructions;
     }
+    constexpr Counted& operator=(const Counted&) = default;
+
+    int* constructions;
+};
+
+constexpr int
+count_constructions()
+{
+    int                    constructions = 0;
+    const Counted          seed{&constructions};
+    pel::array<Counted, 8> items(seed);
+    pel::array<Counted, 8> copy{items};
+    return constructions;
+}
+static_assert(count_constructions() == 1 + 8 + 8);
+static_assert(!std::is_default_constructible_v<pel::array<Counted, 8>>);
+static_assert(!std::is_constructible_v<pel::array<Counted, 8>, const pel::array<Counted, 4>&>);
+static_assert(std::is_constructible_v<pel::array<std::string, 8>, pel::array<std::string, 4>&&>);
+/* A longer array never fits, whatever the bounds-checking policy */
+using UncheckedInts = pel::array<int, 4, pel::bounds_check::unchecked>;
+static_assert(!std::is_constructible_v<UncheckedInts, const pel::array<int, 8>&>);
+static_assert(!std::is_constructible_v<UncheckedInts, pel::array<int, 8>&&>);
+static_assert(!std::is_assignable_v<UncheckedInts&, const pel::array<int, 8>&>);
+static_assert(!std::is_assignable_v<UncheckedInts&, pel::array<int, 8>&&>);
+static_assert(std::is_assignable_v<UncheckedInts&, const pel::array<int, 2>&>);
+static_assert(std::is_trivially_copyable_v<pel::array<pel::array<float, 4>, 4>>);
+
+
+/*************************************************************************************************/
+/* Aligned and padded arrays ------------------------------------------------------------------- */
+static_assert(alignof(pel::aligned_array<float, 3, 32>) == 32);
+static_assert(sizeof(pel::aligned_array<float, 16, 32>) == sizeof(float[16]));
+static_assert(std::is_trivially_copyable_v<pel::aligned_array<float, 16, 32>>);
+static_assert(pel::is_array<pel::aligned_array<float, 16, 32>>);
+
+static_assert(sizeof(pel::padded_array<std::uint64_t, 4>) == 4 * pel::cache_line_bytes);
+static_assert(std::random_access_iterator<pel::padded_array<int, 4>::IteratorType>);
+
+
+/*************************************************************************************************/
+/* Structure of arrays ------------------------------------------------------------------------- */
+struct Sample
+{
+    float         value;
+    std::uint32_t timestamp;
 };
 
-template<typename T>
-struct ptrType : public AAAA<T>
+static_assert(pel::soa_array<Sample, 16>::field_count == 2);
+static_assert(sizeof(pel::soa_array<Sample, 16>) == sizeof(float[16]) + sizeof(std::uint32_t[16]));
+
+constexpr pel::soa_array<Sample, 4> samples{Sample{1.5f, 10}, Sample{2.5f, 20}};
+static_assert(samples.column<1>()[1] == 20 && static_cast<Sample>(samples[0]).value == 1.5f);
+
+
+/*************************************************************************************************/
+/* Views --------------------------------------------------------------------------------------- */
+static_assert(sizeof(pel::array_view<float, 16>) == sizeof(float*));
+static_assert(std::is_trivially_copyable_v<pel::array_view<float>>);
+static_assert(pel::is_array<pel::array_view<const float, 16>>);
+static_assert(std::random_access_iterator<pel::strided_view<float>::IteratorType>);
+
+constexpr pel::array<int, 6> interleaved{1, 10, 2, 20, 3, 30};
+static_assert(interleaved.subarray<2, 2>().front() == 2 && interleaved.slice(1, 3).back() == 20);
+static_assert(interleaved.strided(2).size() == 3 && interleaved.strided(2, 1)[2] == 30);
+
+/* An expression reading a view shifted from the one it's assigned to reads the original items */
+static_assert([]
+{
+    pel::array<int, 6> items{0, 1, 2, 3, 4, 5};
+    items.slice<5>(1) = items.slice<5>(0) * 3;
+    return items[1] == 0 && items[2] == 3 && items[5] == 12;
+}());
+static_assert(noexcept(std::declval<const pel::array_view<int, 5>&>()
+                       = std::declval<pel::array_view<int, 5>&>() * 3));
+
+
+
+/*************************************************************************************************/
+/* Expressions and reductions ------------------------------------------------------------------ */
+/* 37 items is a multiple of no lane count, so that the scalar tail is covered as well */
+constexpr pel::array<int, 37> ramp = pel::generate<37>([](std::size_t index_)
+                                                       { return static_cast<int>(index_) - 10; });
+constexpr pel::array<int, 37> twos(2);
+
+constexpr pel::array<int, 37> arithmetic = (ramp + twos) * ramp - ramp / twos;
+static_assert(arithmetic[0] == (-10 + 2) * -10 - (-10 / 2) && arithmetic[36] == 28 * 26 - 13);
+
+constexpr pel::array<int, 37> broadcast = 3 * ramp + 1;
+static_assert(broadcast[0] == -29 && broadcast[11] == 4 && broadcast[36] == 79);
+
+constexpr pel::array<bool, 37> positives = ramp > 0;
+static_assert(!positives[10] && positives[11] && positives[36]);
+static_assert(pel::any(ramp == 26) && !pel::any(ramp == 27) && pel::all(ramp >= -10));
+
+constexpr pel::array<int, 37> clamped = pel::select(ramp < 0, twos, ramp);
+static_assert(clamped[0] == 2 && clamped[9] == 2 && clamped[36] == 26);
+
+static_assert(pel::sum(ramp) == 37 * 8 && pel::dot(ramp, twos) == 37 * 8 * 2);
+static_assert(pel::dot(ramp, ramp) == 385 + 6201);
+static_assert(pel::min(ramp) == -10 && pel::max(ramp) == 26);
+static_assert(pel::min(ramp * -1) == -26 && pel::argmin(ramp * -1) == 36);
+static_assert(pel::argmin(ramp) == 0 && pel::argmax(ramp) == 36);
+
+constexpr pel::array<std::uint8_t, 37> bytes(200);
+static_assert(pel::sum(bytes) == 37 * 200 && pel::dot(bytes, bytes) == 37 * 200 * 200);
+
+/* A leading NaN is skipped, like `std::fmin` does */
+constexpr pel::array<float, 37> halves = pel::generate<37>(
+  [](std::size_t index_)
+  {
+      return (index_ == 0) ? std::numeric_limits<float>::quiet_NaN()
+                           : 0.5f * static_cast<float>(index_);
+  });
+static_assert(pel::min(halves) == 0.5f && pel::argmin(halves) == 1 && pel::argmax(halves) == 36);
+
+/* Scalars convert to the item type, except floating-point scalars for integer items */
+constexpr pel::array<float, 37> quarters = pel::fma(halves, 0.5, 0.0) * 2.0 - halves * 0.5;
+static_assert(quarters[1] == 0.25f && quarters[36] == 9.0f);
+static_assert(pel::array<std::uint8_t, 37>{bytes + 300}[0] == 244);
+template<typename LhsType, typename RhsType>
+concept multipliable = requires(const LhsType& lhs_, const RhsType& rhs_) { lhs_ * rhs_; };
+static_assert(!multipliable<decltype(ramp), double> && multipliable<decltype(ramp), long>);
+
+/*************************************************************************************************/
+/* Multidimensional arrays --------------------------------------------------------------------- */
+using TiledGrid =
+  pel::basic_md_array<float, pel::layout::tiled<8, 8>, pel::default_bounds_check, 64, 64>;
+
+static_assert(sizeof(pel::md_array<float, 4, 4>) == sizeof(float[4][4]));
+static_assert(std::is_trivially_copyable_v<TiledGrid>);
+static_assert(pel::md_array<float, 4, 8>::offset(1, 2) == 10);
+static_assert(TiledGrid::offset(0, 8) == 64 && TiledGrid::offset(9, 1) == 8 * 64 + 9);
+
+constexpr pel::md_array<int, 2, 3> grid{pel::array<int, 6>{1, 2, 3, 4, 5, 6}};
+static_assert(grid(1, 0) == 4 && grid.get<0, 2>() == 3 && grid.column(1).back() == 5);
+
+
+/*************************************************************************************************/
+/* Heap arrays --------------------------------------------------------------------------------- */
+static_assert(pel::heap_array<double, 1 << 24>::size() == 1 << 24);
+static_assert(sizeof(pel::heap_array<double, 1 << 24>) < pel::cache_line_bytes);
+
+
+/*************************************************************************************************/
+/* Array pools --------------------------------------------------------------------------------- */
+static_assert(pel::array_pool<float, 1024>::chunk_capacity == 16);
+static_assert(pel::array_pool<pel::array<double, 3>, 1>::slot_bytes == sizeof(double[3]));
+
+
+/*************************************************************************************************/
+/* Ring buffers -------------------------------------------------------------------------------- */
+static_assert(alignof(pel::ring_array<int, 64>) == pel::cache_line_bytes);
+static_assert(pel::ring_array<int, 64>::masked_indexes);
+static_assert(!pel::ring_array<int, 48, pel::ring_mode::mpmc>::masked_indexes);
+static_assert(pel::ring_array<int, 48, pel::ring_mode::mpmc>::capacity() == 48);
+
+
+/*************************************************************************************************/
+/* Fixed-capacity vectors ---------------------------------------------------------------------- */
+static_assert(sizeof(pel::static_vector<std::uint8_t, 16>) == 17);
+static_assert(std::is_same_v<pel::static_vector<int, 300>::LengthType, std::uint16_t>);
+static_assert(std::is_trivially_copyable_v<pel::static_vector<float, 8>>);
+static_assert(!std::is_trivially_copyable_v<pel::static_vector<std::string, 8>>);
+
+constexpr int
+edit_static_vector()
+{
+    pel::static_vector<int, 8> items{1, 2, 3};
+    items.push_back(4);
+    items.insert(items.begin() + 1, 9);
+    items.erase(items.begin(), items.begin() + 2);
+    items.resize(5);
+    return items[0] * 100 + items[1] * 10 + items[2] + static_cast<int>(items.size()) * 1000;
+}
+static_assert(edit_static_vector() == 5234);
+
+
+/*************************************************************************************************/
+/* Sorting and searching ----------------------------------------------------------------------- */
+static_assert(pel::sort_network<8>.size() == 19);
+
+constexpr pel::array<int, 8> sortedScores = []
 {
-    constexpr ptrType(T* ptr) : AAAA{ptr}
+    pel::array<int, 8> scores{7, 3, 9, 1, 8, 2, 6, 4};
+    pel::sort(scores, std::greater<>{});
+    return scores;
+}();
+static_assert(sortedScores.front() == 9 && sortedScores.back() == 1);
+static_assert(pel::lower_bound(sortedScores, 5, std::greater<>{}) == 4);
+
+/* Items tied under the comparator are all kept, in some order */
+static_assert([]
+{
+    constexpr pel::array<int, 8> items{1, -1, 2, -2, 0, 3, -3, 4};
+    pel::array<int, 8>           sorted = items;
+    pel::sort(sorted,
+              [](int lhs_, int rhs_)
+              { return (lhs_ < 0 ? -lhs_ : lhs_) < (rhs_ < 0 ? -rhs_ : rhs_); });
+    for(const int item : items)
     {
+        if(std::count(sorted.begin(), sorted.end(), item) != 1)
+        {
+            return false;
+        }
     }
+    return sorted[0] == 0 && sorted[7] == 4;
+}());
 
-    
-};
+constexpr pel::eytzinger_array<int, 8> scoreTable{sortedScores};
+static_assert(scoreTable.contains(6) && !scoreTable.contains(5) && *scoreTable.lower_bound(5) == 6);
+
+
+/*************************************************************************************************/
+/* Fixed-capacity hash tables ------------------------------------------------------------------ */
+constexpr pel::fixed_flat_map<std::string_view, int, 4> statusCodes{
+  {"ok", 200}, {"not found", 404}, {"teapot", 418}};
+static_assert(*statusCodes.find("teapot") == 418 && statusCodes.find("gone") == nullptr);
+static_assert(statusCodes.size() == 3 && decltype(statusCodes)::slot_count == 16);
+
+constexpr pel::fixed_flat_set<int, 64> primes{2, 3, 5, 7, 11, 13};
+static_assert(primes.contains(11) && !primes.contains(9));
+
+/* Erasing keys of full groups and inserting others never runs out of free slots */
+static_assert([]
+{
+    pel::fixed_flat_set<int, 14> window;
+    for(int key = 0; key < 14; ++key)
+    {
+        window.insert(key);
+    }
+    for(int key = 14; key < 200; ++key)
+    {
+        if(!window.erase(key - 14) || !window.insert(key) || window.contains(key - 14))
+        {
+            return false;
+        }
+    }
+    return window.size() == 14 && window.contains(186) && window.contains(199);
+}());
+
+
+/*************************************************************************************************/
+/* Gather, scatter and masked assignment ------------------------------------------------------- */
+constexpr pel::array<int, 6> permuted = []
+{
+    constexpr pel::array<int, 4>      digits{10, 20, 30, 40};
+    constexpr pel::array<unsigned, 6> indices{3, 3, 2, 1, 0, 0};
+    pel::array<int, 6>                items{};
+    items.gather(digits, indices);
+    return items;
+}();
+static_assert(permuted.front() == 40 && permuted[2] == 30 && permuted.back() == 10);
+
+constexpr pel::array<int, 6> masked = []
+{
+    constexpr pel::array<bool, 6> odd{false, true, false, true, false, true};
+    pel::array<int, 6>            items{};
+    items.assign(permuted, 0);
+    items.assign_if(odd, -1);
+    return items;
+}();
+static_assert(masked[0] == 40 && masked[1] == -1 && masked[4] == 10 && masked[5] == -1);
+
+static_assert([]
+{
+    constexpr pel::array<bool, 6> kept{true, false, false, true, true, false};
+    pel::array<int, 6>            compressed{};
+    pel::array<int, 6>            expanded{};
+    const std::size_t             count = permuted.compress(kept, compressed);
+    return count == 3 && compressed[1] == 20 && expanded.expand(kept, compressed) == 3
+           && expanded[3] == 20 && expanded[1] == 0;
+}());
+
+
+/*************************************************************************************************/
+/* Bit-packed arrays --------------------------------------------------------------------------- */
+static_assert(sizeof(pel::packed_array<std::uint8_t, 1024, 3>) == 1024 * 3 / 8);
+static_assert(std::random_access_iterator<pel::packed_array<int, 10, 4>::IteratorType>);
+
+constexpr pel::packed_array<int, 10, 4> nibbles = []
+{
+    pel::packed_array<int, 10, 4> items{1, -2, 3, 17};
+    items.back() = -8;
+    return items;
+}();
+static_assert(nibbles[1] == -2 && nibbles[3] == 1 && nibbles.back() == -8
+              && nibbles.unpack()[2] == 3);
+
+constexpr pel::packed_array<bool, 100, 1> evens([](std::size_t index_)
+                                                { return index_ % 2 == 0; });
+static_assert(evens.count() == 50 && (~evens).count() == 50 && (evens & ~evens).none());
+
+
+/*************************************************************************************************/
+/* Instrumentation ----------------------------------------------------------------------------- */
+/* Counted at runtime with `-DPEL_ARRAY_INSTRUMENTATION=1`, never in constant expressions */
+static_assert([]
+{
+    pel::array<std::string, 2> source{std::string("copied"), std::string("moved")};
+    pel::array<std::string, 4> copied{source};
+    pel::array<std::string, 4> moved{std::move(source)};
+    return copied[0] == "copied" && moved[1] == "moved" && copied[3].empty();
+}());
 
-constexpr std::size_t
-foo()
+
+/*************************************************************************************************/
+/* Compile-time generated tables --------------------------------------------------------------- */
+constexpr auto crc32Table = pel::generate<256>(
+  [](std::size_t index_)
+  {
+      std::uint32_t crc = static_cast<std::uint32_t>(index_);
+      for(int bit = 0; bit < 8; ++bit)
+      {
+          crc = (crc & 1U) ? (0xEDB88320U ^ (crc >> 1U)) : (crc >> 1U);
+      }
+      return crc;
+  });
+static_assert(crc32Table[1] == 0x77073096U);
+static_assert(crc32Table[255] == 0x2D02EF8DU);
+
+constexpr auto powersOfTwo = pel::generate<8>([value = 1]() mutable { return value *= 2; });
+static_assert(powersOfTwo.front() == 2 && powersOfTwo.back() == 256);
+
+/*************************************************************************************************/
+/* Runtime checks ------------------------------------------------------------------------------ */
+/* The parallel algorithms give the same results whatever the number of threads */
+bool
+check_parallel()
 {
-    int array[5] = {0};
+    using LargeArray = pel::array<float, 100000>;
+    static_assert(LargeArray::size() > pel::parallel::serial_cutoff<float>);
+
+    pel::thread_pool singleThread{0};
+    pel::thread_pool fourThreads{3};
+
+    const auto run = [](pel::thread_pool& pool_)
+    {
+        const pel::parallel::options options{.pool = &pool_};
+
+        auto items   = std::make_unique<LargeArray>();
+        auto squares = std::make_unique<LargeArray>();
+        for(std::size_t i = 0; i < items->size(); ++i)
+        {
+            (*items)[i] = static_cast<float>(i % 1000) / 7.0f;
+        }
 
-    AAAA<int> ptr1{&array[0]};
-    AAAA<int> ptr2{&array[5]};
-    // pel::iterator_base<int> it1{array};
-    // pel::iterator_base<int> it2{array + (sizeof(array) / sizeof(int))};
+        pel::parallel::for_each(*items, [](float& item_) { item_ = item_ * 0.5f + 1.0f; }, options);
+        pel::parallel::transform(
+          *items, *squares, [](float item_) { return item_ * item_; }, options);
+        const float total = pel::parallel::reduce(*squares, 0.0f, std::plus<>{}, options);
+        return std::make_pair(std::move(squares), total);
+    };
 
-    return ptr2 - ptr1;
+    const auto [singleSquares, singleTotal] = run(singleThread);
+    const auto [fourSquares, fourTotal]     = run(fourThreads);
+
+    /* Workers write the `bool` partials of neighbouring chunks at the same time */
+    auto flags = std::make_unique<pel::array<int, 100000>>();
+    flags->back() = 1;
+    const pel::parallel::options smallChunks{.grain = 64, .pool = &fourThreads};
+    const auto anySet = [](bool set_, int flag_) { return set_ || (flag_ != 0); };
+    const bool last   = pel::parallel::reduce(*flags, false, anySet, smallChunks);
+    flags->back()     = 0;
+    const bool none   = pel::parallel::reduce(*flags, false, anySet, smallChunks);
+
+    return (fourThreads.concurrency() == 4)
+           && std::equal(singleSquares->begin(), singleSquares->end(), fourSquares->begin())
+           && (singleTotal == fourTotal) && last && !none;
 }
 
+
+/* Rings keep their items in order, up to full and down to empty, across the end of their array */
+template<pel::ring_mode Mode, std::size_t Capacity>
+bool
+check_ring()
+{
+    pel::ring_array<int, Capacity, Mode> ring;
+
+    int pushed = 0;
+    int popped = 0;
+    int item   = 0;
+    while(ring.try_push(pushed))
+    {
+        ++pushed;
+    }
+    if((pushed != static_cast<int>(Capacity)) || (ring.size() != Capacity))
+    {
+        return false;
+    }
+    while(ring.try_pop(item))
+    {
+        if(item != popped++)
+        {
+            return false;
+        }
+    }
+    if((popped != pushed) || !ring.empty())
+    {
+        return false;
+    }
+
+    /* Several laps, with items and batches straddling the end of the array */
+    pel::array<int, Capacity - 1> batch{};
+    const std::span<int>          batchSpan{batch.data(), batch.size()};
+    for(std::size_t lap = 0; lap < 3 * Capacity; ++lap)
+    {
+        for(int& batchItem : batch)
+        {
+            batchItem = pushed++;
+        }
+        if((ring.push(batchSpan) != batch.size()) || !ring.try_push(pushed++)
+           || ring.try_push(-1))
+        {
+            return false;
+        }
+
+        if((ring.pop(batchSpan) != batch.size()) || !ring.try_pop(item))
+        {
+            return false;
+        }
+        for(const int batchItem : batch)
+        {
+            if(batchItem != popped++)
+            {
+                return false;
+            }
+        }
+        if((item != popped++) || ring.try_pop(item) || !ring.try_push(pushed++)
+           || !ring.try_pop(item) || (item != popped++))
+        {
+            return false;
+        }
+    }
+    return ring.empty();
+}
+
+
+/* Items pushed by concurrent producers are each popped exactly once, and every consumer sees the
+ * items of a producer in the order they were pushed */
+template<pel::ring_mode Mode>
+bool
+check_ring_threads(std::size_t producers_, std::size_t consumers_)
+{
+    constexpr int itemsPerProducer = 20000;
+
+    pel::ring_array<int, 8, Mode> ring;
+    std::atomic<int>              remaining{static_cast<int>(producers_) * itemsPerProducer};
+    std::vector<std::vector<int>> consumed(consumers_);
+    std::vector<std::thread>      threads;
+
+    for(std::size_t producer = 0; producer < producers_; ++producer)
+    {
+        threads.emplace_back(
+          [&ring, first = static_cast<int>(producer) * itemsPerProducer]
+          {
+              for(int item = first; item < first + itemsPerProducer; ++item)
+              {
+                  while(!ring.try_push(item))
+                  {
+                      std::this_thread::yield();
+                  }
+              }
+          });
+    }
+    for(std::vector<int>& items : consumed)
+    {
+        threads.emplace_back(
+          [&ring, &remaining, &items]
+          {
+              int item = 0;
+              while(remaining.load() > 0)
+              {
+                  if(ring.try_pop(item))
+                  {
+                      items.push_back(item);
+                      --remaining;
+                  }
+                  else
+                  {
+                      std::this_thread::yield();
+                  }
+              }
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for(const std::vector<int>& items : consumed)
+    {
+        std::vector<int> lastOfProducer(producers_, -1);
+        for(const int item : items)
+        {
+            int& last = lastOfProducer[static_cast<std::size_t>(item / itemsPerProducer)];
+            if(item <= last)
+            {
+                return false;
+            }
+            last = item;
+        }
+        all.insert(all.end(), items.begin(), items.end());
+    }
+
+    std::sort(all.begin(), all.end());
+    for(std::size_t i = 0; i < all.size(); ++i)
+    {
+        if(all[i] != static_cast<int>(i))
+        {
+            return false;
+        }
+    }
+    return ring.empty() && (all.size() == producers_ * itemsPerProducer);
+}
+
+
+/* Expressions reading a view shifted from the one they're assigned to, in either direction or
+ * in both, read the original items, even for views too large for a temporary on the stack */
+bool
+check_view()
+{
+    pel::array<int, 37> ahead{[](std::size_t i_) { return static_cast<int>(i_); }};
+    pel::array<int, 37> behind{ahead};
+    pel::array<int, 37> both{ahead};
+    ahead.slice<35>(0)  = ahead.slice<35>(2) * 2;
+    behind.slice<35>(2) = behind.slice<35>(0) * 2;
+    both.slice<35>(1)   = both.slice<35>(0) + both.slice<35>(2);
+    for(int i = 0; i < 35; ++i)
+    {
+        const std::size_t index = static_cast<std::size_t>(i);
+        if((ahead[index] != (i + 2) * 2) || (behind[index + 2] != i * 2)
+           || (both[index + 1] != i + (i + 2)))
+        {
+            return false;
+        }
+    }
+
+    constexpr std::size_t                largeCount = std::size_t{1} << 22;
+    constexpr int                        largeLast  = static_cast<int>(largeCount);
+    pel::heap_array<int, largeCount + 2> large{};
+    std::iota(large.begin(), large.end(), 0);
+    large->slice<largeCount + 1>(1) = large->slice<largeCount + 1>(0) * 2;
+    large->slice<largeCount>(1)     = large->slice<largeCount>(0) + large->slice<largeCount>(2);
+    return (large[2] == 4) && (large[largeCount] == 4 * largeLast - 4)
+           && (large->back() == 2 * largeLast);
+}
+
+
+/* Single-pass ranges longer than the capacity throw instead of writing past the items, and the
+ * items already built are destroyed again */
+bool
+check_static_vector()
+{
+    using CheckedStrings = pel::static_vector<std::string, 4, pel::bounds_check::checked>;
+
+    std::istringstream fits{"a b c d"};
+    const CheckedStrings full{std::istream_iterator<std::string>{fits},
+                              std::istream_iterator<std::string>{}};
+    if((full.size() != 4) || (full.back() != "d"))
+    {
+        return false;
+    }
+
+    /* Erasing an empty range leaves the following items alone */
+    CheckedStrings erased{full};
+    if((erased.erase(erased.begin() + 1, erased.begin() + 1) != erased.begin() + 1)
+       || (erased.size() != 4) || !std::equal(erased.begin(), erased.end(), full.begin()))
+    {
+        return false;
+    }
+
+    std::istringstream tooLong{"a b c d e f g h i j"};
+    try
+    {
+        const CheckedStrings overflow{std::istream_iterator<std::string>{tooLong},
+                                      std::istream_iterator<std::string>{}};
+        return false;
+    }
+    catch(const std::length_error&)
+    {
+        return true;
+    }
+}
+
+
+/* Maps keep finding their entries while a sliding window of keys is erased and inserted, which
+ * leaves `deleted` slots behind until the keys are rehashed in place */
+bool
+check_flat_map()
+{
+    constexpr int windowSize = 47;
+
+    pel::fixed_flat_map<int, int, 48> map;
+    for(int key = 0; key < windowSize; ++key)
+    {
+        map.insert(key, -key);
+    }
+
+    for(int first = 1; first < 5000; ++first)
+    {
+        const int last = first + windowSize - 1;
+        if(!map.erase(first - 1) || !map.insert(last, -last).second || (map.size() != windowSize))
+        {
+            return false;
+        }
+        for(int key = first - 4; key <= last + 4; ++key)
+        {
+            const int* value    = map.find(key);
+            const bool expected = (key >= first) && (key <= last);
+            if((value != nullptr) != expected || (expected && (*value != -key)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/* Freed slots are reused, by the freeing thread first and through the shared free list once its
+ * magazine overflows */
+bool
+check_pool()
+{
+    using PoolType = pel::array_pool<float, 16>;
+    PoolType pool;
+
+    PoolType::handle first   = pool.make();
+    const float*     address = first->data();
+    first.reset();
+    PoolType::handle second = pool.make_for_overwrite();
+    if((second->data() != address) || (pool.chunk_count() != 1))
+    {
+        return false;
+    }
+    second.reset();
+
+    std::vector<PoolType::handle> handles;
+    std::vector<const float*>     addresses;
+    for(std::size_t i = 0; i < 2 * PoolType::magazine_size; ++i)
+    {
+        handles.push_back(pool.make());
+        addresses.push_back(handles.back()->data());
+    }
+    handles.clear();
+
+    /* Another thread has an empty magazine of its own, and takes the slots pushed on the free
+     * list when this thread's magazine overflowed */
+    const float* otherAddress = nullptr;
+    std::thread  other{[&] { otherAddress = pool.make()->data(); }};
+    other.join();
+    return std::find(addresses.begin(), addresses.end(), otherAddress) != addresses.end();
+}
+
+
+#if PEL_ARRAY_INSTRUMENTATION
+/* Every copy, move and failed check of an instantiation is counted once, including those of a
+ * thread that already exited, until the counts are reset */
+bool
+check_instrumentation()
+{
+    using Strings = pel::array<std::string, 3, pel::bounds_check::checked>;
+    using pel::instrumentation::counters;
+
+    /* Adds up the entries, so that only the instantiation counted since the reset shows */
+    const auto total = []
+    {
+        counters sum;
+        for(const pel::instrumentation::report_entry& entry : pel::instrumentation::report())
+        {
+            sum.constructions += entry.counts.constructions;
+            sum.copies += entry.counts.copies;
+            sum.moves += entry.counts.moves;
+            sum.checkFailures += entry.counts.checkFailures;
+            sum.bytesMoved += entry.counts.bytesMoved;
+        }
+        return sum;
+    };
+    const auto matches = [](const counters& counts_,
+                            std::uint64_t   constructions_,
+                            std::uint64_t   copies_,
+                            std::uint64_t   moves_,
+                            std::uint64_t   checkFailures_)
+    {
+        return (counts_.constructions == constructions_) && (counts_.copies == copies_)
+               && (counts_.moves == moves_) && (counts_.checkFailures == checkFailures_)
+               && (counts_.bytesMoved == (copies_ + moves_) * sizeof(std::string));
+    };
+
+    pel::instrumentation::reset();
+    {
+        Strings source{std::string("a"), std::string("b"), std::string("c")};
+        Strings copied{source};
+        Strings moved{std::move(copied)};
+        copied = source;
+        moved.assign(std::vector<std::string>{"x"}, 1);
+        try
+        {
+            moved.assign(std::vector<std::string>(4), 0);
+            return false;
+        }
+        catch(const std::length_error&)
+        {
+        }
+
+        std::thread worker{[&source] { const Strings local{source}; }};
+        worker.join();
+    }
+
+    /* 4 arrays built, 3 + 3 + 3 + 1 + 3 items copied and 3 moved */
+    if(!matches(total(), 12, 13, 3, 1))
+    {
+        return false;
+    }
+
+    pel::instrumentation::reset();
+    if(!matches(total(), 0, 0, 0, 0))
+    {
+        return false;
+    }
+
+    const Strings source{};
+    const Strings copied{source};
+    return matches(total(), 6, 3, 0, 0);
+}
+#endif
+
+
+/* Arrays format to the expected text, and read back what they serialized, even from a machine of
+ * the other byte order */
+bool
+check_format()
+{
+    const pel::array<int, 3>    ints{1, -20, 300};
+    const pel::array<double, 3> doubles{0.5, -1.25, 3.0};
+
+    const pel::format_options brackets{.prefix = "[", .suffix = "]"};
+    const pel::format_options fixed{.floatFormat = std::chars_format::fixed, .precision = 2};
+    if((pel::format(ints) != "1, -20, 300") || (pel::format(ints, brackets) != "[1, -20, 300]")
+       || (pel::format(doubles) != "0.5, -1.25, 3")
+       || (pel::format(doubles, fixed) != "0.50, -1.25, 3.00"))
+    {
+        return false;
+    }
+
+    /* Explicit precisions can outgrow the first allocation of `format` */
+    const pel::array<double, 2> large{1e300, -1e300};
+    const std::string           largeText = pel::format(large, fixed);
+    if((largeText.size() != 301 + 3 + 2 + 1 + 301 + 3) || !largeText.ends_with(".00"))
+    {
+        return false;
+    }
+
+    /* The text fits exactly, or not at all */
+    char                       buffer[13] = {};
+    const std::to_chars_result exact      = pel::format_to(buffer, buffer + 13, ints, brackets);
+    const std::to_chars_result tooSmall   = pel::format_to(buffer, buffer + 12, ints, brackets);
+    if((exact.ec != std::errc{}) || (exact.ptr != buffer + 13)
+       || (std::string_view{buffer, 13} != "[1, -20, 300]")
+       || (tooSmall.ec != std::errc::value_too_large) || (tooSmall.ptr != buffer + 12))
+    {
+        return false;
+    }
+
+    /* Round-trip */
+    using Words = pel::array<std::uint32_t, 4>;
+    const Words                                        words{1, 0x01020304, 0xFFFF0000, 42};
+    pel::array<std::byte, pel::serialized_size(words)> stored{};
+    const std::span<std::byte>                         writeSpan{stored.data(), stored.size()};
+    const std::span<const std::byte>                   readSpan{stored.data(), stored.size()};
+    const std::byte* const                             storedEnd = stored.data() + stored.size();
+
+    const auto sameWords = [&words](const Words& read_)
+    { return std::equal(read_.begin(), read_.end(), words.begin()); };
+
+    Words read{};
+    if((pel::serialize(words, writeSpan.first(stored.size() - 1)).ec
+        != std::errc::value_too_large)
+       || (pel::serialize(words, writeSpan).ptr != storedEnd)
+       || (pel::deserialize(readSpan, read).ptr != storedEnd) || !sameWords(read))
+    {
+        return false;
+    }
+
+    /* Bad magic bytes, another item size or length, and a truncated buffer leave the array alone */
+    Words                        untouched{};
+    pel::array<std::uint16_t, 8> otherSize{};
+    pel::array<std::uint32_t, 3> otherCount{};
+    stored[0]           = std::byte{'X'};
+    const bool badMagic = pel::deserialize(readSpan, untouched).ec == std::errc::invalid_argument;
+    stored[0]           = std::byte{'P'};
+    if(!badMagic || (untouched[0] != 0)
+       || (pel::deserialize(readSpan, otherSize).ec != std::errc::invalid_argument)
+       || (pel::deserialize(readSpan, otherCount).ec != std::errc::invalid_argument)
+       || (pel::deserialize(readSpan.first(stored.size() - 1), read).ec
+           != std::errc::invalid_argument))
+    {
+        return false;
+    }
+
+    /* Written by a machine of the other byte order */
+    stored[5] ^= std::byte{1};
+    constexpr std::size_t wordBytes = sizeof(std::uint32_t);
+    for(std::size_t i = pel::serialization_header_bytes; i < stored.size(); i += wordBytes)
+    {
+        std::reverse(stored.data() + i, stored.data() + i + wordBytes);
+    }
+    read = Words{};
+    return (pel::deserialize(readSpan, read).ec == std::errc{}) && sameWords(read);
+}
+
+
 int
 main()
 {
-    constexpr std::size_t var = foo();
-    ;
+    if(!check_pool() || !check_parallel() || !check_format() || !check_view()
+       || !check_static_vector() || !check_flat_map()
+       || !check_ring<pel::ring_mode::spsc, 8>() || !check_ring<pel::ring_mode::spsc, 6>()
+       || !check_ring<pel::ring_mode::mpmc, 8>() || !check_ring<pel::ring_mode::mpmc, 6>()
+       || !check_ring_threads<pel::ring_mode::spsc>(1, 1)
+       || !check_ring_threads<pel::ring_mode::mpmc>(3, 2))
+    {
+        return 1;
+    }
+
+#if PEL_ARRAY_INSTRUMENTATION
+    if(!check_instrumentation())
+    {
+        return 1;
+    }
+#endif
 
-    return static_cast<int>(var);
+    return 0;
 }
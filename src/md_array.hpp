@@ -0,0 +1,445 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace pel
+{
+template<typename ItemType, typename Layout, typename BoundsCheck, std::size_t... Dims>
+class md_view;
+
+
+/*************************************************************************************************/
+/* Layouts ------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Order of the items of a multidimensional array in its storage.
+ *
+ * \note        A layout provides a `mapping<Dims...>` with:
+ *              - `required_size`: Number of items in the storage.
+ *              - `offset(indexes)`: Position in the storage of the item at `indexes`.
+ *              Strided layouts also provide `stride(dimension)`, the distance in the storage
+ *              between two neighbours along `dimension`. Every mapping is `constexpr`: with
+ *              indexes known at compile-time, so is the offset.
+ *************************************************************************************************/
+namespace layout
+{
+/* Last index varies fastest: rows are contiguous, as in `T[H][W]` */
+struct row_major
+{
+    template<std::size_t... Dims>
+    struct mapping
+    {
+        static constexpr std::size_t rank          = sizeof...(Dims);
+        static constexpr std::size_t required_size = (Dims * ...);
+
+        [[nodiscard]] static constexpr std::size_t
+        offset(const std::size_t (&indexes_)[rank]) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+
+            std::size_t offset = 0;
+            for(std::size_t dimension = 0; dimension < rank; ++dimension)
+            {
+                offset = (offset * extents[dimension]) + indexes_[dimension];
+            }
+            return offset;
+        }
+
+        [[nodiscard]] static constexpr std::size_t stride(std::size_t dimension_) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+
+            std::size_t stride = 1;
+            for(std::size_t dimension = rank - 1; dimension > dimension_; --dimension)
+            {
+                stride *= extents[dimension];
+            }
+            return stride;
+        }
+    };
+};
+
+/* First index varies fastest: columns are contiguous, as in Fortran or BLAS matrices */
+struct column_major
+{
+    template<std::size_t... Dims>
+    struct mapping
+    {
+        static constexpr std::size_t rank          = sizeof...(Dims);
+        static constexpr std::size_t required_size = (Dims * ...);
+
+        [[nodiscard]] static constexpr std::size_t
+        offset(const std::size_t (&indexes_)[rank]) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+
+            std::size_t offset = 0;
+            for(std::size_t dimension = rank; dimension > 0; --dimension)
+            {
+                offset = (offset * extents[dimension - 1]) + indexes_[dimension - 1];
+            }
+            return offset;
+        }
+
+        [[nodiscard]] static constexpr std::size_t stride(std::size_t dimension_) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+
+            std::size_t stride = 1;
+            for(std::size_t dimension = 0; dimension < dimension_; ++dimension)
+            {
+                stride *= extents[dimension];
+            }
+            return stride;
+        }
+    };
+};
+
+/**
+ * Blocks of `TileDims...` items stored contiguously, themselves in row-major order, and the
+ * tiles in row-major order. Neighbours along every dimension are then close in memory, which
+ * keeps stencils and transpositions within a few cache lines. Every dimension must be a
+ * multiple of its tile dimension; power-of-two tiles turn the index math into shifts and masks.
+ */
+template<std::size_t... TileDims>
+struct tiled
+{
+    template<typename ItemType, typename BoundsCheck>
+    using tile_view = md_view<ItemType, row_major, BoundsCheck, TileDims...>;
+
+    static constexpr std::size_t tile_size = (TileDims * ...);
+
+    template<std::size_t... Dims>
+    struct mapping
+    {
+        static_assert(sizeof...(TileDims) == sizeof...(Dims),
+                      "A tiled layout needs one tile dimension per array dimension");
+        static_assert(((TileDims > 0) && ...), "Tile dimensions can't be 0");
+        static_assert(((Dims % TileDims == 0) && ...),
+                      "Every dimension must be a multiple of its tile dimension");
+
+        static constexpr std::size_t rank          = sizeof...(Dims);
+        static constexpr std::size_t required_size = (Dims * ...);
+
+        [[nodiscard]] static constexpr std::size_t
+        offset(const std::size_t (&indexes_)[rank]) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+            constexpr std::size_t tiles[]   = {TileDims...};
+
+            std::size_t tileOffset = 0;
+            std::size_t itemOffset = 0;
+            for(std::size_t dimension = 0; dimension < rank; ++dimension)
+            {
+                tileOffset = (tileOffset * (extents[dimension] / tiles[dimension]))
+                             + (indexes_[dimension] / tiles[dimension]);
+                itemOffset = (itemOffset * tiles[dimension])
+                             + (indexes_[dimension] % tiles[dimension]);
+            }
+            return (tileOffset * tile_size) + itemOffset;
+        }
+
+        [[nodiscard]] static constexpr std::size_t
+        tile_offset(const std::size_t (&tileIndexes_)[rank]) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+            constexpr std::size_t tiles[]   = {TileDims...};
+
+            std::size_t tileOffset = 0;
+            for(std::size_t dimension = 0; dimension < rank; ++dimension)
+            {
+                tileOffset = (tileOffset * (extents[dimension] / tiles[dimension]))
+                             + tileIndexes_[dimension];
+            }
+            return tileOffset * tile_size;
+        }
+
+        [[nodiscard]] static constexpr std::size_t tile_count(std::size_t dimension_) noexcept
+        {
+            constexpr std::size_t extents[] = {Dims...};
+            constexpr std::size_t tiles[]   = {TileDims...};
+
+            return extents[dimension_] / tiles[dimension_];
+        }
+    };
+};
+}        // namespace layout
+
+template<typename MappingType>
+concept strided_mapping_type = requires { MappingType::stride(0); };
+
+template<typename MappingType>
+concept tiled_mapping_type = requires { MappingType::tile_offset({}); };
+
+
+/*************************************************************************************************/
+/* Multidimensional view ----------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Non-owning multidimensional view over `(Dims * ...)` items ordered by `Layout`.
+ *
+ * \note        Items are reached with `view(i, j, ...)`, one index per dimension, each checked
+ *              against its own dimension according to the `BoundsCheck` policy. Iterators walk
+ *              the items in storage order.
+ *************************************************************************************************/
+template<typename ItemType, typename Layout, typename BoundsCheck, std::size_t... Dims>
+class md_view
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType        = std::size_t;
+    using DifferenceType  = std::ptrdiff_t;
+    using ValueType       = std::remove_cv_t<ItemType>;
+    using LayoutType      = Layout;
+    using MappingType     = typename Layout::template mapping<Dims...>;
+    using IteratorType    = array_iterator<ItemType>;
+    using BoundsCheckType = BoundsCheck;
+
+    static constexpr SizeType rank = sizeof...(Dims);
+
+    static_assert(rank > 0, "A multidimensional array needs at least one dimension");
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr md_view() noexcept = default;
+    constexpr explicit md_view(ItemType* data_) noexcept;
+
+    template<typename OtherItemType>
+    requires std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+    constexpr md_view(const md_view<OtherItemType, Layout, BoundsCheck, Dims...>& other_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& operator()(IndexTypes... indexes_) const
+      noexcept(BoundsCheck::subscript::nothrow);
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& at(IndexTypes... indexes_) const;
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& unchecked(IndexTypes... indexes_) const noexcept;
+
+    template<SizeType... Indexes>
+    [[nodiscard]] constexpr ItemType& get() const noexcept;
+
+    [[nodiscard]] constexpr ItemType* data() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Sub-views ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr auto row(SizeType index_) const noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+    [[nodiscard]] constexpr auto column(SizeType index_) const noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+
+    template<std::integral... IndexTypes>
+    [[nodiscard]] constexpr auto tile(IndexTypes... tileIndexes_) const
+      noexcept(BoundsCheck::nothrow)
+    requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType begin() const noexcept;
+    [[nodiscard]] constexpr IteratorType end() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType extent(SizeType dimension_) noexcept;
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] static constexpr SizeType offset(IndexTypes... indexes_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    ItemType* m_data = nullptr;
+};
+
+
+/*************************************************************************************************/
+/* Multidimensional array ---------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Fixed-size multidimensional array, whose items are stored in a single `pel::array`
+ *              in the order given by `Layout`.
+ *
+ * \note        Unlike `pel::array<pel::array<T, W>, H>` or manual `y * W + x` math, the layout can
+ *              be changed without touching the code indexing the array, ie from `row_major` to
+ *              `tiled<8, 8>` for a transposition kernel. Offsets are computed from compile-time
+ *              strides, and at compile-time with `get<I, J>()` or constant indexes.
+ *
+ * \note        The storage is exposed through `items()`, for array expressions and reductions
+ *              over every item, and the array is trivially copyable whenever `ItemType` is.
+ *************************************************************************************************/
+template<typename ItemType, typename Layout, typename BoundsCheck, std::size_t... Dims>
+class basic_md_array
+{
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType          = std::size_t;
+    using DifferenceType    = std::ptrdiff_t;
+    using LayoutType        = Layout;
+    using MappingType       = typename Layout::template mapping<Dims...>;
+    using StorageType       = array<ItemType, MappingType::required_size, BoundsCheck>;
+    using IteratorType      = typename StorageType::IteratorType;
+    using ConstIteratorType = typename StorageType::ConstIteratorType;
+    using ViewType          = md_view<ItemType, Layout, BoundsCheck, Dims...>;
+    using ConstViewType     = md_view<const ItemType, Layout, BoundsCheck, Dims...>;
+    using BoundsCheckType   = BoundsCheck;
+
+    static constexpr SizeType rank = sizeof...(Dims);
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr explicit basic_md_array() = default;
+    constexpr explicit basic_md_array(const ItemType& value_);
+    constexpr explicit basic_md_array(const StorageType& items_);
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& operator()(IndexTypes... indexes_)
+      noexcept(BoundsCheck::subscript::nothrow);
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr const ItemType& operator()(IndexTypes... indexes_) const
+      noexcept(BoundsCheck::subscript::nothrow);
+
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& at(IndexTypes... indexes_);
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr const ItemType& at(IndexTypes... indexes_) const;
+
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr ItemType& unchecked(IndexTypes... indexes_) noexcept;
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] constexpr const ItemType& unchecked(IndexTypes... indexes_) const noexcept;
+
+    template<SizeType... Indexes>
+    [[nodiscard]] constexpr ItemType& get() noexcept;
+    template<SizeType... Indexes>
+    [[nodiscard]] constexpr const ItemType& get() const noexcept;
+
+    [[nodiscard]] constexpr StorageType&       items() noexcept;
+    [[nodiscard]] constexpr const StorageType& items() const noexcept;
+    [[nodiscard]] constexpr ItemType*          data() noexcept;
+    [[nodiscard]] constexpr const ItemType*    data() const noexcept;
+
+    constexpr void fill(const ItemType& value_);
+
+
+    /*********************************************************************************************/
+    /* Views ----------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ViewType      view() noexcept;
+    [[nodiscard]] constexpr ConstViewType view() const noexcept;
+
+    [[nodiscard]] constexpr auto row(SizeType index_) noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+    [[nodiscard]] constexpr auto row(SizeType index_) const noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+    [[nodiscard]] constexpr auto column(SizeType index_) noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+    [[nodiscard]] constexpr auto column(SizeType index_) const noexcept(BoundsCheck::nothrow)
+    requires(rank == 2 && strided_mapping_type<MappingType>);
+
+    template<std::integral... IndexTypes>
+    [[nodiscard]] constexpr auto tile(IndexTypes... tileIndexes_) noexcept(BoundsCheck::nothrow)
+    requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>);
+    template<std::integral... IndexTypes>
+    [[nodiscard]] constexpr auto tile(IndexTypes... tileIndexes_) const
+      noexcept(BoundsCheck::nothrow)
+    requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType extent(SizeType dimension_) noexcept;
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+    template<std::integral... IndexTypes>
+    requires(sizeof...(IndexTypes) == sizeof...(Dims))
+    [[nodiscard]] static constexpr SizeType offset(IndexTypes... indexes_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    StorageType m_items;
+};
+
+/* Row-major multidimensional array, ie `pel::md_array<float, 480, 640>` for a 640x480 image */
+template<typename ItemType, std::size_t... Dims>
+using md_array = basic_md_array<ItemType, layout::row_major, default_bounds_check, Dims...>;
+
+}        // namespace pel
+
+
+#include "./md_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,742 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./md_array.hpp"
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define MD_VIEW_TEMPLATE_DECLARATION__                                                             \
+    typename ItemType, typename Layout, typename BoundsCheck, std::size_t... Dims
+#define MD_VIEW_CLASS_SCOPE__ md_view<ItemType, Layout, BoundsCheck, Dims...>
+
+#define MD_ARRAY_TEMPLATE_DECLARATION__                                                            \
+    typename ItemType, typename Layout, typename BoundsCheck, std::size_t... Dims
+#define MD_ARRAY_CLASS_SCOPE__ basic_md_array<ItemType, Layout, BoundsCheck, Dims...>
+
+
+/*************************************************************************************************/
+/* MULTIDIMENSIONAL VIEW ----------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/*************************************************************************************************/
+/* Constructors -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor viewing the `size()` items starting at `data_`, ordered by `Layout`.
+ *
+ * \param       data_: Pointer to the first item of the storage.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+constexpr MD_VIEW_CLASS_SCOPE__::md_view(ItemType* data_) noexcept : m_data{data_}
+{
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Converting constructor, from a mutable view to a read-only one.
+ *
+ * \param       other_: View to copy.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<typename OtherItemType>
+requires std::is_convertible_v<OtherItemType (*)[], ItemType (*)[]>
+constexpr MD_VIEW_CLASS_SCOPE__::md_view(
+  const md_view<OtherItemType, Layout, BoundsCheck, Dims...>& other_) noexcept
+: m_data{other_.data()}
+{
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item, each index being checked against its dimension according to the
+ *              `BoundsCheck` policy.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *
+ * \throws      std::out_of_range if an index is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_VIEW_CLASS_SCOPE__::operator()(IndexTypes... indexes_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(
+      ((static_cast<SizeType>(indexes_) < Dims) && ...), "Index out of md_array bounds");
+    return m_data[offset(indexes_...)];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item, always checking its indexes.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *
+ * \throws      std::out_of_range if an index is out of bounds, whatever the policy.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_VIEW_CLASS_SCOPE__::at(IndexTypes... indexes_) const
+{
+    bounds_check::checked::check<std::out_of_range>(
+      ((static_cast<SizeType>(indexes_) < Dims) && ...), "Index out of md_array bounds");
+    return m_data[offset(indexes_...)];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item without checking its indexes, whatever the policy.
+ *
+ * \param       indexes_: One index per dimension, each lower than its dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_VIEW_CLASS_SCOPE__::unchecked(IndexTypes... indexes_) const noexcept
+{
+    return m_data[offset(indexes_...)];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access the item at indexes known at compile-time, checked at compile-time.
+ *
+ * \tparam      Indexes: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `Indexes`.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::size_t... Indexes>
+[[nodiscard]] constexpr inline ItemType&
+MD_VIEW_CLASS_SCOPE__::get() const noexcept
+{
+    static_assert(sizeof...(Indexes) == rank, "One index is needed per dimension");
+    static_assert(((Indexes < Dims) && ...), "Index out of md_array bounds");
+
+    constexpr SizeType itemOffset = MappingType::offset({Indexes...});
+    return m_data[itemOffset];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a pointer to the first item of the storage.
+ *
+ * \retval      ItemType*: Pointer to the first item of the storage, in `Layout` order.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType*
+MD_VIEW_CLASS_SCOPE__::data() const noexcept
+{
+    return m_data;
+}
+
+
+/*************************************************************************************************/
+/* Sub-views ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over a row (`row`) or a column (`column`) of a 2-dimensional view.
+ *
+ * \param       index_: Index of the row or column.
+ *
+ * \retval      `array_view<ItemType, N>` when the row or column is contiguous in the layout,
+ *              `strided_view<ItemType>` otherwise.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_VIEW_CLASS_SCOPE__::row(SizeType index_) const noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    BoundsCheck::template check<std::out_of_range>(index_ < extent(0),
+                                                   "Row out of md_array bounds");
+
+    ItemType* first = m_data + MappingType::offset({index_, 0});
+    if constexpr(MappingType::stride(1) == 1)
+    {
+        return array_view<ItemType, extent(1), BoundsCheck>{first, extent(1)};
+    }
+    else
+    {
+        return strided_view<ItemType, BoundsCheck>{first, extent(1), MappingType::stride(1)};
+    }
+}
+
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_VIEW_CLASS_SCOPE__::column(SizeType index_) const noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    BoundsCheck::template check<std::out_of_range>(index_ < extent(1),
+                                                   "Column out of md_array bounds");
+
+    ItemType* first = m_data + MappingType::offset({0, index_});
+    if constexpr(MappingType::stride(0) == 1)
+    {
+        return array_view<ItemType, extent(0), BoundsCheck>{first, extent(0)};
+    }
+    else
+    {
+        return strided_view<ItemType, BoundsCheck>{first, extent(0), MappingType::stride(0)};
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over a tile of a tiled view.
+ *
+ * \param       tileIndexes_: One tile index per dimension, ie `tile(1, 0)` for the tile holding
+ *                            the items `(TileRows, 0)` to `(2 * TileRows - 1, TileColumns - 1)`.
+ *
+ * \retval      Row-major `md_view` over the items of the tile, which are contiguous.
+ *
+ * \throws      std::out_of_range if a tile index is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+[[nodiscard]] constexpr inline auto
+MD_VIEW_CLASS_SCOPE__::tile(IndexTypes... tileIndexes_) const noexcept(BoundsCheck::nothrow)
+requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>)
+{
+    const SizeType tileIndexes[rank] = {static_cast<SizeType>(tileIndexes_)...};
+
+    bool inBounds = true;
+    for(SizeType dimension = 0; dimension < rank; ++dimension)
+    {
+        inBounds = inBounds && (tileIndexes[dimension] < MappingType::tile_count(dimension));
+    }
+    BoundsCheck::template check<std::out_of_range>(inBounds, "Tile out of md_array bounds");
+
+    using TileViewType = typename Layout::template tile_view<ItemType, BoundsCheck>;
+    return TileViewType{m_data + MappingType::tile_offset(tileIndexes)};
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first or past the last item of the storage.
+ *
+ * \retval      IteratorType: Iterator over the items in storage (`Layout`) order.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::IteratorType
+MD_VIEW_CLASS_SCOPE__::begin() const noexcept
+{
+    return IteratorType{m_data};
+}
+
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::IteratorType
+MD_VIEW_CLASS_SCOPE__::end() const noexcept
+{
+    return IteratorType{m_data + size()};
+}
+
+
+/*************************************************************************************************/
+/* Size ---------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of items along a dimension.
+ *
+ * \param       dimension_: Index of the dimension, lower than `rank`.
+ *
+ * \retval      SizeType: Number of items along `dimension_`.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::SizeType
+MD_VIEW_CLASS_SCOPE__::extent(SizeType dimension_) noexcept
+{
+    constexpr SizeType extents[] = {Dims...};
+    return extents[dimension_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the total number of items.
+ *
+ * \retval      SizeType: Product of the dimensions.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::SizeType
+MD_VIEW_CLASS_SCOPE__::length() noexcept
+{
+    return MappingType::required_size;
+}
+
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::SizeType
+MD_VIEW_CLASS_SCOPE__::size() noexcept
+{
+    return MappingType::required_size;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the position in the storage of the item at `indexes_`, without checking them.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      SizeType: Offset of the item from the first item of the storage.
+ *************************************************************************************************/
+template<MD_VIEW_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline typename MD_VIEW_CLASS_SCOPE__::SizeType
+MD_VIEW_CLASS_SCOPE__::offset(IndexTypes... indexes_) noexcept
+{
+    return MappingType::offset({static_cast<SizeType>(indexes_)...});
+}
+
+
+/*************************************************************************************************/
+/* MULTIDIMENSIONAL ARRAY ---------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/*************************************************************************************************/
+/* Constructors -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Default-value constructor for the multidimensional array class.
+ *
+ * \param       value_: Value to initialize all the items with.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+constexpr MD_ARRAY_CLASS_SCOPE__::basic_md_array(const ItemType& value_) : m_items(value_)
+{
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor copying items already in `Layout` order.
+ *
+ * \param       items_: Items of the array, in storage order.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+constexpr MD_ARRAY_CLASS_SCOPE__::basic_md_array(const StorageType& items_) : m_items(items_)
+{
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item, each index being checked against its dimension according to the
+ *              `BoundsCheck` policy.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *
+ * \throws      std::out_of_range if an index is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_ARRAY_CLASS_SCOPE__::operator()(IndexTypes... indexes_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    return view()(indexes_...);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline const ItemType&
+MD_ARRAY_CLASS_SCOPE__::operator()(IndexTypes... indexes_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    return view()(indexes_...);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item, always checking its indexes.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *
+ * \throws      std::out_of_range if an index is out of bounds, whatever the policy.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_ARRAY_CLASS_SCOPE__::at(IndexTypes... indexes_)
+{
+    return view().at(indexes_...);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline const ItemType&
+MD_ARRAY_CLASS_SCOPE__::at(IndexTypes... indexes_) const
+{
+    return view().at(indexes_...);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item without checking its indexes, whatever the policy.
+ *
+ * \param       indexes_: One index per dimension, each lower than its dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `indexes_`.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline ItemType&
+MD_ARRAY_CLASS_SCOPE__::unchecked(IndexTypes... indexes_) noexcept
+{
+    return m_items.unchecked(offset(indexes_...));
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline const ItemType&
+MD_ARRAY_CLASS_SCOPE__::unchecked(IndexTypes... indexes_) const noexcept
+{
+    return m_items.unchecked(offset(indexes_...));
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the item at indexes known at compile-time, checked at compile-time.
+ *
+ * \tparam      Indexes: One index per dimension.
+ *
+ * \retval      ItemType&: Reference to the item at `Indexes`.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... Indexes>
+[[nodiscard]] constexpr inline ItemType&
+MD_ARRAY_CLASS_SCOPE__::get() noexcept
+{
+    return view().template get<Indexes...>();
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... Indexes>
+[[nodiscard]] constexpr inline const ItemType&
+MD_ARRAY_CLASS_SCOPE__::get() const noexcept
+{
+    return view().template get<Indexes...>();
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the `pel::array` storing the items, in `Layout` order.
+ *
+ * \retval      StorageType&: Storage of the array, usable in array expressions and reductions.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::StorageType&
+MD_ARRAY_CLASS_SCOPE__::items() noexcept
+{
+    return m_items;
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const typename MD_ARRAY_CLASS_SCOPE__::StorageType&
+MD_ARRAY_CLASS_SCOPE__::items() const noexcept
+{
+    return m_items;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a pointer to the first item of the storage.
+ *
+ * \retval      ItemType*: Pointer to the first item of the storage, in `Layout` order.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType*
+MD_ARRAY_CLASS_SCOPE__::data() noexcept
+{
+    return m_items.data();
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType*
+MD_ARRAY_CLASS_SCOPE__::data() const noexcept
+{
+    return m_items.data();
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to every item of the array.
+ *
+ * \param       value_: Value to assign.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+MD_ARRAY_CLASS_SCOPE__::fill(const ItemType& value_)
+{
+    std::fill(m_items.begin(), m_items.end(), value_);
+}
+
+
+/*************************************************************************************************/
+/* Views --------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get a multidimensional view over the whole array.
+ *
+ * \retval      ViewType: Non-owning view of the items, with the same dimensions and layout.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::ViewType
+MD_ARRAY_CLASS_SCOPE__::view() noexcept
+{
+    return ViewType{m_items.data()};
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::ConstViewType
+MD_ARRAY_CLASS_SCOPE__::view() const noexcept
+{
+    return ConstViewType{m_items.data()};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over a row (`row`) or a column (`column`) of a 2-dimensional array.
+ *
+ * \param       index_: Index of the row or column.
+ *
+ * \retval      `array_view<ItemType, N>` when the row or column is contiguous in the layout,
+ *              `strided_view<ItemType>` otherwise.
+ *
+ * \throws      std::out_of_range if `index_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::row(SizeType index_) noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    return view().row(index_);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::row(SizeType index_) const noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    return view().row(index_);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::column(SizeType index_) noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    return view().column(index_);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::column(SizeType index_) const noexcept(BoundsCheck::nothrow)
+requires(rank == 2 && strided_mapping_type<MappingType>)
+{
+    return view().column(index_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get a view over a tile of a tiled array.
+ *
+ * \param       tileIndexes_: One tile index per dimension.
+ *
+ * \retval      Row-major `md_view` over the items of the tile, which are contiguous.
+ *
+ * \throws      std::out_of_range if a tile index is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::tile(IndexTypes... tileIndexes_) noexcept(BoundsCheck::nothrow)
+requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>)
+{
+    return view().tile(tileIndexes_...);
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+[[nodiscard]] constexpr inline auto
+MD_ARRAY_CLASS_SCOPE__::tile(IndexTypes... tileIndexes_) const noexcept(BoundsCheck::nothrow)
+requires(sizeof...(IndexTypes) == rank && tiled_mapping_type<MappingType>)
+{
+    return view().tile(tileIndexes_...);
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first or past the last item of the storage.
+ *
+ * \retval      IteratorType: Iterator over the items in storage (`Layout`) order.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::IteratorType
+MD_ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return m_items.begin();
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::ConstIteratorType
+MD_ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return m_items.begin();
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::IteratorType
+MD_ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return m_items.end();
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::ConstIteratorType
+MD_ARRAY_CLASS_SCOPE__::end() const noexcept
+{
+    return m_items.end();
+}
+
+
+/*************************************************************************************************/
+/* Size ---------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of items along a dimension.
+ *
+ * \param       dimension_: Index of the dimension, lower than `rank`.
+ *
+ * \retval      SizeType: Number of items along `dimension_`.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::SizeType
+MD_ARRAY_CLASS_SCOPE__::extent(SizeType dimension_) noexcept
+{
+    return ViewType::extent(dimension_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the total number of items.
+ *
+ * \retval      SizeType: Product of the dimensions.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::SizeType
+MD_ARRAY_CLASS_SCOPE__::length() noexcept
+{
+    return MappingType::required_size;
+}
+
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::SizeType
+MD_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return MappingType::required_size;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the position in the storage of the item at `indexes_`, without checking them.
+ *
+ * \param       indexes_: One index per dimension.
+ *
+ * \retval      SizeType: Offset of the item from the first item of the storage.
+ *************************************************************************************************/
+template<MD_ARRAY_TEMPLATE_DECLARATION__>
+template<std::integral... IndexTypes>
+requires(sizeof...(IndexTypes) == sizeof...(Dims))
+[[nodiscard]] constexpr inline typename MD_ARRAY_CLASS_SCOPE__::SizeType
+MD_ARRAY_CLASS_SCOPE__::offset(IndexTypes... indexes_) noexcept
+{
+    return ViewType::offset(indexes_...);
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef MD_VIEW_TEMPLATE_DECLARATION__
+#undef MD_VIEW_CLASS_SCOPE__
+#undef MD_ARRAY_TEMPLATE_DECLARATION__
+#undef MD_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,425 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+#include "./simd.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Bit-packed array ---------------------------------------------------------------------------- */
+
+/* Number of 32-bit lanes the items of a `packed_array` are interleaved over */
+constexpr std::size_t packed_lanes = 8;
+
+/* Integers and booleans stored on `Bits` bits, at most 32 and at most as wide as the type */
+template<typename ItemType, std::size_t Bits>
+concept packable_item = std::is_integral_v<ItemType> && (Bits > 0) && (Bits <= 32)
+                        && (Bits <= sizeof(ItemType) * 8)
+                        && (!std::is_same_v<ItemType, bool> || (Bits == 1));
+
+template<typename ItemType,
+         std::size_t ItemCount,
+         std::size_t Bits,
+         typename BoundsCheck = default_bounds_check>
+class packed_array;
+
+/**
+ **************************************************************************************************
+ * \brief       Proxy to an item of a `packed_array`, converting to and assigned from `ItemType`.
+ *
+ * \note        Like the iterators of the array, assigning through a `const` proxy still writes to
+ *              the array: the proxy only refers to the item.
+ *************************************************************************************************/
+template<typename ArrayType>
+class packed_reference
+{
+public:
+    using ValueType = typename ArrayType::ValueType;
+
+    constexpr packed_reference(ArrayType& array_, std::size_t index_) noexcept
+    : m_array{&array_}, m_index{index_}
+    {
+    }
+    constexpr packed_reference(const packed_reference&) noexcept = default;
+
+    [[nodiscard]] constexpr operator ValueType() const noexcept;
+
+    constexpr const packed_reference& operator=(ValueType value_) const noexcept;
+    constexpr const packed_reference& operator=(const packed_reference& other_) const noexcept;
+
+    friend constexpr void swap(packed_reference lhs_, packed_reference rhs_) noexcept
+    {
+        const ValueType value = lhs_;
+        lhs_                  = static_cast<ValueType>(rhs_);
+        rhs_                  = value;
+    }
+
+private:
+    ArrayType*  m_array;
+    std::size_t m_index;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Random-access iterator over the items of a `packed_array`.
+ *
+ * \note        Dereferencing gives a `packed_reference`, or an `ItemType` for constant iterators:
+ *              like `std::vector<bool>`, the iterators model the C++20 iterator concepts but are
+ *              only legacy input iterators.
+ *************************************************************************************************/
+template<typename ArrayType, bool Const>
+class packed_iterator
+{
+    using ArrayPointerType = std::conditional_t<Const, const ArrayType*, ArrayType*>;
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type        = typename ArrayType::ValueType;
+    using difference_type   = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, value_type, packed_reference<ArrayType>>;
+
+    using ReverseIteratorType = std::reverse_iterator<packed_iterator>;
+
+    constexpr packed_iterator() noexcept = default;
+    constexpr packed_iterator(ArrayPointerType array_, std::size_t index_) noexcept
+    : m_array{array_}, m_index{index_}
+    {
+    }
+    constexpr packed_iterator(const packed_iterator<ArrayType, !Const>& other_) noexcept
+    requires Const
+    : m_array{other_.m_array}, m_index{other_.m_index}
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept
+    {
+        return m_array->unchecked(m_index);
+    }
+    [[nodiscard]] constexpr reference operator[](difference_type offset_) const noexcept
+    {
+        return m_array->unchecked(m_index + static_cast<std::size_t>(offset_));
+    }
+
+    constexpr packed_iterator& operator++() noexcept
+    {
+        ++m_index;
+        return *this;
+    }
+    constexpr packed_iterator operator++(int) noexcept
+    {
+        packed_iterator previous = *this;
+        ++m_index;
+        return previous;
+    }
+    constexpr packed_iterator& operator--() noexcept
+    {
+        --m_index;
+        return *this;
+    }
+    constexpr packed_iterator operator--(int) noexcept
+    {
+        packed_iterator previous = *this;
+        --m_index;
+        return previous;
+    }
+
+    constexpr packed_iterator& operator+=(difference_type offset_) noexcept
+    {
+        m_index += static_cast<std::size_t>(offset_);
+        return *this;
+    }
+    constexpr packed_iterator& operator-=(difference_type offset_) noexcept
+    {
+        m_index -= static_cast<std::size_t>(offset_);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr packed_iterator operator+(packed_iterator it_,
+                                                             difference_type offset_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr packed_iterator operator+(difference_type offset_,
+                                                             packed_iterator it_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr packed_iterator operator-(packed_iterator it_,
+                                                             difference_type offset_) noexcept
+    {
+        return it_ -= offset_;
+    }
+    [[nodiscard]] friend constexpr difference_type operator-(const packed_iterator& lhs_,
+                                                             const packed_iterator& rhs_) noexcept
+    {
+        return static_cast<difference_type>(lhs_.m_index - rhs_.m_index);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const packed_iterator&) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const packed_iterator&) const noexcept = default;
+
+private:
+    friend class packed_iterator<ArrayType, true>;
+
+    ArrayPointerType m_array = nullptr;
+    std::size_t      m_index = 0;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Fixed-size array of small integers, each stored on `Bits` bits.
+ *
+ * \note        Items are interleaved over `packed_lanes` streams of 32-bit words: item `i` is the
+ *              `i / 8`th item of stream `i % 8`, and the `k`th word of every stream are stored
+ *              next to each other. Every group of 8 consecutive items then sits at the same bit
+ *              offset of 8 adjacent words, so that `pack` and `unpack` convert 8 items with a few
+ *              vector shifts, whatever `Bits` is. The layout doesn't depend on the target.
+ *
+ * \note        Like bit-fields, items are truncated to their low `Bits` bits when written, and
+ *              signed items are sign-extended when read.
+ *
+ * \note        The interface otherwise follows `pel::array`, including its `BoundsCheck` policy.
+ *              Items are accessed through `packed_reference` proxies. Arrays of single bits also
+ *              get word-level popcounts and bitwise operators.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, std::size_t Bits, typename BoundsCheck>
+class packed_array
+{
+    static_assert(packable_item<ItemType, Bits>,
+                  "Packed items are integers or booleans on at most 32 bits, and as many bits as "
+                  "their type holds");
+    static_assert(ItemCount > 0, "A packed array holds at least one item");
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType            = std::size_t;
+    using DifferenceType      = std::ptrdiff_t;
+    using ValueType           = ItemType;
+    using WordType            = std::uint32_t;
+    using ReferenceType       = packed_reference<packed_array>;
+    using IteratorType        = packed_iterator<packed_array, false>;
+    using ConstIteratorType   = packed_iterator<packed_array, true>;
+    using RIteratorType       = typename IteratorType::ReverseIteratorType;
+    using ConstRIteratorType  = typename ConstIteratorType::ReverseIteratorType;
+    using InitializerListType = std::initializer_list<ItemType>;
+    using BoundsCheckType     = BoundsCheck;
+
+    static constexpr SizeType bits = Bits;
+
+    /* Streams hold `lane_length` items each, on `row_count` words each */
+    static constexpr SizeType lane_length = (ItemCount + packed_lanes - 1) / packed_lanes;
+    static constexpr SizeType row_count   = (lane_length * Bits + 31) / 32;
+    static constexpr SizeType word_count  = row_count * packed_lanes;
+
+    /* Every 32 groups of `packed_lanes` items fill `Bits` rows of words: blocks of `block_length`
+     * items are unpacked and packed with shifts known at compile time */
+    static constexpr SizeType block_length = 32 * packed_lanes;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr packed_array() noexcept = default;
+    constexpr explicit packed_array(const ItemType& value_) noexcept;
+    constexpr packed_array(InitializerListType ilist_);
+
+    template<typename OtherBoundsCheck>
+    constexpr explicit packed_array(const array<ItemType, ItemCount, OtherBoundsCheck>& items_);
+
+    template<array_generator_type<ItemType> GeneratorType>
+    constexpr explicit packed_array(GeneratorType&& generator_);
+    template<array_indexed_generator_type<ItemType> GeneratorType>
+    constexpr explicit packed_array(GeneratorType&& generator_);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cbegin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cend() const noexcept;
+
+    [[nodiscard]] constexpr RIteratorType      rbegin() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType      rend() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ReferenceType
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr ItemType
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] constexpr ReferenceType at(SizeType index_);
+    [[nodiscard]] constexpr ItemType      at(SizeType index_) const;
+    [[nodiscard]] constexpr ReferenceType unchecked(SizeType index_) noexcept;
+    [[nodiscard]] constexpr ItemType      unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ReferenceType front() noexcept;
+    [[nodiscard]] constexpr ItemType      front() const noexcept;
+    [[nodiscard]] constexpr ReferenceType back() noexcept;
+    [[nodiscard]] constexpr ItemType      back() const noexcept;
+
+    [[nodiscard]] constexpr WordType*       words() noexcept;
+    [[nodiscard]] constexpr const WordType* words() const noexcept;
+
+    constexpr void fill(const ItemType& value_) noexcept;
+    constexpr void assign(const ItemType& value_, DifferenceType offset_ = 0, SizeType count_ = 1);
+    constexpr void assign(InitializerListType ilist_, DifferenceType offset_ = 0);
+
+
+    /*********************************************************************************************/
+    /* Bulk conversions ------------------------------------------------------------------------ */
+    template<SizeType Count, typename OtherBoundsCheck>
+    constexpr void unpack(array<ItemType, Count, OtherBoundsCheck>& destination_,
+                          SizeType                                  offset_ = 0) const;
+    [[nodiscard]] constexpr array<ItemType, ItemCount, BoundsCheck> unpack() const;
+
+    template<SizeType Count, typename OtherBoundsCheck>
+    constexpr void pack(const array<ItemType, Count, OtherBoundsCheck>& source_,
+                        SizeType                                        offset_ = 0);
+
+
+    /*********************************************************************************************/
+    /* Single-bit operations ------------------------------------------------------------------- */
+    [[nodiscard]] constexpr SizeType count() const noexcept requires(Bits == 1);
+    [[nodiscard]] constexpr bool     all() const noexcept requires(Bits == 1);
+    [[nodiscard]] constexpr bool     any() const noexcept requires(Bits == 1);
+    [[nodiscard]] constexpr bool     none() const noexcept requires(Bits == 1);
+
+    constexpr packed_array& flip() noexcept requires(Bits == 1);
+    constexpr packed_array& operator&=(const packed_array& other_) noexcept requires(Bits == 1);
+    constexpr packed_array& operator|=(const packed_array& other_) noexcept requires(Bits == 1);
+    constexpr packed_array& operator^=(const packed_array& other_) noexcept requires(Bits == 1);
+
+    [[nodiscard]] constexpr packed_array operator~() const noexcept requires(Bits == 1);
+
+    [[nodiscard]] friend constexpr packed_array operator&(packed_array       lhs_,
+                                                          const packed_array& rhs_) noexcept
+    requires(Bits == 1)
+    {
+        return lhs_ &= rhs_;
+    }
+    [[nodiscard]] friend constexpr packed_array operator|(packed_array       lhs_,
+                                                          const packed_array& rhs_) noexcept
+    requires(Bits == 1)
+    {
+        return lhs_ |= rhs_;
+    }
+    [[nodiscard]] friend constexpr packed_array operator^(packed_array       lhs_,
+                                                          const packed_array& rhs_) noexcept
+    requires(Bits == 1)
+    {
+        return lhs_ ^= rhs_;
+    }
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Misc ------------------------------------------------------------------------------------ */
+    [[nodiscard]] constexpr bool operator==(const packed_array& other_) const noexcept = default;
+    [[nodiscard]] std::string    to_string() const;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    friend class packed_reference<packed_array>;
+
+    constexpr void check_fit(SizeType size_) const;
+
+    [[nodiscard]] constexpr ItemType load(SizeType index_) const noexcept;
+    constexpr void                   store(SizeType index_, ItemType value_) noexcept;
+
+    constexpr void unpack_items(ItemType* destination_, SizeType offset_, SizeType count_) const;
+    constexpr void pack_items(const ItemType* source_, SizeType offset_, SizeType count_);
+    constexpr void clear_padding() noexcept;
+
+#if PEL_SIMD_VECTOR_EXTENSIONS == 1
+    typedef WordType LaneWordsType __attribute__((vector_size(packed_lanes * sizeof(WordType))));
+
+    void unpack_group(ItemType* destination_, SizeType group_) const noexcept;
+    void pack_group(const ItemType* source_, SizeType group_) noexcept;
+
+    template<SizeType... Group>
+    void unpack_block(ItemType* destination_,
+                      SizeType  block_,
+                      std::index_sequence<Group...>) const noexcept;
+    template<SizeType... Group>
+    void pack_block(const ItemType* source_,
+                    SizeType        block_,
+                    std::index_sequence<Group...>) noexcept;
+
+    static void widen_items(ItemType* destination_, const LaneWordsType& packedItems_) noexcept;
+    static void narrow_items(LaneWordsType& packedItems_, const ItemType* source_) noexcept;
+#endif
+
+    [[nodiscard]] static constexpr WordType encode(ItemType value_) noexcept;
+    [[nodiscard]] static constexpr ItemType decode(WordType bits_) noexcept;
+    [[nodiscard]] static constexpr WordType valid_bits(SizeType word_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    constexpr static SizeType m_size = ItemCount;
+    constexpr static WordType m_mask = (Bits == 32) ? ~WordType{0} : ((WordType{1} << Bits) - 1);
+
+    /* Items past `ItemCount` are kept at zero, so that words can be compared and counted */
+    alignas(packed_lanes * sizeof(WordType)) WordType m_words[word_count] = {};
+};
+
+}        // namespace pel
+
+
+#include "./packed_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,1108 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./packed_array.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define PACKED_ARRAY_TEMPLATE_DECLARATION__                                                        \
+    typename ItemType, std::size_t ItemCount, std::size_t Bits, typename BoundsCheck
+#define PACKED_ARRAY_CLASS_SCOPE__ packed_array<ItemType, ItemCount, Bits, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* Proxy reference ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Read the item the proxy refers to.
+ *************************************************************************************************/
+template<typename ArrayType>
+[[nodiscard]] constexpr inline packed_reference<ArrayType>::operator ValueType() const noexcept
+{
+    return m_array->load(m_index);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Write the item the proxy refers to, truncated to the bits of the array.
+ *
+ * \param       value_: Value to write.
+ *************************************************************************************************/
+template<typename ArrayType>
+constexpr inline const packed_reference<ArrayType>&
+packed_reference<ArrayType>::operator=(ValueType value_) const noexcept
+{
+    m_array->store(m_index, value_);
+    return *this;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Copy the item another proxy refers to into the item this proxy refers to.
+ *
+ * \param       other_: Proxy to the item to copy.
+ *************************************************************************************************/
+template<typename ArrayType>
+constexpr inline const packed_reference<ArrayType>&
+packed_reference<ArrayType>::operator=(const packed_reference& other_) const noexcept
+{
+    return *this = static_cast<ValueType>(other_);
+}
+
+
+/*************************************************************************************************/
+/* PACKED ARRAY -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Print the length and the items of a packed array, as numbers.
+ *
+ * \param       os_:  Stream to print to.
+ * \param       arr_: Packed array to print.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+inline static std::ostream&
+operator<<(std::ostream& os_, const PACKED_ARRAY_CLASS_SCOPE__& arr_) noexcept
+{
+    os_ << "Length: [" << arr_.length() << "]\n";
+
+    for(const ItemType element : arr_)
+    {
+        os_ << +element << '\n';
+    }
+
+    return os_;
+}
+
+
+/*************************************************************************************************/
+/* Constructors -------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Default-value constructor for the packed array class.
+ *
+ * \param       value_:  Value to initialize all the elements with.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr PACKED_ARRAY_CLASS_SCOPE__::packed_array(const ItemType& value_) noexcept
+{
+    fill(value_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Initializer list constructor for the packed array class.
+ *
+ * \param       ilist_:  Initializer list of the first items of the array, the others being zero.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr PACKED_ARRAY_CLASS_SCOPE__::packed_array(InitializerListType ilist_)
+{
+    check_fit(ilist_.size());
+    pack_items(ilist_.begin(), 0, ilist_.size());
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Pack the items of a regular array of the same length.
+ *
+ * \param       items_: Items to pack.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<typename OtherBoundsCheck>
+constexpr PACKED_ARRAY_CLASS_SCOPE__::packed_array(
+  const array<ItemType, ItemCount, OtherBoundsCheck>& items_)
+{
+    pack_items(items_.data(), 0, ItemCount);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Generator constructor for the packed array class.
+ *
+ * \param       generator_: Function called once per item, in order, to produce its value.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<array_generator_type<ItemType> GeneratorType>
+constexpr PACKED_ARRAY_CLASS_SCOPE__::packed_array(GeneratorType&& generator_)
+{
+    for(SizeType i = 0; i < ItemCount; ++i)
+    {
+        store(i, static_cast<ItemType>(generator_()));
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Indexed generator constructor for the packed array class.
+ *
+ * \param       generator_: Function called with the index of every item to produce its value.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<array_indexed_generator_type<ItemType> GeneratorType>
+constexpr PACKED_ARRAY_CLASS_SCOPE__::packed_array(GeneratorType&& generator_)
+{
+    for(SizeType i = 0; i < ItemCount; ++i)
+    {
+        store(i, static_cast<ItemType>(generator_(i)));
+    }
+}
+
+
+/*************************************************************************************************/
+/* Iterators ----------------------------------------------------------------------------------- */
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::IteratorType
+PACKED_ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return IteratorType{this, 0};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return ConstIteratorType{this, 0};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::cbegin() const noexcept
+{
+    return begin();
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::IteratorType
+PACKED_ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return IteratorType{this, m_size};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::end() const noexcept
+{
+    return ConstIteratorType{this, m_size};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::cend() const noexcept
+{
+    return end();
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::RIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::rbegin() noexcept
+{
+    return RIteratorType{end()};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return ConstRIteratorType{end()};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::RIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::rend() noexcept
+{
+    return RIteratorType{begin()};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+PACKED_ARRAY_CLASS_SCOPE__::rend() const noexcept
+{
+    return ConstRIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* Element accessors --------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the packed array, checked according to
+ *              `BoundsCheck::subscript`.
+ *
+ * \param       index_: Index of the element to access.
+ *
+ * \retval      Proxy to the element, or its value for constant arrays.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ReferenceType
+PACKED_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return ReferenceType{*this, index_};
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return load(index_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the packed array, always checking its bounds.
+ *
+ * \param       index_: Index of the element to access.
+ *
+ * \retval      Proxy to the element, or its value for constant arrays.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ReferenceType
+PACKED_ARRAY_CLASS_SCOPE__::at(SizeType index_)
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return ReferenceType{*this, index_};
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return load(index_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access an element of the packed array without bounds checking, whatever the
+ *              policy.
+ *
+ * \param       index_: Index of the element to access, which must be lower than `ItemCount`.
+ *
+ * \retval      Proxy to the element, or its value for constant arrays.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ReferenceType
+PACKED_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) noexcept
+{
+    return ReferenceType{*this, index_};
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return load(index_);
+}
+
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ReferenceType
+PACKED_ARRAY_CLASS_SCOPE__::front() noexcept
+{
+    return ReferenceType{*this, 0};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::front() const noexcept
+{
+    return load(0);
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::ReferenceType
+PACKED_ARRAY_CLASS_SCOPE__::back() noexcept
+{
+    return ReferenceType{*this, m_size - 1};
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::back() const noexcept
+{
+    return load(m_size - 1);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Access the words holding the packed items, `word_count` of them.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::WordType*
+PACKED_ARRAY_CLASS_SCOPE__::words() noexcept
+{
+    return m_words;
+}
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const typename PACKED_ARRAY_CLASS_SCOPE__::WordType*
+PACKED_ARRAY_CLASS_SCOPE__::words() const noexcept
+{
+    return m_words;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to every item of the packed array.
+ *
+ * \param       value_: Value to assign.
+ *
+ * \note        Every stream holds the same items, so only the first one is packed item by item
+ *              and its words are copied to the other streams.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::fill(const ItemType& value_) noexcept
+{
+    for(SizeType row = 0; row < row_count; ++row)
+    {
+        m_words[row * packed_lanes] = 0;
+    }
+    for(SizeType position = 0; position < lane_length; ++position)
+    {
+        store(position * packed_lanes, value_);
+    }
+    for(SizeType row = 0; row < row_count; ++row)
+    {
+        for(SizeType lane = 1; lane < packed_lanes; ++lane)
+        {
+            m_words[row * packed_lanes + lane] = m_words[row * packed_lanes];
+        }
+    }
+
+    clear_padding();
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to a certain offset in the array for a certain amount of elements.
+ *
+ * \param       value_:  Value to assign to the array.
+ * \param       offset_: Offset at which data should be assigned.
+ *              [defaults : 0]
+ * \param       count_:  Number of elements to be assigned a new value.
+ *              [defaults : 1]
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::assign(const ItemType& value_, DifferenceType offset_, SizeType count_)
+{
+    check_fit(count_ + static_cast<SizeType>(offset_));
+
+    for(SizeType i = 0; i < count_; ++i)
+    {
+        store(static_cast<SizeType>(offset_) + i, value_);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign the content of an initializer list to a certain offset in the array.
+ *
+ * \param       ilist_:  Initializer list of values to assign to the array.
+ * \param       offset_: Offset at which data should be assigned.
+ *              [defaults : 0]
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::assign(InitializerListType ilist_, DifferenceType offset_)
+{
+    check_fit(ilist_.size() + static_cast<SizeType>(offset_));
+
+    pack_items(ilist_.begin(), static_cast<SizeType>(offset_), ilist_.size());
+}
+
+
+/*************************************************************************************************/
+/* Bulk conversions ---------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Unpack consecutive items into a regular array.
+ *
+ * \param       destination_: Array receiving the `Count` items starting at `offset_`.
+ * \param       offset_:      Index of the first item to unpack.
+ *              [defaults : 0]
+ *
+ * \note        Scanning a packed array block by block through a small `pel::array` keeps both in
+ *              cache, while reading `Bits / (8 * sizeof(ItemType))` as much memory as scanning
+ *              the unpacked items.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Count, typename OtherBoundsCheck>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::unpack(array<ItemType, Count, OtherBoundsCheck>& destination_,
+                                   SizeType                                  offset_) const
+{
+    check_fit(Count + offset_);
+
+    unpack_items(destination_.data(), offset_, Count);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Unpack every item into a regular array.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline array<ItemType, ItemCount, BoundsCheck>
+PACKED_ARRAY_CLASS_SCOPE__::unpack() const
+{
+    array<ItemType, ItemCount, BoundsCheck> items;
+    unpack_items(items.data(), 0, ItemCount);
+    return items;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Pack the items of a regular array into consecutive items.
+ *
+ * \param       source_: Array whose `Count` items are written starting at `offset_`.
+ * \param       offset_: Index of the first item to write.
+ *              [defaults : 0]
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t Count, typename OtherBoundsCheck>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::pack(const array<ItemType, Count, OtherBoundsCheck>& source_,
+                                 SizeType                                        offset_)
+{
+    check_fit(Count + offset_);
+
+    pack_items(source_.data(), offset_, Count);
+}
+
+
+/*************************************************************************************************/
+/* Single-bit operations ----------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Number of set items, counted a word at a time.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline std::size_t
+PACKED_ARRAY_CLASS_SCOPE__::count() const noexcept requires(Bits == 1)
+{
+    SizeType setItems = 0;
+    for(const WordType word : m_words)
+    {
+        setItems += static_cast<SizeType>(std::popcount(word));
+    }
+    return setItems;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+PACKED_ARRAY_CLASS_SCOPE__::all() const noexcept requires(Bits == 1)
+{
+    return count() == m_size;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+PACKED_ARRAY_CLASS_SCOPE__::any() const noexcept requires(Bits == 1)
+{
+    WordType setBits = 0;
+    for(const WordType word : m_words)
+    {
+        setBits |= word;
+    }
+    return setBits != 0;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+PACKED_ARRAY_CLASS_SCOPE__::none() const noexcept requires(Bits == 1)
+{
+    return !any();
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Invert every item, a word at a time.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline PACKED_ARRAY_CLASS_SCOPE__&
+PACKED_ARRAY_CLASS_SCOPE__::flip() noexcept requires(Bits == 1)
+{
+    for(WordType& word : m_words)
+    {
+        word = ~word;
+    }
+    clear_padding();
+    return *this;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline PACKED_ARRAY_CLASS_SCOPE__
+PACKED_ARRAY_CLASS_SCOPE__::operator~() const noexcept requires(Bits == 1)
+{
+    packed_array flipped = *this;
+    return flipped.flip();
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Combine every item with the item at the same index of another array, a word at a
+ *              time.
+ *
+ * \param       other_: Array to combine with.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline PACKED_ARRAY_CLASS_SCOPE__&
+PACKED_ARRAY_CLASS_SCOPE__::operator&=(const packed_array& other_) noexcept requires(Bits == 1)
+{
+    for(SizeType i = 0; i < word_count; ++i)
+    {
+        m_words[i] &= other_.m_words[i];
+    }
+    return *this;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline PACKED_ARRAY_CLASS_SCOPE__&
+PACKED_ARRAY_CLASS_SCOPE__::operator|=(const packed_array& other_) noexcept requires(Bits == 1)
+{
+    for(SizeType i = 0; i < word_count; ++i)
+    {
+        m_words[i] |= other_.m_words[i];
+    }
+    return *this;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline PACKED_ARRAY_CLASS_SCOPE__&
+PACKED_ARRAY_CLASS_SCOPE__::operator^=(const packed_array& other_) noexcept requires(Bits == 1)
+{
+    for(SizeType i = 0; i < word_count; ++i)
+    {
+        m_words[i] ^= other_.m_words[i];
+    }
+    return *this;
+}
+
+
+/*************************************************************************************************/
+/* Size ---------------------------------------------------------------------------------------- */
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline std::size_t
+PACKED_ARRAY_CLASS_SCOPE__::length() noexcept
+{
+    return m_size;
+}
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline std::size_t
+PACKED_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return m_size;
+}
+
+
+/*************************************************************************************************/
+/* Misc ---------------------------------------------------------------------------------------- */
+
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline std::string
+PACKED_ARRAY_CLASS_SCOPE__::to_string() const
+{
+    std::ostringstream os;
+    os << *this;
+    return os.str();
+}
+
+
+/*************************************************************************************************/
+/* Private methods ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Check that `size_` items fit in the array, according to the `BoundsCheck` policy.
+ *
+ * \param       size_: Number of items to fit in the array.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::check_fit(SizeType size_) const
+{
+    BoundsCheck::template check<std::length_error>(size_ <= m_size, "Data couldn't fit in array");
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Read an item, which straddles at most two words of its stream.
+ *
+ * \param       index_: Index of the item, which must be lower than `ItemCount`.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::load(SizeType index_) const noexcept
+{
+    const SizeType  bit   = (index_ / packed_lanes) * Bits;
+    const SizeType  row   = bit / 32;
+    const WordType* words = m_words + (row * packed_lanes) + (index_ % packed_lanes);
+
+    const std::uint64_t low  = words[0];
+    const std::uint64_t high = (row + 1 < row_count) ? words[packed_lanes] : 0;
+
+    return decode(static_cast<WordType>(((high << 32) | low) >> (bit % 32)) & m_mask);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Write an item, leaving the bits of the other items untouched.
+ *
+ * \param       index_: Index of the item, which must be lower than `ItemCount`.
+ * \param       value_: Value to write, truncated to `Bits` bits.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::store(SizeType index_, ItemType value_) noexcept
+{
+    const SizeType  bit   = (index_ / packed_lanes) * Bits;
+    const SizeType  shift = bit % 32;
+    WordType*       words = m_words + ((bit / 32) * packed_lanes) + (index_ % packed_lanes);
+    const WordType  item  = encode(value_);
+
+    words[0] = (words[0] & ~(m_mask << shift)) | (item << shift);
+    if(shift + Bits > 32)
+    {
+        words[packed_lanes] =
+          (words[packed_lanes] & ~(m_mask >> (32 - shift))) | (item >> (32 - shift));
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Unpack `count_` items from index `offset_`, which must fit in the array.
+ *
+ * \note        Whole blocks and groups of items are unpacked with vector instructions, and the
+ *              items around them one at a time.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::unpack_items(ItemType* destination_,
+                                         SizeType  offset_,
+                                         SizeType  count_) const
+{
+    const SizeType last  = offset_ + count_;
+    SizeType       index = offset_;
+
+#if PEL_SIMD_VECTOR_EXTENSIONS == 1
+    if(!std::is_constant_evaluated())
+    {
+        const SizeType head =
+          std::min(count_, (packed_lanes - (offset_ % packed_lanes)) % packed_lanes);
+        for(; index < offset_ + head; ++index)
+        {
+            destination_[index - offset_] = load(index);
+        }
+
+        const SizeType groupsEnd = index + ((last - index) / packed_lanes) * packed_lanes;
+        while(index < groupsEnd)
+        {
+            if((index % block_length == 0) && (index + block_length <= groupsEnd))
+            {
+                unpack_block(destination_ + (index - offset_),
+                             index / block_length,
+                             std::make_index_sequence<32>{});
+                index += block_length;
+            }
+            else
+            {
+                unpack_group(destination_ + (index - offset_), index / packed_lanes);
+                index += packed_lanes;
+            }
+        }
+    }
+#endif
+
+    for(; index < last; ++index)
+    {
+        destination_[index - offset_] = load(index);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Pack `count_` items at index `offset_`, which must fit in the array.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::pack_items(const ItemType* source_, SizeType offset_, SizeType count_)
+{
+    const SizeType last  = offset_ + count_;
+    SizeType       index = offset_;
+
+#if PEL_SIMD_VECTOR_EXTENSIONS == 1
+    if(!std::is_constant_evaluated())
+    {
+        const SizeType head =
+          std::min(count_, (packed_lanes - (offset_ % packed_lanes)) % packed_lanes);
+        for(; index < offset_ + head; ++index)
+        {
+            store(index, source_[index - offset_]);
+        }
+
+        const SizeType groupsEnd = index + ((last - index) / packed_lanes) * packed_lanes;
+        while(index < groupsEnd)
+        {
+            if((index % block_length == 0) && (index + block_length <= groupsEnd))
+            {
+                pack_block(source_ + (index - offset_),
+                           index / block_length,
+                           std::make_index_sequence<32>{});
+                index += block_length;
+            }
+            else
+            {
+                pack_group(source_ + (index - offset_), index / packed_lanes);
+                index += packed_lanes;
+            }
+        }
+    }
+#endif
+
+    for(; index < last; ++index)
+    {
+        store(index, source_[index - offset_]);
+    }
+}
+
+
+#if PEL_SIMD_VECTOR_EXTENSIONS == 1
+/**
+ **************************************************************************************************
+ * \brief       Unpack the `packed_lanes` items of a group, which sit at the same bit offset of
+ *              two rows of words.
+ *
+ * \param       destination_: Items receiving the group.
+ * \param       group_:       Index of the group, whose items all lie in the array.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::unpack_group(ItemType* destination_, SizeType group_) const noexcept
+{
+    const SizeType bit   = group_ * Bits;
+    const SizeType row   = bit / 32;
+    const WordType shift = static_cast<WordType>(bit % 32);
+
+    LaneWordsType low  = {};
+    LaneWordsType high = {};
+    std::memcpy(&low, m_words + (row * packed_lanes), sizeof(low));
+    if(row + 1 < row_count)
+    {
+        std::memcpy(&high, m_words + ((row + 1) * packed_lanes), sizeof(high));
+    }
+
+    /* Shifting by 32 isn't defined, hence the two shifts of `high` */
+    widen_items(destination_, ((low >> shift) | ((high << 1) << (31 - shift))) & m_mask);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Pack the `packed_lanes` items of a group, which sit at the same bit offset of two
+ *              rows of words.
+ *
+ * \param       source_: Items of the group.
+ * \param       group_:  Index of the group, whose items all lie in the array.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::pack_group(const ItemType* source_, SizeType group_) noexcept
+{
+    const SizeType bit   = group_ * Bits;
+    const WordType shift = static_cast<WordType>(bit % 32);
+    WordType*      words = m_words + ((bit / 32) * packed_lanes);
+
+    LaneWordsType packedItems;
+    narrow_items(packedItems, source_);
+
+    LaneWordsType low;
+    std::memcpy(&low, words, sizeof(low));
+    low = (low & ~(m_mask << shift)) | (packedItems << shift);
+    std::memcpy(words, &low, sizeof(low));
+
+    if(shift + Bits > 32)
+    {
+        LaneWordsType high;
+        std::memcpy(&high, words + packed_lanes, sizeof(high));
+        high = (high & ~(m_mask >> (32 - shift))) | (packedItems >> (32 - shift));
+        std::memcpy(words + packed_lanes, &high, sizeof(high));
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Unpack the `block_length` items of a block, which fill `Bits` rows of words.
+ *
+ * \param       destination_: Items receiving the block.
+ * \param       block_:       Index of the block, whose items all lie in the array.
+ *
+ * \note        The rows are loaded once, and every group is unpacked from them with shifts known
+ *              at compile time, as in the BP128 integer compression scheme.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... Group>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::unpack_block(ItemType* destination_,
+                                         SizeType  block_,
+                                         std::index_sequence<Group...>) const noexcept
+{
+    LaneWordsType rows[Bits];
+    std::memcpy(rows, m_words + (block_ * Bits * packed_lanes), sizeof(rows));
+
+    const auto unpackGroup = [&]<SizeType GroupIndex>(std::integral_constant<SizeType, GroupIndex>)
+    {
+        constexpr SizeType bit   = GroupIndex * Bits;
+        constexpr WordType shift = bit % 32;
+
+        LaneWordsType packedItems = rows[bit / 32] >> shift;
+        if constexpr(shift + Bits > 32)
+        {
+            packedItems |= rows[(bit / 32) + 1] << (32 - shift);
+        }
+        widen_items(destination_ + (GroupIndex * packed_lanes), packedItems & m_mask);
+    };
+    (unpackGroup(std::integral_constant<SizeType, Group>{}), ...);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Pack the `block_length` items of a block, which fill `Bits` rows of words.
+ *
+ * \param       source_: Items of the block.
+ * \param       block_:  Index of the block, whose items all lie in the array.
+ *
+ * \note        No other item shares the rows of the block, which are written without being read.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... Group>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::pack_block(const ItemType* source_,
+                                       SizeType        block_,
+                                       std::index_sequence<Group...>) noexcept
+{
+    LaneWordsType rows[Bits] = {};
+
+    const auto packGroup = [&]<SizeType GroupIndex>(std::integral_constant<SizeType, GroupIndex>)
+    {
+        constexpr SizeType bit   = GroupIndex * Bits;
+        constexpr WordType shift = bit % 32;
+
+        LaneWordsType packedItems;
+        narrow_items(packedItems, source_ + (GroupIndex * packed_lanes));
+        rows[bit / 32] |= packedItems << shift;
+        if constexpr(shift + Bits > 32)
+        {
+            rows[(bit / 32) + 1] |= packedItems >> (32 - shift);
+        }
+    };
+    (packGroup(std::integral_constant<SizeType, Group>{}), ...);
+
+    std::memcpy(m_words + (block_ * Bits * packed_lanes), rows, sizeof(rows));
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Convert the `packed_lanes` unpacked lanes of a group to items.
+ *
+ * \param       destination_: Items receiving the group.
+ * \param       packedItems_: Low `Bits` bits of every item of the group.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::widen_items(ItemType*            destination_,
+                                        const LaneWordsType& packedItems_) noexcept
+{
+    using LaneItemType =
+      std::conditional_t<std::is_same_v<ItemType, bool>, std::uint8_t, ItemType>;
+    typedef std::int32_t LaneSignedType __attribute__((vector_size(packed_lanes * 4)));
+    typedef LaneItemType LaneItemsType
+      __attribute__((vector_size(packed_lanes * sizeof(ItemType))));
+
+    LaneItemsType items;
+    if constexpr(std::is_signed_v<ItemType>)
+    {
+        /* Flipping then subtracting the sign bit extends it, and converting through 32-bit signed
+         * lanes keeps the sign for wider items */
+        constexpr WordType   signBit = WordType{1} << (Bits - 1);
+        const LaneSignedType values =
+          __builtin_convertvector((packedItems_ ^ signBit) - signBit, LaneSignedType);
+        items = __builtin_convertvector(values, LaneItemsType);
+    }
+    else
+    {
+        items = __builtin_convertvector(packedItems_, LaneItemsType);
+    }
+    std::memcpy(destination_, &items, sizeof(items));
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Convert `packed_lanes` items to their low `Bits` bits.
+ *
+ * \param       packedItems_: Lanes receiving the items.
+ * \param       source_:      Items of the group.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+inline void
+PACKED_ARRAY_CLASS_SCOPE__::narrow_items(LaneWordsType& packedItems_,
+                                         const ItemType* source_) noexcept
+{
+    using LaneItemType =
+      std::conditional_t<std::is_same_v<ItemType, bool>, std::uint8_t, ItemType>;
+    typedef LaneItemType LaneItemsType
+      __attribute__((vector_size(packed_lanes * sizeof(ItemType))));
+
+    LaneItemsType items;
+    std::memcpy(&items, source_, sizeof(items));
+    packedItems_ = __builtin_convertvector(items, LaneWordsType) & m_mask;
+}
+#endif
+
+
+/**
+ **************************************************************************************************
+ * \brief       Zero the bits past the last item of every stream, which only the last two rows of
+ *              words can hold.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+PACKED_ARRAY_CLASS_SCOPE__::clear_padding() noexcept
+{
+    const SizeType firstRow = (row_count >= 2) ? row_count - 2 : 0;
+    for(SizeType word = firstRow * packed_lanes; word < word_count; ++word)
+    {
+        m_words[word] &= valid_bits(word);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Bits of a word of the array that hold items.
+ *
+ * \param       word_: Index of the word.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::WordType
+PACKED_ARRAY_CLASS_SCOPE__::valid_bits(SizeType word_) noexcept
+{
+    const SizeType lane      = word_ % packed_lanes;
+    const SizeType laneItems = (lane < m_size) ? (m_size - lane + packed_lanes - 1) / packed_lanes
+                                               : 0;
+    const SizeType laneBits  = laneItems * Bits;
+    const SizeType firstBit  = (word_ / packed_lanes) * 32;
+
+    if(laneBits <= firstBit)
+    {
+        return 0;
+    }
+    if(laneBits - firstBit >= 32)
+    {
+        return ~WordType{0};
+    }
+    return (WordType{1} << (laneBits - firstBit)) - 1;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Convert an item to its `Bits` low bits.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename PACKED_ARRAY_CLASS_SCOPE__::WordType
+PACKED_ARRAY_CLASS_SCOPE__::encode(ItemType value_) noexcept
+{
+    if constexpr(std::is_same_v<ItemType, bool>)
+    {
+        return value_ ? 1 : 0;
+    }
+    else
+    {
+        return static_cast<WordType>(value_) & m_mask;
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Convert `Bits` low bits to an item, sign-extending them for signed items.
+ *************************************************************************************************/
+template<PACKED_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+PACKED_ARRAY_CLASS_SCOPE__::decode(WordType bits_) noexcept
+{
+    if constexpr(std::is_same_v<ItemType, bool>)
+    {
+        return bits_ != 0;
+    }
+    else if constexpr(std::is_signed_v<ItemType>)
+    {
+        constexpr WordType extension = 32 - Bits;
+        return static_cast<ItemType>(static_cast<std::int32_t>(bits_ << extension) >> extension);
+    }
+    else
+    {
+        return static_cast<ItemType>(bits_);
+    }
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef PACKED_ARRAY_TEMPLATE_DECLARATION__
+#undef PACKED_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
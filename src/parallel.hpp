@@ -0,0 +1,164 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aligned_array.hpp"
+#include "./array.hpp"
+#include "./thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+
+/*************************************************************************************************/
+/* Tuning -------------------------------------------------------------------------------------- */
+
+/* Arrays of at most this many bytes are processed on the calling thread: waking the pool costs
+ * more than it saves below it. Can be overridden on the command line. */
+#if !defined(PEL_PARALLEL_SERIAL_CUTOFF_BYTES)
+#define PEL_PARALLEL_SERIAL_CUTOFF_BYTES (256 * 1024)
+#endif
+
+/* Default number of bytes processed per chunk, small enough to balance the load between threads
+ * and large enough to amortize taking a chunk. Can be overridden on the command line. */
+#if !defined(PEL_PARALLEL_GRAIN_BYTES)
+#define PEL_PARALLEL_GRAIN_BYTES (32 * 1024)
+#endif
+
+
+namespace pel::parallel
+{
+constexpr std::size_t serial_cutoff_bytes = PEL_PARALLEL_SERIAL_CUTOFF_BYTES;
+constexpr std::size_t default_grain_bytes = PEL_PARALLEL_GRAIN_BYTES;
+
+/* Arrays of at most `serial_cutoff<T>` items are processed serially, chosen at compile-time */
+template<typename ItemType>
+constexpr std::size_t serial_cutoff =
+  std::max<std::size_t>(serial_cutoff_bytes / sizeof(ItemType), 1);
+
+
+/*************************************************************************************************/
+/* Options ------------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Execution options of the parallel algorithms.
+ *
+ * \note        `grain` is rounded up to whole cache lines, so that two threads never write to the
+ *              same cache line. A `grain` of 0 picks `default_grain_bytes` worth of items, or less
+ *              to give every thread a few chunks to balance (except in `reduce`, whose result
+ *              must not depend on the number of threads).
+ *************************************************************************************************/
+struct options
+{
+    std::size_t  grain   = 0;       /* Items per chunk, 0 for automatic */
+    std::size_t  threads = 0;       /* Maximum number of threads, 0 for all of the pool's */
+    thread_pool* pool    = nullptr; /* Pool running the chunks, nullptr for the default one */
+};
+
+
+/*************************************************************************************************/
+/* Chunking ------------------------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Split of `count` items into chunks whose boundaries fall on cache lines.
+ *
+ * \note        The first chunk also takes the items before the first cache line boundary, so
+ *              that every other chunk starts on a cache line, wherever the array is in memory.
+ *************************************************************************************************/
+class chunking
+{
+public:
+    template<typename ItemType>
+    chunking(const ItemType* data_,
+             std::size_t     count_,
+             std::size_t     grain_,
+             std::size_t     participants_) noexcept;
+
+    [[nodiscard]] std::size_t count() const noexcept;
+    [[nodiscard]] std::size_t begin(std::size_t chunk_) const noexcept;
+    [[nodiscard]] std::size_t end(std::size_t chunk_) const noexcept;
+    [[nodiscard]] std::size_t grain() const noexcept;
+
+private:
+    std::size_t m_itemCount  = 0;
+    std::size_t m_head       = 0;
+    std::size_t m_grain      = 1;
+    std::size_t m_chunkCount = 1;
+};
+
+
+/*************************************************************************************************/
+/* Algorithms ---------------------------------------------------------------------------------- */
+
+/* The callables are invoked concurrently, from several threads, and must therefore not modify
+ * shared state without synchronization. */
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, typename FunctionType>
+void for_each(array<ItemType, ItemCount, BoundsCheck>& array_,
+              FunctionType                             function_,
+              const options&                           options_ = {});
+
+template<typename InputType,
+         typename OutputType,
+         std::size_t ItemCount,
+         typename InputBoundsCheck,
+         typename OutputBoundsCheck,
+         typename FunctionType>
+void transform(const array<InputType, ItemCount, InputBoundsCheck>& input_,
+               array<OutputType, ItemCount, OutputBoundsCheck>&     output_,
+               FunctionType                                         function_,
+               const options&                                       options_ = {});
+
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck,
+         typename ResultType,
+         typename OperationType = std::plus<>>
+[[nodiscard]] ResultType reduce(const array<ItemType, ItemCount, BoundsCheck>& array_,
+                                ResultType                                     init_,
+                                OperationType  operation_ = OperationType{},
+                                const options& options_   = {});
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+void fill(array<ItemType, ItemCount, BoundsCheck>& array_,
+          const ItemType&                          value_,
+          const options&                           options_ = {});
+
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, typename GeneratorType>
+void generate_indexed(array<ItemType, ItemCount, BoundsCheck>& array_,
+                      GeneratorType                            generator_,
+                      const options&                           options_ = {});
+
+}        // namespace pel::parallel
+
+
+#include "./parallel.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
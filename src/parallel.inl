@@ -0,0 +1,408 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./parallel.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace pel::parallel
+{
+
+/*************************************************************************************************/
+/* CHUNKING ------------------------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Split `count_` items starting at `data_` into cache-aligned chunks.
+ *
+ * \param       data_:         First item, whose address places the cache line boundaries.
+ * \param       count_:        Number of items.
+ * \param       grain_:        Items per chunk, 0 for automatic.
+ * \param       participants_: Number of threads sharing the chunks.
+ *************************************************************************************************/
+template<typename ItemType>
+inline chunking::chunking(const ItemType* data_,
+                          std::size_t     count_,
+                          std::size_t     grain_,
+                          std::size_t     participants_) noexcept
+: m_itemCount{count_}
+{
+    constexpr std::size_t lineItems =
+      ((cache_line_bytes % sizeof(ItemType)) == 0) ? cache_line_bytes / sizeof(ItemType) : 1;
+
+    std::size_t grain = grain_;
+    if(grain == 0)
+    {
+        /* At least 4 chunks per thread, so that stealing can even out slower threads */
+        const std::size_t balancedGrain = (count_ + (4 * participants_) - 1) / (4 * participants_);
+        grain = std::min(std::max<std::size_t>(default_grain_bytes / sizeof(ItemType), 1),
+                         std::max<std::size_t>(balancedGrain, 1));
+    }
+    m_grain = ((grain + lineItems - 1) / lineItems) * lineItems;
+
+    if constexpr(lineItems > 1)
+    {
+        const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(data_) % cache_line_bytes;
+        if((misalignment % sizeof(ItemType)) == 0)
+        {
+            m_head = std::min(((cache_line_bytes - misalignment) % cache_line_bytes)
+                                / sizeof(ItemType),
+                              count_);
+        }
+    }
+
+    m_chunkCount = (count_ > m_head) ? (count_ - m_head + m_grain - 1) / m_grain : 1;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of chunks.
+ *
+ * \retval      std::size_t: Number of chunks, at least 1.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+chunking::count() const noexcept
+{
+    return m_chunkCount;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the index of the first item (`begin`) or past the last item (`end`) of a chunk.
+ *
+ * \param       chunk_: Chunk number, lower than `count()`.
+ *
+ * \retval      std::size_t: Item index.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+chunking::begin(std::size_t chunk_) const noexcept
+{
+    return (chunk_ == 0) ? 0 : m_head + (chunk_ * m_grain);
+}
+
+[[nodiscard]] inline std::size_t
+chunking::end(std::size_t chunk_) const noexcept
+{
+    return std::min(m_head + ((chunk_ + 1) * m_grain), m_itemCount);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of items per chunk, after rounding to whole cache lines.
+ *
+ * \retval      std::size_t: Items per chunk.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+chunking::grain() const noexcept
+{
+    return m_grain;
+}
+
+
+/*************************************************************************************************/
+/* SCHEDULING ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+[[nodiscard]] inline thread_pool&
+selected_pool(const options& options_)
+{
+    return (options_.pool != nullptr) ? *options_.pool : default_thread_pool();
+}
+
+[[nodiscard]] inline std::size_t
+participant_count(const thread_pool& pool_, const options& options_) noexcept
+{
+    return (options_.threads == 0) ? pool_.concurrency()
+                                   : std::min(options_.threads, pool_.concurrency());
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Run `function_(chunk, begin, end)` over cache-aligned chunks of `count_` items.
+ *
+ * \param       data_:     First item, whose address places the cache line boundaries.
+ * \param       count_:    Number of items.
+ * \param       options_:  Execution options.
+ * \param       function_: Callable processing the items `[begin, end)`.
+ *************************************************************************************************/
+template<typename ItemType, typename FunctionType>
+inline void
+run_chunks(const ItemType*     data_,
+           std::size_t         count_,
+           const options&      options_,
+           const FunctionType& function_)
+{
+    thread_pool&      pool         = selected_pool(options_);
+    const std::size_t participants = participant_count(pool, options_);
+    const chunking    chunks{data_, count_, options_.grain, participants};
+
+    pool.run(
+      chunks.count(),
+      [&](std::size_t chunk_) { function_(chunk_, chunks.begin(chunk_), chunks.end(chunk_)); },
+      participants);
+}
+
+
+/*************************************************************************************************/
+/* ALGORITHMS ---------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Call `function_(item)` on every item of an array.
+ *
+ * \param       array_:    Array whose items are visited.
+ * \param       function_: Callable receiving a reference to each item.
+ * \param       options_:  Execution options.
+ *
+ * \note        Arrays of at most `serial_cutoff<ItemType>` items are visited on the calling
+ *              thread, without touching the pool.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, typename FunctionType>
+inline void
+for_each(array<ItemType, ItemCount, BoundsCheck>& array_,
+         FunctionType                             function_,
+         const options&                           options_)
+{
+    if constexpr(ItemCount <= serial_cutoff<ItemType>)
+    {
+        std::for_each(array_.begin(), array_.end(), function_);
+    }
+    else
+    {
+        ItemType* data = array_.data();
+        run_chunks(data,
+                   ItemCount,
+                   options_,
+                   [data, &function_](
+                     std::size_t /* chunk_ */, std::size_t begin_, std::size_t end_)
+                   {
+                       for(std::size_t i = begin_; i < end_; ++i)
+                       {
+                           function_(data[i]);
+                       }
+                   });
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Store `function_(input_[i])` into `output_[i]`, for every item.
+ *
+ * \param       input_:    Array whose items are transformed.
+ * \param       output_:   Array receiving the results, which may be `input_`.
+ * \param       function_: Callable transforming an item.
+ * \param       options_:  Execution options.
+ *
+ * \note        Chunks are aligned on the cache lines of `output_`, the array being written.
+ *************************************************************************************************/
+template<typename InputType,
+         typename OutputType,
+         std::size_t ItemCount,
+         typename InputBoundsCheck,
+         typename OutputBoundsCheck,
+         typename FunctionType>
+inline void
+transform(const array<InputType, ItemCount, InputBoundsCheck>& input_,
+          array<OutputType, ItemCount, OutputBoundsCheck>&     output_,
+          FunctionType                                         function_,
+          const options&                                       options_)
+{
+    if constexpr(ItemCount <= serial_cutoff<OutputType>)
+    {
+        std::transform(input_.begin(), input_.end(), output_.begin(), function_);
+    }
+    else
+    {
+        const InputType* source      = input_.data();
+        OutputType*      destination = output_.data();
+        run_chunks(destination,
+                   ItemCount,
+                   options_,
+                   [source, destination, &function_](
+                     std::size_t /* chunk_ */, std::size_t begin_, std::size_t end_)
+                   {
+                       for(std::size_t i = begin_; i < end_; ++i)
+                       {
+                           destination[i] = function_(source[i]);
+                       }
+                   });
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Combine every item of an array with `operation_`, starting from `init_`.
+ *
+ * \param       array_:     Array to reduce.
+ * \param       init_:      Initial value, whose type is the type of the result.
+ * \param       operation_: Associative binary operation.
+ *              [defaults : std::plus<>]
+ * \param       options_:   Execution options.
+ *
+ * \retval      ResultType: `init_` combined with every item.
+ *
+ * \note        Each chunk is reduced from left to right, and the chunk results are then combined
+ *              in chunk order. The automatic grain is `default_grain_bytes` worth of items
+ *              whatever the pool, so the result depends on the grain and on the alignment of
+ *              the array, but not on the number of threads or on which thread ran which chunk.
+ *************************************************************************************************/
+template<typename ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck,
+         typename ResultType,
+         typename OperationType>
+[[nodiscard]] inline ResultType
+reduce(const array<ItemType, ItemCount, BoundsCheck>& array_,
+       ResultType                                     init_,
+       OperationType                                  operation_,
+       const options&                                 options_)
+{
+    const ItemType* data = array_.data();
+
+    if constexpr(ItemCount <= serial_cutoff<ItemType>)
+    {
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            init_ = operation_(init_, data[i]);
+        }
+        return init_;
+    }
+    else
+    {
+        thread_pool&      pool         = selected_pool(options_);
+        const std::size_t participants = participant_count(pool, options_);
+
+        /* Chunks are not balanced between the participants, which would make the order of the
+         * operations depend on the pool. Above the serial cutoff, the default grain still gives
+         * at least `serial_cutoff_bytes / default_grain_bytes` chunks. */
+        const chunking chunks{data, ItemCount, options_.grain, 1};
+
+        /* Each partial has its own cache line: neighbouring chunks finishing together don't share
+         * it, and `bool` results don't end up packed in the same word of a `std::vector<bool>` */
+        std::vector<padded_item<ResultType>> partials(chunks.count(),
+                                                      padded_item<ResultType>{init_});
+        pool.run(
+          chunks.count(),
+          [&](std::size_t chunk_)
+          {
+              const std::size_t end     = chunks.end(chunk_);
+              ResultType        partial(data[chunks.begin(chunk_)]);
+              for(std::size_t i = chunks.begin(chunk_) + 1; i < end; ++i)
+              {
+                  partial = operation_(partial, data[i]);
+              }
+              partials[chunk_].value = partial;
+          },
+          participants);
+
+        for(const padded_item<ResultType>& partial : partials)
+        {
+            init_ = operation_(init_, partial.value);
+        }
+        return init_;
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Assign a value to every item of an array.
+ *
+ * \param       array_:   Array to fill.
+ * \param       value_:   Value to assign.
+ * \param       options_: Execution options.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck>
+inline void
+fill(array<ItemType, ItemCount, BoundsCheck>& array_,
+     const ItemType&                          value_,
+     const options&                           options_)
+{
+    if constexpr(ItemCount <= serial_cutoff<ItemType>)
+    {
+        std::fill(array_.begin(), array_.end(), value_);
+    }
+    else
+    {
+        ItemType* data = array_.data();
+        run_chunks(data,
+                   ItemCount,
+                   options_,
+                   [data, &value_](std::size_t /* chunk_ */, std::size_t begin_, std::size_t end_)
+                   { std::fill(data + begin_, data + end_, value_); });
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Store `generator_(i)` into every item `i` of an array.
+ *
+ * \param       array_:     Array to fill.
+ * \param       generator_: Callable producing the item at an index.
+ * \param       options_:   Execution options.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck, typename GeneratorType>
+inline void
+generate_indexed(array<ItemType, ItemCount, BoundsCheck>& array_,
+                 GeneratorType                            generator_,
+                 const options&                           options_)
+{
+    ItemType* data = array_.data();
+
+    if constexpr(ItemCount <= serial_cutoff<ItemType>)
+    {
+        for(std::size_t i = 0; i < ItemCount; ++i)
+        {
+            data[i] = generator_(i);
+        }
+    }
+    else
+    {
+        run_chunks(data,
+                   ItemCount,
+                   options_,
+                   [data, &generator_](
+                     std::size_t /* chunk_ */, std::size_t begin_, std::size_t end_)
+                   {
+                       for(std::size_t i = begin_; i < end_; ++i)
+                       {
+                           data[i] = generator_(i);
+                       }
+                   });
+    }
+}
+
+}        // namespace pel::parallel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
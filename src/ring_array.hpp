@@ -0,0 +1,167 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aligned_array.hpp"
+#include "./array.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Ring buffer --------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Threads allowed to use the two ends of a `ring_array` concurrently.
+ *
+ * \note        `spsc` rings have a single producer thread and a single consumer thread: each end
+ *              is owned by one thread and publishes its index with a single release store.
+ *              `mpmc` rings accept any number of producers and consumers, which claim positions
+ *              with a compare-exchange and hand items over through a sequence number per slot.
+ *************************************************************************************************/
+enum class ring_mode
+{
+    spsc,
+    mpmc,
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Slot of a `ring_mode::mpmc` ring: the item and the position it's ready for.
+ *
+ * \note        A slot holding `sequence == position` is free for the producer of `position`, a
+ *              slot holding `sequence == position + 1` is full for the consumer of `position`.
+ *************************************************************************************************/
+template<typename ItemType>
+struct ring_cell
+{
+    std::atomic<std::size_t> sequence = 0;
+    ItemType                 value{};
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Lock-free fixed-capacity FIFO queue of `ItemCount` items, stored in a `pel::array`.
+ *
+ * \note        Positions only ever grow, and are mapped to slots with a mask when `ItemCount` is a
+ *              power of two and with a modulo otherwise. The producers' and the consumers' indexes
+ *              each sit alone on their cache line, next to the opposite index last read by that
+ *              end in `spsc` mode: a full or empty check only touches the other end's cache line
+ *              once the cached index is exhausted.
+ *
+ * \note        The batched `push` and `pop` move as many items as fit in one go, with a single
+ *              index update for the whole span.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, ring_mode Mode = ring_mode::spsc>
+class ring_array
+{
+    static_assert(ItemCount > 0, "A ring needs at least one slot");
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using ValueType = ItemType;
+    using SizeType  = std::size_t;
+
+    static constexpr ring_mode mode           = Mode;
+    static constexpr bool      masked_indexes = (ItemCount & (ItemCount - 1)) == 0;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    ring_array() noexcept;
+    ring_array(const ring_array&)            = delete;
+    ring_array& operator=(const ring_array&) = delete;
+
+
+    /*********************************************************************************************/
+    /* Producers ------------------------------------------------------------------------------- */
+    [[nodiscard]] bool try_push(const ItemType& item_);
+    [[nodiscard]] bool try_push(ItemType&& item_);
+
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args_);
+
+    SizeType push(std::span<const ItemType> items_);
+
+
+    /*********************************************************************************************/
+    /* Consumers ------------------------------------------------------------------------------- */
+    [[nodiscard]] bool try_pop(ItemType& item_);
+
+    SizeType pop(std::span<ItemType> items_);
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] SizeType                  size() const noexcept;
+    [[nodiscard]] bool                      empty() const noexcept;
+    [[nodiscard]] static constexpr SizeType capacity() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    [[nodiscard]] static constexpr SizeType slot(SizeType position_) noexcept;
+
+    template<typename... Args>
+    [[nodiscard]] bool push_one(Args&&... args_);
+
+    template<typename... Args>
+    static void emplace_into(ItemType& slot_, Args&&... args_);
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    struct alignas(cache_line_bytes) ring_index
+    {
+        std::atomic<SizeType> position = 0;
+        SizeType              opposite = 0;
+    };
+
+    using SlotType = std::conditional_t<Mode == ring_mode::spsc, ItemType, ring_cell<ItemType>>;
+
+    ring_index m_tail;
+    ring_index m_head;
+
+    alignas(cache_line_bytes) array<SlotType, ItemCount> m_items;
+};
+
+}        // namespace pel
+
+
+#include "./ring_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
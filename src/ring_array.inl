@@ -0,0 +1,484 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./ring_array.hpp"
+
+#include <algorithm>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define RING_ARRAY_TEMPLATE_DECLARATION__                                                          \
+    typename ItemType, std::size_t ItemCount, ring_mode Mode
+#define RING_ARRAY_CLASS_SCOPE__ ring_array<ItemType, ItemCount, Mode>
+
+
+/*************************************************************************************************/
+/* CONSTRUCTORS -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of an empty ring, with every `mpmc` slot free for its first position.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+inline RING_ARRAY_CLASS_SCOPE__::ring_array() noexcept
+{
+    if constexpr(Mode == ring_mode::mpmc)
+    {
+        for(SizeType index = 0; index < ItemCount; ++index)
+        {
+            m_items.unchecked(index).sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+/*************************************************************************************************/
+/* PRODUCERS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Appends a copy of `item_` to the ring, unless it's full.
+ *
+ * \param       item_: Item to append.
+ *
+ * \retval      true:  The item was appended.
+ * \retval      false: The ring was full, nothing was appended.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::try_push(const ItemType& item_)
+{
+    return push_one(item_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Moves `item_` at the end of the ring, unless it's full.
+ *
+ * \param       item_: Item to append, left untouched when the ring is full.
+ *
+ * \retval      true:  The item was appended.
+ * \retval      false: The ring was full, nothing was appended.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::try_push(ItemType&& item_)
+{
+    return push_one(std::move(item_));
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Appends an item built from `args_` to the ring, unless it's full.
+ *
+ * \param       args_: Arguments forwarded to the constructor of the item, which is only built once
+ *                     a slot has been reserved.
+ *
+ * \retval      true:  The item was appended.
+ * \retval      false: The ring was full, nothing was built.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+template<typename... Args>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::try_emplace(Args&&... args_)
+{
+    return push_one(std::forward<Args>(args_)...);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Appends as many items of `items_` as there are free slots, in order.
+ *
+ * \param       items_: Items to append.
+ *
+ * \return      Number of items appended, from the front of `items_`.
+ *
+ * \note        In `mpmc` mode, the items appended by one call are contiguous in the ring: they
+ *              aren't interleaved with the ones of other producers.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+inline typename RING_ARRAY_CLASS_SCOPE__::SizeType
+RING_ARRAY_CLASS_SCOPE__::push(std::span<const ItemType> items_)
+{
+    const SizeType wanted = std::min(items_.size(), ItemCount);
+    if(wanted == 0)
+    {
+        return 0;
+    }
+
+    if constexpr(Mode == ring_mode::spsc)
+    {
+        const SizeType tail = m_tail.position.load(std::memory_order_relaxed);
+        if(ItemCount - (tail - m_tail.opposite) < wanted)
+        {
+            m_tail.opposite = m_head.position.load(std::memory_order_acquire);
+        }
+
+        const SizeType count     = std::min(wanted, ItemCount - (tail - m_tail.opposite));
+        const SizeType first     = slot(tail);
+        const SizeType headCount = std::min(count, ItemCount - first);
+        std::copy_n(items_.data(), headCount, m_items.data() + first);
+        std::copy_n(items_.data() + headCount, count - headCount, m_items.data());
+
+        m_tail.position.store(tail + count, std::memory_order_release);
+        return count;
+    }
+    else
+    {
+        SizeType position = m_tail.position.load(std::memory_order_relaxed);
+        while(true)
+        {
+            /* Count the slots already released by the consumers, then claim them all at once */
+            SizeType count = 0;
+            while((count < wanted) &&
+                  (m_items.unchecked(slot(position + count))
+                     .sequence.load(std::memory_order_acquire) == position + count))
+            {
+                ++count;
+            }
+
+            if(count == 0)
+            {
+                const SizeType sequence =
+                  m_items.unchecked(slot(position)).sequence.load(std::memory_order_acquire);
+                if(static_cast<std::ptrdiff_t>(sequence - position) < 0)
+                {
+                    return 0;
+                }
+                position = m_tail.position.load(std::memory_order_relaxed);
+            }
+            else if(m_tail.position.compare_exchange_weak(
+                      position, position + count, std::memory_order_relaxed))
+            {
+                for(SizeType index = 0; index < count; ++index)
+                {
+                    SlotType& cell = m_items.unchecked(slot(position + index));
+                    cell.value     = items_[index];
+                    cell.sequence.store(position + index + 1, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************/
+/* CONSUMERS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Moves the oldest item of the ring into `item_`, unless the ring is empty.
+ *
+ * \param       item_: Destination of the item, left untouched when the ring is empty.
+ *
+ * \retval      true:  An item was removed.
+ * \retval      false: The ring was empty.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::try_pop(ItemType& item_)
+{
+    if constexpr(Mode == ring_mode::spsc)
+    {
+        const SizeType head = m_head.position.load(std::memory_order_relaxed);
+        if(head == m_head.opposite)
+        {
+            m_head.opposite = m_tail.position.load(std::memory_order_acquire);
+            if(head == m_head.opposite)
+            {
+                return false;
+            }
+        }
+
+        item_ = std::move(m_items.unchecked(slot(head)));
+        m_head.position.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    else
+    {
+        SizeType position = m_head.position.load(std::memory_order_relaxed);
+        while(true)
+        {
+            SlotType&            cell     = m_items.unchecked(slot(position));
+            const SizeType       sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t lag      = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if(lag == 0)
+            {
+                if(m_head.position.compare_exchange_weak(
+                     position, position + 1, std::memory_order_relaxed))
+                {
+                    item_ = std::move(cell.value);
+                    cell.sequence.store(position + ItemCount, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if(lag < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_head.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Moves the oldest items of the ring into `items_`, as many as are available.
+ *
+ * \param       items_: Destination of the items.
+ *
+ * \return      Number of items removed, stored at the front of `items_`.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+inline typename RING_ARRAY_CLASS_SCOPE__::SizeType
+RING_ARRAY_CLASS_SCOPE__::pop(std::span<ItemType> items_)
+{
+    const SizeType wanted = std::min(items_.size(), ItemCount);
+    if(wanted == 0)
+    {
+        return 0;
+    }
+
+    if constexpr(Mode == ring_mode::spsc)
+    {
+        const SizeType head = m_head.position.load(std::memory_order_relaxed);
+        if(m_head.opposite - head < wanted)
+        {
+            m_head.opposite = m_tail.position.load(std::memory_order_acquire);
+        }
+
+        const SizeType count     = std::min(wanted, m_head.opposite - head);
+        const SizeType first     = slot(head);
+        const SizeType headCount = std::min(count, ItemCount - first);
+        std::move(m_items.data() + first, m_items.data() + first + headCount, items_.data());
+        std::move(m_items.data(), m_items.data() + (count - headCount), items_.data() + headCount);
+
+        m_head.position.store(head + count, std::memory_order_release);
+        return count;
+    }
+    else
+    {
+        SizeType position = m_head.position.load(std::memory_order_relaxed);
+        while(true)
+        {
+            /* Count the slots already filled by the producers, then claim them all at once */
+            SizeType count = 0;
+            while((count < wanted) &&
+                  (m_items.unchecked(slot(position + count))
+                     .sequence.load(std::memory_order_acquire) == position + count + 1))
+            {
+                ++count;
+            }
+
+            if(count == 0)
+            {
+                const SizeType sequence =
+                  m_items.unchecked(slot(position)).sequence.load(std::memory_order_acquire);
+                if(static_cast<std::ptrdiff_t>(sequence - (position + 1)) < 0)
+                {
+                    return 0;
+                }
+                position = m_head.position.load(std::memory_order_relaxed);
+            }
+            else if(m_head.position.compare_exchange_weak(
+                      position, position + count, std::memory_order_relaxed))
+            {
+                for(SizeType index = 0; index < count; ++index)
+                {
+                    SlotType& cell = m_items.unchecked(slot(position + index));
+                    items_[index]  = std::move(cell.value);
+                    cell.sequence.store(position + index + ItemCount, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************/
+/* SIZE ---------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Number of items in the ring.
+ *
+ * \note        The value is a snapshot: other threads can push or pop items as soon as it's read.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline typename RING_ARRAY_CLASS_SCOPE__::SizeType
+RING_ARRAY_CLASS_SCOPE__::size() const noexcept
+{
+    /* Reading the head first, the tail can only be ahead of it */
+    const SizeType head = m_head.position.load(std::memory_order_acquire);
+    const SizeType tail = m_tail.position.load(std::memory_order_acquire);
+    return std::min(tail - head, ItemCount);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Checks if the ring holds no item, at the time of the call.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::empty() const noexcept
+{
+    return size() == 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Maximum number of items in the ring.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename RING_ARRAY_CLASS_SCOPE__::SizeType
+RING_ARRAY_CLASS_SCOPE__::capacity() noexcept
+{
+    return ItemCount;
+}
+
+
+/*************************************************************************************************/
+/* PRIVATE METHODS ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Slot of the ring holding `position_`.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename RING_ARRAY_CLASS_SCOPE__::SizeType
+RING_ARRAY_CLASS_SCOPE__::slot(SizeType position_) noexcept
+{
+    if constexpr(masked_indexes)
+    {
+        return position_ & (ItemCount - 1);
+    }
+    else
+    {
+        return position_ % ItemCount;
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Reserves the slot after the tail and builds an item from `args_` in it.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+template<typename... Args>
+[[nodiscard]] inline bool
+RING_ARRAY_CLASS_SCOPE__::push_one(Args&&... args_)
+{
+    if constexpr(Mode == ring_mode::spsc)
+    {
+        const SizeType tail = m_tail.position.load(std::memory_order_relaxed);
+        if(tail - m_tail.opposite == ItemCount)
+        {
+            m_tail.opposite = m_head.position.load(std::memory_order_acquire);
+            if(tail - m_tail.opposite == ItemCount)
+            {
+                return false;
+            }
+        }
+
+        emplace_into(m_items.unchecked(slot(tail)), std::forward<Args>(args_)...);
+        m_tail.position.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    else
+    {
+        SizeType position = m_tail.position.load(std::memory_order_relaxed);
+        while(true)
+        {
+            SlotType&            cell     = m_items.unchecked(slot(position));
+            const SizeType       sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t lag      = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if(lag == 0)
+            {
+                if(m_tail.position.compare_exchange_weak(
+                     position, position + 1, std::memory_order_relaxed))
+                {
+                    emplace_into(cell.value, std::forward<Args>(args_)...);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if(lag < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_tail.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Stores an item built from `args_` in `slot_`, assigning it directly when `args_` is
+ *              already an item.
+ *************************************************************************************************/
+template<RING_ARRAY_TEMPLATE_DECLARATION__>
+template<typename... Args>
+inline void
+RING_ARRAY_CLASS_SCOPE__::emplace_into(ItemType& slot_, Args&&... args_)
+{
+    if constexpr((sizeof...(Args) == 1) &&
+                 (std::is_same_v<std::remove_cvref_t<Args>, ItemType> && ...))
+    {
+        ((slot_ = std::forward<Args>(args_)), ...);
+    }
+    else
+    {
+        slot_ = ItemType(std::forward<Args>(args_)...);
+    }
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef RING_ARRAY_TEMPLATE_DECLARATION__
+#undef RING_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,205 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+/*************************************************************************************************/
+/* Target detection ---------------------------------------------------------------------------- */
+
+/* Width, in bytes, of the widest vector register enabled for this compilation unit.
+ * The width follows the instruction sets enabled on the command line (ie `-mavx2`, `-march=native`,
+ * `/arch:AVX2`), so that no code is emitted for instructions the target cannot run. */
+#if defined(__AVX512F__)
+#define PEL_SIMD_REGISTER_BYTES 64
+#elif defined(__AVX__)
+#define PEL_SIMD_REGISTER_BYTES 32
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON)
+#define PEL_SIMD_REGISTER_BYTES 16
+#else
+#define PEL_SIMD_REGISTER_BYTES 0
+#endif
+
+/* Vector packs are built on the GCC/Clang vector extensions, which lower to SSE/AVX2/AVX-512 (or
+ * NEON) for the enabled target. Other compilers get the portable scalar path. */
+#if (defined(__GNUC__) || defined(__clang__)) && (PEL_SIMD_REGISTER_BYTES > 0)
+#define PEL_SIMD_VECTOR_EXTENSIONS 1
+#else
+#define PEL_SIMD_VECTOR_EXTENSIONS 0
+#endif
+
+
+namespace pel::simd
+{
+constexpr std::size_t register_bytes = PEL_SIMD_REGISTER_BYTES;
+
+/**
+ **************************************************************************************************
+ * \brief       Whether items of type `ItemType` can be processed in vector packs.
+ *************************************************************************************************/
+template<typename ItemType>
+constexpr bool is_vectorizable = (PEL_SIMD_VECTOR_EXTENSIONS == 1)
+                                 && std::is_arithmetic_v<ItemType>
+                                 && !std::is_same_v<ItemType, bool>
+                                 && (sizeof(ItemType) <= 8)
+                                 && !std::is_same_v<ItemType, long double>;
+
+
+/*************************************************************************************************/
+/* Pack types ---------------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Types used to process `ItemType` items by packs.
+ *
+ * \note        When `ItemType` is not vectorizable, a pack is a single `ItemType` and a mask is a
+ *              `bool`, so that the same generic code runs on both paths.
+ *************************************************************************************************/
+template<typename ItemType, bool Vectorizable = is_vectorizable<ItemType>>
+struct pack_traits
+{
+    using PackType = ItemType;
+    using MaskType = bool;
+
+    static constexpr std::size_t lanes = 1;
+};
+
+#if PEL_SIMD_VECTOR_EXTENSIONS == 1
+template<typename ItemType>
+struct pack_traits<ItemType, true>
+{
+    using MaskItemType =
+      std::conditional_t<sizeof(ItemType) == 1,
+                         std::int8_t,
+                         std::conditional_t<sizeof(ItemType) == 2,
+                                            std::int16_t,
+                                            std::conditional_t<sizeof(ItemType) == 4,
+                                                               std::int32_t,
+                                                               std::int64_t>>>;
+
+    /* The attribute must be applied through a typedef to be kept on a dependent type */
+    typedef ItemType     PackType __attribute__((vector_size(register_bytes)));
+    typedef MaskItemType MaskType __attribute__((vector_size(register_bytes)));
+
+    static constexpr std::size_t lanes = register_bytes / sizeof(ItemType);
+};
+#endif
+
+template<typename ItemType>
+using pack = typename pack_traits<ItemType>::PackType;
+
+template<typename ItemType>
+using mask = typename pack_traits<ItemType>::MaskType;
+
+template<typename ItemType>
+constexpr std::size_t lanes = pack_traits<ItemType>::lanes;
+
+
+/*************************************************************************************************/
+/* Pack operations ----------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Load a pack of `lanes<ItemType>` items from unaligned memory.
+ *
+ * \param       source_: Pointer to the first item to load.
+ *
+ * \retval      pack<ItemType>: Loaded pack.
+ *************************************************************************************************/
+template<typename ItemType>
+[[nodiscard]] inline pack<ItemType>
+load(const ItemType* source_) noexcept
+{
+    pack<ItemType> result;
+    std::memcpy(&result, source_, sizeof(result));
+    return result;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Store a pack of `lanes<ItemType>` items to unaligned memory.
+ *
+ * \param       destination_: Pointer to the first item to store to.
+ * \param       value_:       Pack to store.
+ *************************************************************************************************/
+template<typename ItemType>
+inline void
+store(ItemType* destination_, const pack<ItemType>& value_) noexcept
+{
+    std::memcpy(destination_, &value_, sizeof(value_));
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Create a pack with all its lanes set to `value_`.
+ *
+ * \param       value_: Value to broadcast.
+ *
+ * \retval      pack<ItemType>: Broadcasted pack.
+ *************************************************************************************************/
+template<typename ItemType>
+[[nodiscard]] inline pack<ItemType>
+broadcast(const ItemType& value_) noexcept
+{
+    if constexpr(lanes<ItemType> == 1)
+    {
+        return value_;
+    }
+    else
+    {
+        /* Mixing a scalar in a vector operation broadcasts the scalar */
+        return pack<ItemType>{} + value_;
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Pick, lane by lane, `ifTrue_` where `mask_` is set and `ifFalse_` elsewhere.
+ *
+ * \param       mask_:    Lane selection mask, as returned by a pack comparison.
+ * \param       ifTrue_:  Lanes selected where the mask is set.
+ * \param       ifFalse_: Lanes selected where the mask is cleared.
+ *
+ * \retval      pack<ItemType>: Blended pack.
+ *************************************************************************************************/
+template<typename ItemType>
+[[nodiscard]] inline pack<ItemType>
+blend(const mask<ItemType>& mask_,
+      const pack<ItemType>& ifTrue_,
+      const pack<ItemType>& ifFalse_) noexcept
+{
+    return mask_ ? ifTrue_ : ifFalse_;
+}
+
+}        // namespace pel::simd
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,394 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./simd.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+/*************************************************************************************************/
+/* Target detection ---------------------------------------------------------------------------- */
+
+/* Hardware gathers come with AVX2, scatters and compress/expand with AVX-512F */
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__AVX512F__)
+#define PEL_SIMD_PERMUTE_AVX512 1
+#else
+#define PEL_SIMD_PERMUTE_AVX512 0
+#endif
+
+#if (PEL_SIMD_VECTOR_EXTENSIONS == 1) && defined(__AVX2__)
+#define PEL_SIMD_PERMUTE_AVX2 1
+#else
+#define PEL_SIMD_PERMUTE_AVX2 0
+#endif
+
+
+namespace pel::simd
+{
+/**
+ **************************************************************************************************
+ * \brief       Whether `ItemType` items are moved by the permutation instructions: 32 or 64-bit
+ *              items copied bit for bit, picked by 32-bit indices.
+ *************************************************************************************************/
+template<typename ItemType, typename IndexType = std::uint32_t>
+constexpr bool is_permutable = std::is_trivially_copyable_v<ItemType>
+                               && (sizeof(ItemType) == 4 || sizeof(ItemType) == 8)
+                               && std::is_integral_v<IndexType> && (sizeof(IndexType) == 4);
+
+/* The permutation instructions take their indices as signed 32-bit offsets */
+constexpr std::size_t max_permute_offset =
+  static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+
+/* Items moved by a permutation instruction. The functions below take the largest `count_` known
+ * at compile-time, so that the vector loops are dropped rather than merely skipped for arrays
+ * shorter than that: GCC would otherwise warn about their out-of-bounds loads. */
+template<typename ItemType>
+constexpr std::size_t permute_lanes =
+  ((PEL_SIMD_PERMUTE_AVX512 == 1) ? 64 : 32) / sizeof(ItemType);
+
+constexpr std::size_t unbounded_count = std::numeric_limits<std::size_t>::max();
+
+
+/*************************************************************************************************/
+/* Gather and scatter -------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Copy `source_[indices_[i]]` to `destination_[i]`, for each `i` below `count_`.
+ *
+ * \tparam      MaxCount:     Largest `count_`, known at compile-time.
+ *
+ * \param       destination_: Pointer to the first item to write.
+ * \param       source_:      Pointer to the first item of the source.
+ * \param       sourceCount_: Number of items of the source, which every index is below.
+ * \param       indices_:     Pointer to the first index.
+ * \param       count_:       Number of items to gather.
+ *
+ * \note        Uses `vpgatherdd`/`vpgatherdq` when the target has them, for sources small enough
+ *              to be indexed by signed 32-bit offsets.
+ *************************************************************************************************/
+template<std::size_t MaxCount = unbounded_count, typename ItemType, typename IndexType>
+constexpr void
+gather(ItemType*        destination_,
+       const ItemType*  source_,
+       std::size_t      sourceCount_,
+       const IndexType* indices_,
+       std::size_t      count_) noexcept
+{
+    std::size_t i = 0;
+
+#if PEL_SIMD_PERMUTE_AVX2 == 1
+    if constexpr(is_permutable<ItemType, IndexType> && (MaxCount >= permute_lanes<ItemType>))
+    {
+        if(!std::is_constant_evaluated() && (sourceCount_ <= max_permute_offset))
+        {
+#if PEL_SIMD_PERMUTE_AVX512 == 1
+            if constexpr(sizeof(ItemType) == 4)
+            {
+                for(; i + 16 <= count_; i += 16)
+                {
+                    const __m512i index = _mm512_loadu_si512(indices_ + i);
+                    const __m512i items = _mm512_mask_i32gather_epi32(
+                      _mm512_setzero_si512(), 0xFFFF, index, source_, 4);
+                    _mm512_storeu_si512(destination_ + i, items);
+                }
+            }
+            else
+            {
+                for(; i + 8 <= count_; i += 8)
+                {
+                    const __m256i index =
+                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices_ + i));
+                    const __m512i items = _mm512_mask_i32gather_epi64(
+                      _mm512_setzero_si512(), 0xFF, index, source_, 8);
+                    _mm512_storeu_si512(destination_ + i, items);
+                }
+            }
+#else
+            if constexpr(sizeof(ItemType) == 4)
+            {
+                for(; i + 8 <= count_; i += 8)
+                {
+                    const __m256i index =
+                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices_ + i));
+                    const __m256i items =
+                      _mm256_i32gather_epi32(reinterpret_cast<const int*>(source_), index, 4);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination_ + i), items);
+                }
+            }
+            else
+            {
+                for(; i + 4 <= count_; i += 4)
+                {
+                    const __m128i index =
+                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices_ + i));
+                    const __m256i items =
+                      _mm256_i32gather_epi64(reinterpret_cast<const long long*>(source_), index, 8);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination_ + i), items);
+                }
+            }
+#endif
+        }
+    }
+#else
+    static_cast<void>(sourceCount_);
+#endif
+
+    for(; i < count_; ++i)
+    {
+        destination_[i] = source_[indices_[i]];
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Copy `source_[i]` to `destination_[indices_[i]]`, for each `i` below `count_`.
+ *              When an index repeats, the last item copied to it stays.
+ *
+ * \tparam      MaxCount:          Largest `count_`, known at compile-time.
+ *
+ * \param       destination_:      Pointer to the first item of the destination.
+ * \param       destinationCount_: Number of items of the destination, which every index is below.
+ * \param       source_:           Pointer to the first item to read.
+ * \param       indices_:          Pointer to the first index.
+ * \param       count_:            Number of items to scatter.
+ *
+ * \note        Uses `vpscatterdd`/`vpscatterdq` when the target has them, whose lanes are written
+ *              in order: the last of the repeated indices wins there too.
+ *************************************************************************************************/
+template<std::size_t MaxCount = unbounded_count, typename ItemType, typename IndexType>
+constexpr void
+scatter(ItemType*        destination_,
+        std::size_t      destinationCount_,
+        const ItemType*  source_,
+        const IndexType* indices_,
+        std::size_t      count_) noexcept
+{
+    std::size_t i = 0;
+
+#if PEL_SIMD_PERMUTE_AVX512 == 1
+    if constexpr(is_permutable<ItemType, IndexType> && (MaxCount >= permute_lanes<ItemType>))
+    {
+        if(!std::is_constant_evaluated() && (destinationCount_ <= max_permute_offset))
+        {
+            if constexpr(sizeof(ItemType) == 4)
+            {
+                for(; i + 16 <= count_; i += 16)
+                {
+                    const __m512i index = _mm512_loadu_si512(indices_ + i);
+                    const __m512i items = _mm512_loadu_si512(source_ + i);
+                    _mm512_i32scatter_epi32(destination_, index, items, 4);
+                }
+            }
+            else
+            {
+                for(; i + 8 <= count_; i += 8)
+                {
+                    const __m256i index =
+                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices_ + i));
+                    const __m512i items = _mm512_loadu_si512(source_ + i);
+                    _mm512_i32scatter_epi64(destination_, index, items, 8);
+                }
+            }
+        }
+    }
+#else
+    static_cast<void>(destinationCount_);
+#endif
+
+    for(; i < count_; ++i)
+    {
+        destination_[indices_[i]] = source_[i];
+    }
+}
+
+
+/*************************************************************************************************/
+/* Compress and expand ------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Copy the items of `source_` whose mask is set to the front of `destination_`, in
+ *              order (stream compaction).
+ *
+ * \tparam      MaxCount:     Largest `count_`, known at compile-time.
+ *
+ * \param       destination_: Pointer to the first item to write, with room for `count_` items.
+ * \param       source_:      Pointer to the first item to read.
+ * \param       mask_:        Pointer to the first selection flag.
+ * \param       count_:       Number of items to read.
+ *
+ * \retval      std::size_t: Number of items copied.
+ *
+ * \note        Uses `vpcompressd`/`vpcompressq` when the target has them. Elsewhere, trivially
+ *              copyable items are copied without branches: every item is written after the last
+ *              one kept, and only kept if its flag is set, so that `destination_` needs room for
+ *              `count_` items, and its items after the copied ones are overwritten.
+ *************************************************************************************************/
+template<std::size_t MaxCount = unbounded_count, typename ItemType>
+constexpr std::size_t
+compress(ItemType* destination_, const ItemType* source_, const bool* mask_, std::size_t count_)
+{
+    std::size_t kept = 0;
+    std::size_t i    = 0;
+
+#if PEL_SIMD_PERMUTE_AVX512 == 1
+    if constexpr(is_permutable<ItemType> && (MaxCount >= permute_lanes<ItemType>))
+    {
+        if(!std::is_constant_evaluated())
+        {
+            if constexpr(sizeof(ItemType) == 4)
+            {
+                for(; i + 16 <= count_; i += 16)
+                {
+                    const __m512i   flags = _mm512_maskz_cvtepu8_epi32(
+                      0xFFFF,
+                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_ + i)));
+                    const __mmask16 keep  = _mm512_test_epi32_mask(flags, flags);
+                    const __m512i   items = _mm512_loadu_si512(source_ + i);
+                    _mm512_storeu_si512(destination_ + kept,
+                                        _mm512_maskz_compress_epi32(keep, items));
+                    kept += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(keep)));
+                }
+            }
+            else
+            {
+                for(; i + 8 <= count_; i += 8)
+                {
+                    const __m512i  flags = _mm512_maskz_cvtepu8_epi64(
+                      0xFF,
+                      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask_ + i)));
+                    const __mmask8 keep  = _mm512_test_epi64_mask(flags, flags);
+                    const __m512i  items = _mm512_loadu_si512(source_ + i);
+                    _mm512_storeu_si512(destination_ + kept,
+                                        _mm512_maskz_compress_epi64(keep, items));
+                    kept += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(keep)));
+                }
+            }
+        }
+    }
+#endif
+
+    for(; i < count_; ++i)
+    {
+        if constexpr(std::is_trivially_copyable_v<ItemType>)
+        {
+            destination_[kept] = source_[i];
+            kept += static_cast<std::size_t>(mask_[i]);
+        }
+        else if(mask_[i])
+        {
+            destination_[kept++] = source_[i];
+        }
+    }
+    return kept;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Copy the first items of `source_`, in order, to the items of `destination_` whose
+ *              mask is set, leaving the others unchanged (stream expansion).
+ *
+ * \tparam      MaxCount:     Largest `count_`, known at compile-time.
+ *
+ * \param       destination_: Pointer to the first item to write.
+ * \param       source_:      Pointer to the first item to read, with an item for each set flag.
+ * \param       mask_:        Pointer to the first selection flag.
+ * \param       count_:       Number of items of `destination_` to select from.
+ *
+ * \retval      std::size_t: Number of items read from `source_`.
+ *
+ * \note        Uses `vpexpandd`/`vpexpandq` when the target has them, which never read past the
+ *              last item used.
+ *************************************************************************************************/
+template<std::size_t MaxCount = unbounded_count, typename ItemType>
+constexpr std::size_t
+expand(ItemType* destination_, const ItemType* source_, const bool* mask_, std::size_t count_)
+{
+    std::size_t used = 0;
+    std::size_t i    = 0;
+
+#if PEL_SIMD_PERMUTE_AVX512 == 1
+    if constexpr(is_permutable<ItemType> && (MaxCount >= permute_lanes<ItemType>))
+    {
+        if(!std::is_constant_evaluated())
+        {
+            if constexpr(sizeof(ItemType) == 4)
+            {
+                for(; i + 16 <= count_; i += 16)
+                {
+                    const __m512i   flags = _mm512_maskz_cvtepu8_epi32(
+                      0xFFFF,
+                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_ + i)));
+                    const __mmask16 take  = _mm512_test_epi32_mask(flags, flags);
+                    const __m512i   items = _mm512_loadu_si512(destination_ + i);
+                    _mm512_storeu_si512(destination_ + i,
+                                        _mm512_mask_expandloadu_epi32(items, take, source_ + used));
+                    used += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(take)));
+                }
+            }
+            else
+            {
+                for(; i + 8 <= count_; i += 8)
+                {
+                    const __m512i  flags = _mm512_maskz_cvtepu8_epi64(
+                      0xFF,
+                      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask_ + i)));
+                    const __mmask8 take  = _mm512_test_epi64_mask(flags, flags);
+                    const __m512i  items = _mm512_loadu_si512(destination_ + i);
+                    _mm512_storeu_si512(destination_ + i,
+                                        _mm512_mask_expandloadu_epi64(items, take, source_ + used));
+                    used += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(take)));
+                }
+            }
+        }
+    }
+#endif
+
+    for(; i < count_; ++i)
+    {
+        if(mask_[i])
+        {
+            destination_[i] = source_[used++];
+        }
+    }
+    return used;
+}
+
+}        // namespace pel::simd
+
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,365 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aggregate.hpp"
+#include "./array.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace pel
+{
+template<aggregate::decomposable_type ItemType,
+         std::size_t ItemCount,
+         typename BoundsCheck = default_bounds_check>
+class soa_array;
+
+
+/*************************************************************************************************/
+/* Proxy reference & iterator ------------------------------------------------------------------ */
+
+/**
+ **************************************************************************************************
+ * \brief       Reference to the item at an index of a `soa_array`, whose fields are scattered in
+ *              the columns of the array.
+ *
+ * \note        The reference converts to, and is assignable from, the item type. Its fields are
+ *              reached with `get<I>()` or through structured bindings, ie:
+ *              `auto [x, y, z] = particles[i];` binds references into the `x`, `y`, `z` columns.
+ *************************************************************************************************/
+template<typename SoaType>
+class soa_reference
+{
+public:
+    using ValueType = typename std::remove_const_t<SoaType>::ValueType;
+    using SizeType  = std::size_t;
+
+    constexpr soa_reference(SoaType& soa_, SizeType index_) noexcept
+    : m_soa{std::addressof(soa_)}, m_index{index_}
+    {
+    }
+    constexpr soa_reference(const soa_reference& copy_) noexcept = default;
+
+    template<std::size_t FieldIndex>
+    [[nodiscard]] constexpr auto& get() const noexcept
+    {
+        return m_soa->template column<FieldIndex>().unchecked(m_index);
+    }
+
+    [[nodiscard]] constexpr operator ValueType() const
+    {
+        return m_soa->load_item(m_index);
+    }
+
+    /* Assignments write through to the columns, they never rebind the reference */
+    constexpr const soa_reference& operator=(const ValueType& value_) const
+    requires(!std::is_const_v<SoaType>)
+    {
+        m_soa->store_item(m_index, value_);
+        return *this;
+    }
+    constexpr const soa_reference& operator=(const soa_reference& other_) const
+    requires(!std::is_const_v<SoaType>)
+    {
+        m_soa->store_item(m_index, static_cast<ValueType>(other_));
+        return *this;
+    }
+
+    /* Swaps the referenced items, for algorithms permuting the array (ie `std::sort`) */
+    friend constexpr void swap(const soa_reference& lhs_, const soa_reference& rhs_)
+    requires(!std::is_const_v<SoaType>)
+    {
+        const ValueType value = lhs_;
+        lhs_                  = rhs_;
+        rhs_                  = value;
+    }
+
+private:
+    SoaType* m_soa;
+    SizeType m_index;
+};
+
+/**
+ **************************************************************************************************
+ * \brief       Random-access iterator over the items of a `soa_array`, dereferencing to
+ *              `soa_reference`s.
+ *************************************************************************************************/
+template<typename SoaType>
+class soa_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = typename std::remove_const_t<SoaType>::ValueType;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = soa_reference<SoaType>;
+
+    using ReverseIteratorType = std::reverse_iterator<soa_iterator>;
+
+    constexpr soa_iterator() noexcept = default;
+    constexpr soa_iterator(SoaType& soa_, std::size_t index_) noexcept
+    : m_soa{std::addressof(soa_)}, m_index{index_}
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept
+    {
+        return reference{*m_soa, m_index};
+    }
+    [[nodiscard]] constexpr reference operator[](difference_type offset_) const noexcept
+    {
+        return reference{*m_soa, m_index + static_cast<std::size_t>(offset_)};
+    }
+
+    constexpr soa_iterator& operator++() noexcept
+    {
+        ++m_index;
+        return *this;
+    }
+    constexpr soa_iterator operator++(int) noexcept
+    {
+        soa_iterator previous = *this;
+        ++m_index;
+        return previous;
+    }
+    constexpr soa_iterator& operator--() noexcept
+    {
+        --m_index;
+        return *this;
+    }
+    constexpr soa_iterator operator--(int) noexcept
+    {
+        soa_iterator previous = *this;
+        --m_index;
+        return previous;
+    }
+
+    constexpr soa_iterator& operator+=(difference_type offset_) noexcept
+    {
+        m_index += static_cast<std::size_t>(offset_);
+        return *this;
+    }
+    constexpr soa_iterator& operator-=(difference_type offset_) noexcept
+    {
+        m_index -= static_cast<std::size_t>(offset_);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr soa_iterator operator+(soa_iterator    it_,
+                                                          difference_type offset_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr soa_iterator operator+(difference_type offset_,
+                                                          soa_iterator    it_) noexcept
+    {
+        return it_ += offset_;
+    }
+    [[nodiscard]] friend constexpr soa_iterator operator-(soa_iterator    it_,
+                                                          difference_type offset_) noexcept
+    {
+        return it_ -= offset_;
+    }
+    [[nodiscard]] friend constexpr difference_type operator-(const soa_iterator& lhs_,
+                                                             const soa_iterator& rhs_) noexcept
+    {
+        return static_cast<difference_type>(lhs_.m_index - rhs_.m_index);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const soa_iterator& other_) const noexcept
+    {
+        return m_index == other_.m_index;
+    }
+    [[nodiscard]] constexpr auto operator<=>(const soa_iterator& other_) const noexcept
+    {
+        return m_index <=> other_.m_index;
+    }
+
+private:
+    SoaType*    m_soa   = nullptr;
+    std::size_t m_index = 0;
+};
+
+
+/*************************************************************************************************/
+/* Structure of arrays ------------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Fixed-size array of aggregates, stored as one `pel::array` per field
+ *              (structure of arrays).
+ *
+ * \note        Kernels working on a single field read a contiguous `column<I>()` instead of
+ *              striding over whole items, and columns are regular `pel::array`s: they can be
+ *              used in array expressions and reductions, which process them by SIMD packs, ie:
+ *              `particles.column<0>() = particles.column<0>() + particles.column<3>() * dt;`
+ *
+ * \note        Iterating or indexing the array yields `soa_reference` proxies, so that code
+ *              written for an array of structures keeps working.
+ *
+ * \note        `ItemType` must be an aggregate of at most `aggregate::max_fields` fields, none of
+ *              which is a C array.
+ *************************************************************************************************/
+template<aggregate::decomposable_type ItemType, std::size_t ItemCount, typename BoundsCheck>
+class soa_array
+{
+    template<typename IndexSequence>
+    struct column_tuple;
+    template<std::size_t... FieldIndexes>
+    struct column_tuple<std::index_sequence<FieldIndexes...>>
+    {
+        using type = std::tuple<
+          array<aggregate::field_type<ItemType, FieldIndexes>, ItemCount, BoundsCheck>...>;
+    };
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using ValueType           = ItemType;
+    using SizeType            = std::size_t;
+    using DifferenceType      = std::ptrdiff_t;
+    using ReferenceType       = soa_reference<soa_array>;
+    using ConstReferenceType  = soa_reference<const soa_array>;
+    using IteratorType        = soa_iterator<soa_array>;
+    using ConstIteratorType   = soa_iterator<const soa_array>;
+    using RIteratorType       = typename IteratorType::ReverseIteratorType;
+    using ConstRIteratorType  = typename ConstIteratorType::ReverseIteratorType;
+    using InitializerListType = std::initializer_list<ItemType>;
+    using BoundsCheckType     = BoundsCheck;
+    using ColumnsType =
+      typename column_tuple<std::make_index_sequence<aggregate::field_count<ItemType>>>::type;
+
+    template<std::size_t FieldIndex>
+    using ColumnType = std::tuple_element_t<FieldIndex, ColumnsType>;
+
+    static constexpr SizeType field_count = aggregate::field_count<ItemType>;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr explicit soa_array() = default;
+    constexpr explicit soa_array(const ItemType& value_);
+    constexpr soa_array(InitializerListType ilist_);
+
+    template<typename OtherBoundsCheck>
+    constexpr explicit soa_array(const array<ItemType, ItemCount, OtherBoundsCheck>& items_);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cbegin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cend() const noexcept;
+
+    [[nodiscard]] constexpr RIteratorType      rbegin() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType      rend() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ReferenceType
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr ConstReferenceType
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] constexpr ReferenceType      at(SizeType index_);
+    [[nodiscard]] constexpr ConstReferenceType at(SizeType index_) const;
+    [[nodiscard]] constexpr ReferenceType      unchecked(SizeType index_) noexcept;
+    [[nodiscard]] constexpr ConstReferenceType unchecked(SizeType index_) const noexcept;
+
+    template<std::size_t FieldIndex>
+    [[nodiscard]] constexpr ColumnType<FieldIndex>& column() noexcept;
+    template<std::size_t FieldIndex>
+    [[nodiscard]] constexpr const ColumnType<FieldIndex>& column() const noexcept;
+
+    [[nodiscard]] constexpr array<ItemType, ItemCount, BoundsCheck> to_aos() const;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] static constexpr SizeType length() noexcept;
+    [[nodiscard]] static constexpr SizeType size() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    friend ReferenceType;
+    friend ConstReferenceType;
+
+    [[nodiscard]] constexpr ItemType load_item(SizeType index_) const;
+    constexpr void                   store_item(SizeType index_, const ItemType& value_);
+
+    template<std::size_t... FieldIndexes>
+    [[nodiscard]] constexpr ItemType load_fields(SizeType index_,
+                                                 std::index_sequence<FieldIndexes...>) const;
+    template<std::size_t... FieldIndexes>
+    constexpr void store_fields(SizeType        index_,
+                                const ItemType& value_,
+                                std::index_sequence<FieldIndexes...>);
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    constexpr static SizeType m_size = ItemCount;
+    ColumnsType               m_columns;
+};
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* Structured bindings ------------------------------------------------------------------------- */
+template<typename SoaType>
+struct std::tuple_size<pel::soa_reference<SoaType>>
+: std::integral_constant<std::size_t, std::remove_const_t<SoaType>::field_count>
+{
+};
+
+template<std::size_t FieldIndex, typename SoaType>
+struct std::tuple_element<FieldIndex, pel::soa_reference<SoaType>>
+{
+    using type = decltype(std::declval<const pel::soa_reference<SoaType>&>()
+                            .template get<FieldIndex>());
+};
+
+
+#include "./soa_array.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
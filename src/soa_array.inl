@@ -0,0 +1,352 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "./soa_array.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define SOA_ARRAY_TEMPLATE_DECLARATION__                                                           \
+    aggregate::decomposable_type ItemType, std::size_t ItemCount, typename BoundsCheck
+#define SOA_ARRAY_CLASS_SCOPE__ soa_array<ItemType, ItemCount, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* CONSTRUCTORS -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Default-value constructor for the SoA array class.
+ *
+ * \param       value_: Item whose fields are copied in every row of the columns.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+constexpr SOA_ARRAY_CLASS_SCOPE__::soa_array(const ItemType& value_)
+{
+    std::fill(begin(), end(), value_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Initializer-list constructor for the SoA array class.
+ *
+ * \param       ilist_: Items to scatter in the first rows of the columns.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+constexpr SOA_ARRAY_CLASS_SCOPE__::soa_array(InitializerListType ilist_)
+{
+    BoundsCheck::template check<std::length_error>(ilist_.size() <= m_size,
+                                                   "Data couldn't fit in array");
+
+    std::copy(ilist_.begin(), ilist_.end(), begin());
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Array-of-structures to structure-of-arrays conversion constructor.
+ *
+ * \param       items_: Items to scatter in the columns.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+template<typename OtherBoundsCheck>
+constexpr SOA_ARRAY_CLASS_SCOPE__::soa_array(
+  const array<ItemType, ItemCount, OtherBoundsCheck>& items_)
+{
+    for(SizeType i = 0; i < m_size; ++i)
+    {
+        store_item(i, items_.unchecked(i));
+    }
+}
+
+
+/*************************************************************************************************/
+/* ITERATORS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::IteratorType
+SOA_ARRAY_CLASS_SCOPE__::begin() noexcept
+{
+    return IteratorType{*this, 0};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstIteratorType
+SOA_ARRAY_CLASS_SCOPE__::begin() const noexcept
+{
+    return ConstIteratorType{*this, 0};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstIteratorType
+SOA_ARRAY_CLASS_SCOPE__::cbegin() const noexcept
+{
+    return ConstIteratorType{*this, 0};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::IteratorType
+SOA_ARRAY_CLASS_SCOPE__::end() noexcept
+{
+    return IteratorType{*this, m_size};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstIteratorType
+SOA_ARRAY_CLASS_SCOPE__::end() const noexcept
+{
+    return ConstIteratorType{*this, m_size};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstIteratorType
+SOA_ARRAY_CLASS_SCOPE__::cend() const noexcept
+{
+    return ConstIteratorType{*this, m_size};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::RIteratorType
+SOA_ARRAY_CLASS_SCOPE__::rbegin() noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+SOA_ARRAY_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return ConstRIteratorType{end()};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::RIteratorType
+SOA_ARRAY_CLASS_SCOPE__::rend() noexcept
+{
+    return RIteratorType{begin()};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstRIteratorType
+SOA_ARRAY_CLASS_SCOPE__::rend() const noexcept
+{
+    return ConstRIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* ELEMENT ACCESSORS --------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Get a reference to the item at `index_`. `operator[]` is checked according to
+ *              `BoundsCheck::subscript`, `at()` always is and `unchecked()` never is.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \retval      ReferenceType: Proxy reference to the fields of the item.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ReferenceType
+SOA_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return ReferenceType{*this, index_};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstReferenceType
+SOA_ARRAY_CLASS_SCOPE__::operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_size,
+                                                              "Index out of array bounds");
+    return ConstReferenceType{*this, index_};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ReferenceType
+SOA_ARRAY_CLASS_SCOPE__::at(SizeType index_)
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return ReferenceType{*this, index_};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstReferenceType
+SOA_ARRAY_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_size, "Index out of array bounds");
+    return ConstReferenceType{*this, index_};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ReferenceType
+SOA_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) noexcept
+{
+    return ReferenceType{*this, index_};
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::ConstReferenceType
+SOA_ARRAY_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return ConstReferenceType{*this, index_};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the column holding the field `FieldIndex` of every item.
+ *
+ * \retval      ColumnType<FieldIndex>&: `pel::array` of the field, contiguous in memory.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t FieldIndex>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::template ColumnType<FieldIndex>&
+SOA_ARRAY_CLASS_SCOPE__::column() noexcept
+{
+    return std::get<FieldIndex>(m_columns);
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t FieldIndex>
+[[nodiscard]] constexpr inline const typename SOA_ARRAY_CLASS_SCOPE__::template ColumnType<
+  FieldIndex>&
+SOA_ARRAY_CLASS_SCOPE__::column() const noexcept
+{
+    return std::get<FieldIndex>(m_columns);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Gather the columns back into an array of structures.
+ *
+ * \retval      array<ItemType, ItemCount, BoundsCheck>: Items of the array, in order.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline array<ItemType, ItemCount, BoundsCheck>
+SOA_ARRAY_CLASS_SCOPE__::to_aos() const
+{
+    array<ItemType, ItemCount, BoundsCheck> items;
+    for(SizeType i = 0; i < m_size; ++i)
+    {
+        items.unchecked(i) = load_item(i);
+    }
+    return items;
+}
+
+
+/*************************************************************************************************/
+/* SIZE ---------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::SizeType
+SOA_ARRAY_CLASS_SCOPE__::length() noexcept
+{
+    return m_size;
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename SOA_ARRAY_CLASS_SCOPE__::SizeType
+SOA_ARRAY_CLASS_SCOPE__::size() noexcept
+{
+    return m_size;
+}
+
+
+/*************************************************************************************************/
+/* PRIVATE METHODS ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Gather the fields of the item at `index_` from the columns.
+ *
+ * \param       index_: Index of the item, which must be in bounds.
+ *
+ * \retval      ItemType: Copy of the item.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType
+SOA_ARRAY_CLASS_SCOPE__::load_item(SizeType index_) const
+{
+    return load_fields(index_, std::make_index_sequence<field_count>{});
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... FieldIndexes>
+[[nodiscard]] constexpr inline ItemType
+SOA_ARRAY_CLASS_SCOPE__::load_fields(SizeType index_,
+                                     std::index_sequence<FieldIndexes...> /* indexes_ */) const
+{
+    return ItemType{std::get<FieldIndexes>(m_columns).unchecked(index_)...};
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Scatter the fields of `value_` in the columns, at `index_`.
+ *
+ * \param       index_: Index of the item, which must be in bounds.
+ * \param       value_: Item to store.
+ *************************************************************************************************/
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+constexpr inline void
+SOA_ARRAY_CLASS_SCOPE__::store_item(SizeType index_, const ItemType& value_)
+{
+    store_fields(index_, value_, std::make_index_sequence<field_count>{});
+}
+
+template<SOA_ARRAY_TEMPLATE_DECLARATION__>
+template<std::size_t... FieldIndexes>
+constexpr inline void
+SOA_ARRAY_CLASS_SCOPE__::store_fields(SizeType        index_,
+                                      const ItemType& value_,
+                                      std::index_sequence<FieldIndexes...> /* indexes_ */)
+{
+    const auto fields = aggregate::tie(value_);
+    ((std::get<FieldIndexes>(m_columns).unchecked(index_) = std::get<FieldIndexes>(fields)), ...);
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef SOA_ARRAY_TEMPLATE_DECLARATION__
+#undef SOA_ARRAY_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,256 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Fixed-capacity vector ----------------------------------------------------------------------- */
+
+/* Narrowest unsigned type holding every length from 0 to `ItemCount` */
+template<std::size_t ItemCount>
+using minimal_size_type = std::conditional_t<
+  (ItemCount <= std::numeric_limits<std::uint8_t>::max()),
+  std::uint8_t,
+  std::conditional_t<(ItemCount <= std::numeric_limits<std::uint16_t>::max()),
+                     std::uint16_t,
+                     std::conditional_t<(ItemCount <= std::numeric_limits<std::uint32_t>::max()),
+                                        std::uint32_t,
+                                        std::uint64_t>>>;
+
+/**
+ **************************************************************************************************
+ * \brief       Vector of at most `ItemCount` items, stored inline like the items of a
+ *              `pel::array`: it never allocates.
+ *
+ * \note        The storage is the one of `pel::array`, followed by a length as narrow as
+ *              `ItemCount` allows, ie `sizeof(static_vector<std::uint8_t, 16>) == 17`. Only the
+ *              first `size()` items are alive: the others are built when the vector grows and
+ *              destroyed when it shrinks. The vector is trivially copyable whenever `ItemType` is,
+ *              copies then including the unused slots.
+ *
+ * \note        `BoundsCheck` applies to `operator[]`, to positions given to `insert` and `erase`,
+ *              and to growing past `ItemCount`, which throws `std::length_error` with the
+ *              `checked` policy.
+ *************************************************************************************************/
+template<typename ItemType, std::size_t ItemCount, typename BoundsCheck = default_bounds_check>
+class static_vector
+  : private array_storage<ItemType,
+                          ItemCount,
+                          !std::is_trivially_default_constructible_v<ItemType>
+                            || !std::is_trivially_destructible_v<ItemType>>
+{
+    using StorageType = array_storage<ItemType,
+                                      ItemCount,
+                                      !std::is_trivially_default_constructible_v<ItemType>
+                                        || !std::is_trivially_destructible_v<ItemType>>;
+
+    /* Trivial items are copied with the whole storage, other items one by one. An assignment
+     * also builds or destroys the items past the shorter length, so it only copies the storage
+     * when those are trivial too */
+    static constexpr bool defaulted_destructor = std::is_trivially_destructible_v<ItemType>;
+    static constexpr bool defaulted_copy =
+      std::is_trivially_copy_constructible_v<ItemType> || !std::is_copy_constructible_v<ItemType>;
+    static constexpr bool defaulted_move =
+      std::is_trivially_move_constructible_v<ItemType> || !std::is_move_constructible_v<ItemType>;
+    static constexpr bool defaulted_copy_assignment =
+      (std::is_trivially_copy_assignable_v<ItemType> && defaulted_copy && defaulted_destructor)
+      || !std::is_copy_assignable_v<ItemType>;
+    static constexpr bool defaulted_move_assignment =
+      (std::is_trivially_move_assignable_v<ItemType> && defaulted_move && defaulted_destructor)
+      || !std::is_move_assignable_v<ItemType>;
+
+public:
+    /*********************************************************************************************/
+    /* Type definitions ------------------------------------------------------------------------ */
+
+    using SizeType            = std::size_t;
+    using DifferenceType      = std::ptrdiff_t;
+    using LengthType          = minimal_size_type<ItemCount>;
+    using IteratorType        = array_iterator<ItemType>;
+    using ConstIteratorType   = array_iterator<const ItemType>;
+    using RIteratorType       = typename IteratorType::ReverseIteratorType;
+    using ConstRIteratorType  = typename ConstIteratorType::ReverseIteratorType;
+    using InitializerListType = std::initializer_list<ItemType>;
+    using BoundsCheckType     = BoundsCheck;
+    using ViewType            = array_view<ItemType, dynamic_extent, BoundsCheck>;
+    using ConstViewType       = array_view<const ItemType, dynamic_extent, BoundsCheck>;
+
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    constexpr static_vector() noexcept = default;
+    constexpr explicit static_vector(SizeType count_);
+    constexpr static_vector(SizeType count_, const ItemType& value_);
+    constexpr static_vector(InitializerListType ilist_);
+
+    template<std::input_iterator InputIteratorType>
+    constexpr static_vector(InputIteratorType first_, InputIteratorType last_);
+
+    /*-----------------------------------------------*/
+    /* Copy constructor and copy-assignment operator */
+    constexpr static_vector(const static_vector& copy_) requires(defaulted_copy) = default;
+    constexpr static_vector(const static_vector& copy_) requires(!defaulted_copy);
+
+    constexpr static_vector& operator=(const static_vector& copy_)
+    requires(defaulted_copy_assignment)
+    = default;
+    constexpr static_vector& operator=(const static_vector& copy_)
+    requires(!defaulted_copy_assignment);
+
+    /*-----------------------------------------------*/
+    /* Move constructor and move-assignment operator */
+    constexpr static_vector(static_vector&& move_) requires(defaulted_move) = default;
+    constexpr static_vector(static_vector&& move_) noexcept(
+      std::is_nothrow_move_constructible_v<ItemType>)
+    requires(!defaulted_move);
+
+    constexpr static_vector& operator=(static_vector&& move_)
+    requires(defaulted_move_assignment)
+    = default;
+    constexpr static_vector& operator=(static_vector&& move_) noexcept(
+      std::is_nothrow_move_constructible_v<ItemType> && std::is_nothrow_move_assignable_v<ItemType>)
+    requires(!defaulted_move_assignment);
+
+    /*------------*/
+    /* Destructor */
+    constexpr ~static_vector() requires(defaulted_destructor) = default;
+    constexpr ~static_vector() requires(!defaulted_destructor);
+
+
+    /*********************************************************************************************/
+    /* Iterators ------------------------------------------------------------------------------- */
+    [[nodiscard]] constexpr IteratorType      begin() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType begin() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cbegin() const noexcept;
+    [[nodiscard]] constexpr IteratorType      end() noexcept;
+    [[nodiscard]] constexpr ConstIteratorType end() const noexcept;
+    [[nodiscard]] constexpr ConstIteratorType cend() const noexcept;
+
+    [[nodiscard]] constexpr RIteratorType      rbegin() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rbegin() const noexcept;
+    [[nodiscard]] constexpr RIteratorType      rend() noexcept;
+    [[nodiscard]] constexpr ConstRIteratorType rend() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Element accessors ----------------------------------------------------------------------- */
+    [[nodiscard]] constexpr ItemType&
+    operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow);
+    [[nodiscard]] constexpr const ItemType&
+    operator[](SizeType index_) const noexcept(BoundsCheck::subscript::nothrow);
+
+    [[nodiscard]] constexpr ItemType&       at(SizeType index_);
+    [[nodiscard]] constexpr const ItemType& at(SizeType index_) const;
+    [[nodiscard]] constexpr ItemType&       unchecked(SizeType index_) noexcept;
+    [[nodiscard]] constexpr const ItemType& unchecked(SizeType index_) const noexcept;
+
+    [[nodiscard]] constexpr ItemType&       front() noexcept;
+    [[nodiscard]] constexpr const ItemType& front() const noexcept;
+    [[nodiscard]] constexpr ItemType&       back() noexcept;
+    [[nodiscard]] constexpr const ItemType& back() const noexcept;
+
+    [[nodiscard]] constexpr ItemType*       data() noexcept;
+    [[nodiscard]] constexpr const ItemType* data() const noexcept;
+
+    [[nodiscard]] constexpr ViewType      view() noexcept;
+    [[nodiscard]] constexpr ConstViewType view() const noexcept;
+
+
+    /*********************************************************************************************/
+    /* Modifiers ------------------------------------------------------------------------------- */
+    constexpr void push_back(const ItemType& item_);
+    constexpr void push_back(ItemType&& item_);
+
+    template<typename... Args>
+    constexpr ItemType& emplace_back(Args&&... args_);
+
+    constexpr void pop_back() noexcept;
+
+    constexpr IteratorType insert(IteratorType position_, const ItemType& item_);
+    constexpr IteratorType insert(IteratorType position_, ItemType&& item_);
+
+    template<typename... Args>
+    constexpr IteratorType emplace(IteratorType position_, Args&&... args_);
+
+    constexpr IteratorType erase(IteratorType position_);
+    constexpr IteratorType erase(IteratorType first_, IteratorType last_);
+
+    constexpr void resize(SizeType count_);
+    constexpr void resize(SizeType count_, const ItemType& value_);
+
+    constexpr void clear() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Size ------------------------------------------------------------------------------------ */
+    [[nodiscard]] constexpr SizeType length() const noexcept;
+    [[nodiscard]] constexpr SizeType size() const noexcept;
+    [[nodiscard]] constexpr bool     empty() const noexcept;
+    [[nodiscard]] constexpr bool     full() const noexcept;
+
+    [[nodiscard]] static constexpr SizeType capacity() noexcept;
+    [[nodiscard]] static constexpr SizeType max_size() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    constexpr void check_fit(SizeType size_) const;
+    [[nodiscard]] constexpr SizeType index_of(IteratorType position_, SizeType limit_) const;
+
+    template<typename BuilderType>
+    constexpr void append_items(SizeType count_, BuilderType&& builder_);
+    template<typename... Args>
+    constexpr void construct_back(Args&&... args_);
+    constexpr void destroy_back(SizeType count_) noexcept;
+    constexpr void relocate_items(SizeType from_, SizeType to_, SizeType count_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    using StorageType::m_data;
+
+    LengthType m_length = 0;
+};
+
+}        // namespace pel
+
+
+#include "./static_vector.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
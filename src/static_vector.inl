@@ -0,0 +1,898 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./static_vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Defines ------------------------------------------------------------------------------------- */
+#define STATIC_VECTOR_TEMPLATE_DECLARATION__                                                       \
+    typename ItemType, std::size_t ItemCount, typename BoundsCheck
+#define STATIC_VECTOR_CLASS_SCOPE__ static_vector<ItemType, ItemCount, BoundsCheck>
+
+
+/*************************************************************************************************/
+/* CONSTRUCTORS & DESTRUCTORS ------------------------------------------------------------------ */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a vector of `count_` value-initialized items.
+ *
+ * \param       count_: Number of items.
+ *
+ * \throws      std::length_error if `count_` exceeds `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(SizeType count_)
+{
+    resize(count_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor of a vector of `count_` copies of `value_`.
+ *
+ * \param       count_: Number of items.
+ * \param       value_: Value of every item.
+ *
+ * \throws      std::length_error if `count_` exceeds `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(SizeType count_, const ItemType& value_)
+{
+    resize(count_, value_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Initializer list constructor.
+ *
+ * \param       ilist_: Items of the vector.
+ *
+ * \throws      std::length_error if the list is longer than `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(InitializerListType ilist_)
+: static_vector(ilist_.begin(), ilist_.end())
+{
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Range constructor.
+ *
+ * \param       first_: Iterator to the first item to copy.
+ * \param       last_:  Iterator past the last item to copy.
+ *
+ * \throws      std::length_error if the range is longer than `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+template<std::input_iterator InputIteratorType>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(InputIteratorType first_,
+                                                     InputIteratorType last_)
+{
+    if constexpr(std::forward_iterator<InputIteratorType>)
+    {
+        const SizeType count = static_cast<SizeType>(std::distance(first_, last_));
+        append_items(count,
+                     [&first_](ItemType* slot_, SizeType)
+                     {
+                         std::construct_at(slot_, *first_);
+                         ++first_;
+                     });
+    }
+    else
+    {
+        /* Single-pass ranges are appended one item at a time, destroyed again if one throws */
+        array_construction_guard<ItemType> guard{m_data};
+        for(; first_ != last_; ++first_)
+        {
+            check_fit(size() + 1);
+            construct_back(*first_);
+            guard.built = m_length;
+        }
+        guard.built = 0;
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Copy constructor for items that aren't trivially copy constructible.
+ *
+ * \param       copy_: Vector to copy the items of.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(const static_vector& copy_)
+requires(!defaulted_copy)
+{
+    append_items(copy_.size(),
+                 [&copy_](ItemType* slot_, SizeType index_)
+                 {
+                     std::construct_at(slot_, copy_.m_data[index_]);
+                 });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Copy assignment operator for items that aren't trivially copy assignable.
+ *
+ * \param       copy_: Vector to copy the items of.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline STATIC_VECTOR_CLASS_SCOPE__&
+STATIC_VECTOR_CLASS_SCOPE__::operator=(const static_vector& copy_)
+requires(!defaulted_copy_assignment)
+{
+    if(this != &copy_)
+    {
+        const SizeType common = std::min(size(), copy_.size());
+        std::copy_n(copy_.m_data, common, m_data);
+
+        destroy_back(size() - common);
+        append_items(copy_.size() - common,
+                     [&copy_, common](ItemType* slot_, SizeType index_)
+                     {
+                         std::construct_at(slot_, copy_.m_data[common + index_]);
+                     });
+    }
+    return *this;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Move constructor for items that aren't trivially move constructible.
+ *
+ * \param       move_: Vector to move the items of, whose items are left moved-from.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::static_vector(static_vector&& move_) noexcept(
+  std::is_nothrow_move_constructible_v<ItemType>)
+requires(!defaulted_move)
+{
+    append_items(move_.size(),
+                 [&move_](ItemType* slot_, SizeType index_)
+                 {
+                     std::construct_at(slot_, std::move(move_.m_data[index_]));
+                 });
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Move assignment operator for items that aren't trivially move assignable.
+ *
+ * \param       move_: Vector to move the items of, whose items are left moved-from.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline STATIC_VECTOR_CLASS_SCOPE__&
+STATIC_VECTOR_CLASS_SCOPE__::operator=(static_vector&& move_) noexcept(
+  std::is_nothrow_move_constructible_v<ItemType> && std::is_nothrow_move_assignable_v<ItemType>)
+requires(!defaulted_move_assignment)
+{
+    if(this != &move_)
+    {
+        const SizeType common = std::min(size(), move_.size());
+        std::move(move_.m_data, move_.m_data + common, m_data);
+
+        destroy_back(size() - common);
+        append_items(move_.size() - common,
+                     [&move_, common](ItemType* slot_, SizeType index_)
+                     {
+                         std::construct_at(slot_, std::move(move_.m_data[common + index_]));
+                     });
+    }
+    return *this;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Destructor for items that aren't trivially destructible, destroying the live items.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr STATIC_VECTOR_CLASS_SCOPE__::~static_vector() requires(!defaulted_destructor)
+{
+    std::destroy_n(m_data, m_length);
+}
+
+
+/*************************************************************************************************/
+/* ITERATORS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator to the first item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::begin() noexcept
+{
+    return IteratorType{m_data};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::begin() const noexcept
+{
+    return ConstIteratorType{m_data};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::cbegin() const noexcept
+{
+    return ConstIteratorType{m_data};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get an iterator past the last item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::end() noexcept
+{
+    return IteratorType{m_data + m_length};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::end() const noexcept
+{
+    return ConstIteratorType{m_data + m_length};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::cend() const noexcept
+{
+    return ConstIteratorType{m_data + m_length};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a reverse iterator to the last item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::RIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::rbegin() noexcept
+{
+    return RIteratorType{end()};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstRIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::rbegin() const noexcept
+{
+    return ConstRIteratorType{end()};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a reverse iterator before the first item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::RIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::rend() noexcept
+{
+    return RIteratorType{begin()};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstRIteratorType
+STATIC_VECTOR_CLASS_SCOPE__::rend() const noexcept
+{
+    return ConstRIteratorType{begin()};
+}
+
+
+/*************************************************************************************************/
+/* ELEMENT ACCESSORS --------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the vector, checked according to `BoundsCheck::subscript`.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \throws      std::out_of_range if `index_` is past the last item and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::operator[](SizeType index_) noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_length,
+                                                              "Index out of static_vector bounds");
+    return m_data[index_];
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::operator[](SizeType index_) const
+  noexcept(BoundsCheck::subscript::nothrow)
+{
+    BoundsCheck::subscript::template check<std::out_of_range>(index_ < m_length,
+                                                              "Index out of static_vector bounds");
+    return m_data[index_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the vector, always checking its bounds.
+ *
+ * \param       index_: Index of the item to access.
+ *
+ * \throws      std::out_of_range if `index_` is past the last item, whatever the policy.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::at(SizeType index_)
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_length,
+                                                    "Index out of static_vector bounds");
+    return m_data[index_];
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::at(SizeType index_) const
+{
+    bounds_check::checked::check<std::out_of_range>(index_ < m_length,
+                                                    "Index out of static_vector bounds");
+    return m_data[index_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access an item of the vector without bounds checking, whatever the policy.
+ *
+ * \param       index_: Index of the item to access, which must be lower than `size()`.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::unchecked(SizeType index_) noexcept
+{
+    return m_data[index_];
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::unchecked(SizeType index_) const noexcept
+{
+    return m_data[index_];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access the first item of a non-empty vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::front() noexcept
+{
+    return m_data[0];
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::front() const noexcept
+{
+    return m_data[0];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Access the last item of a non-empty vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::back() noexcept
+{
+    return m_data[m_length - 1];
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::back() const noexcept
+{
+    return m_data[m_length - 1];
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get a pointer to the first item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline ItemType*
+STATIC_VECTOR_CLASS_SCOPE__::data() noexcept
+{
+    return m_data;
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline const ItemType*
+STATIC_VECTOR_CLASS_SCOPE__::data() const noexcept
+{
+    return m_data;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       View over the live items of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ViewType
+STATIC_VECTOR_CLASS_SCOPE__::view() noexcept
+{
+    return ViewType{m_data, m_length};
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::ConstViewType
+STATIC_VECTOR_CLASS_SCOPE__::view() const noexcept
+{
+    return ConstViewType{m_data, m_length};
+}
+
+
+/*************************************************************************************************/
+/* MODIFIERS ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Append a copy of `item_` at the end of the vector.
+ *
+ * \param       item_: Item to append.
+ *
+ * \throws      std::length_error if the vector is full and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::push_back(const ItemType& item_)
+{
+    emplace_back(item_);
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::push_back(ItemType&& item_)
+{
+    emplace_back(std::move(item_));
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build an item at the end of the vector.
+ *
+ * \param       args_: Arguments forwarded to the constructor of the item.
+ *
+ * \retval      ItemType&: Reference to the new item.
+ *
+ * \throws      std::length_error if the vector is full and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+template<typename... Args>
+constexpr inline ItemType&
+STATIC_VECTOR_CLASS_SCOPE__::emplace_back(Args&&... args_)
+{
+    check_fit(size() + 1);
+
+    construct_back(std::forward<Args>(args_)...);
+    return back();
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destroy the last item of a non-empty vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::pop_back() noexcept
+{
+    destroy_back(1);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Insert a copy of `item_` before `position_`.
+ *
+ * \param       position_: Iterator to the item to insert before, `end()` to append.
+ * \param       item_:     Item to insert, which may be an item of the vector.
+ *
+ * \retval      IteratorType: Iterator to the inserted item.
+ *
+ * \throws      std::length_error if the vector is full and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::insert(IteratorType position_, const ItemType& item_)
+{
+    return emplace(position_, item_);
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::insert(IteratorType position_, ItemType&& item_)
+{
+    return emplace(position_, std::move(item_));
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build an item before `position_`, shifting the following items by one.
+ *
+ * \param       position_: Iterator to the item to insert before, `end()` to append.
+ * \param       args_:     Arguments forwarded to the constructor of the item.
+ *
+ * \retval      IteratorType: Iterator to the new item.
+ *
+ * \throws      std::length_error if the vector is full and the policy throws.
+ * \throws      std::out_of_range if `position_` isn't in the vector and the policy throws.
+ *
+ * \note        Trivially relocatable items are shifted with a single `memmove`, rather than moved
+ *              one by one.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+template<typename... Args>
+constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::emplace(IteratorType position_, Args&&... args_)
+{
+    const SizeType index = index_of(position_, size() + 1);
+    check_fit(size() + 1);
+
+    if(index == m_length)
+    {
+        construct_back(std::forward<Args>(args_)...);
+        return IteratorType{m_data + index};
+    }
+
+    if constexpr(is_trivially_relocatable_v<ItemType>)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            /* Built aside first, then relocated into the gap left by the shift */
+            alignas(ItemType) std::byte itemBytes[sizeof(ItemType)];
+            std::construct_at(reinterpret_cast<ItemType*>(itemBytes), std::forward<Args>(args_)...);
+
+            relocate_items(index, index + 1, m_length - index);
+            std::memcpy(static_cast<void*>(m_data + index), itemBytes, sizeof(ItemType));
+            ++m_length;
+            return IteratorType{m_data + index};
+        }
+    }
+
+    /* Built first, as the arguments may refer to an item about to be shifted */
+    ItemType item(std::forward<Args>(args_)...);
+
+    construct_back(std::move(back()));
+    std::move_backward(m_data + index, m_data + m_length - 2, m_data + m_length - 1);
+    m_data[index] = std::move(item);
+    return IteratorType{m_data + index};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove the item at `position_`, shifting the following items by one.
+ *
+ * \param       position_: Iterator to the item to remove.
+ *
+ * \retval      IteratorType: Iterator to the item following the removed one.
+ *
+ * \throws      std::out_of_range if `position_` isn't an item of the vector and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::erase(IteratorType position_)
+{
+    const SizeType index = index_of(position_, size());
+
+    return erase(position_, IteratorType{m_data + index + 1});
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Remove the items in `[first_, last_)`, shifting the following items.
+ *
+ * \param       first_: Iterator to the first item to remove.
+ * \param       last_:  Iterator past the last item to remove.
+ *
+ * \retval      IteratorType: Iterator to the item following the removed ones.
+ *
+ * \throws      std::out_of_range if the range isn't in the vector and the policy throws.
+ *
+ * \note        Trivially relocatable items are shifted with a single `memmove`, rather than moved
+ *              one by one.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::IteratorType
+STATIC_VECTOR_CLASS_SCOPE__::erase(IteratorType first_, IteratorType last_)
+{
+    const SizeType last  = index_of(last_, size() + 1);
+    const SizeType first = index_of(first_, last + 1);
+
+    /* Moving the following items onto themselves would leave them moved-from */
+    if(first == last)
+    {
+        return IteratorType{m_data + first};
+    }
+
+    if constexpr(is_trivially_relocatable_v<ItemType>)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            std::destroy(m_data + first, m_data + last);
+            relocate_items(last, first, m_length - last);
+            m_length = static_cast<LengthType>(m_length - (last - first));
+            return IteratorType{m_data + first};
+        }
+    }
+
+    std::move(m_data + last, m_data + m_length, m_data + first);
+    destroy_back(last - first);
+    return IteratorType{m_data + first};
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Change the number of items, value-initializing the new ones.
+ *
+ * \param       count_: New number of items.
+ *
+ * \throws      std::length_error if `count_` exceeds `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::resize(SizeType count_)
+{
+    if(count_ < size())
+    {
+        destroy_back(size() - count_);
+    }
+    else
+    {
+        append_items(count_ - size(), [](ItemType* slot_, SizeType) { std::construct_at(slot_); });
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Change the number of items, copying `value_` into the new ones.
+ *
+ * \param       count_: New number of items.
+ * \param       value_: Value of the new items.
+ *
+ * \throws      std::length_error if `count_` exceeds `ItemCount` and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::resize(SizeType count_, const ItemType& value_)
+{
+    if(count_ < size())
+    {
+        destroy_back(size() - count_);
+    }
+    else
+    {
+        append_items(count_ - size(),
+                     [&value_](ItemType* slot_, SizeType) { std::construct_at(slot_, value_); });
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destroy every item of the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::clear() noexcept
+{
+    destroy_back(size());
+}
+
+
+/*************************************************************************************************/
+/* SIZE ---------------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Number of items in the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::SizeType
+STATIC_VECTOR_CLASS_SCOPE__::length() const noexcept
+{
+    return m_length;
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::SizeType
+STATIC_VECTOR_CLASS_SCOPE__::size() const noexcept
+{
+    return m_length;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Check if the vector holds no item.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+STATIC_VECTOR_CLASS_SCOPE__::empty() const noexcept
+{
+    return m_length == 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Check if the vector holds `ItemCount` items.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline bool
+STATIC_VECTOR_CLASS_SCOPE__::full() const noexcept
+{
+    return m_length == ItemCount;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Maximum number of items in the vector.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::SizeType
+STATIC_VECTOR_CLASS_SCOPE__::capacity() noexcept
+{
+    return ItemCount;
+}
+
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::SizeType
+STATIC_VECTOR_CLASS_SCOPE__::max_size() noexcept
+{
+    return ItemCount;
+}
+
+
+/*************************************************************************************************/
+/* PRIVATE METHODS ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Check that the vector can hold `size_` items.
+ *
+ * \throws      std::length_error if it can't and the `BoundsCheck` policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::check_fit(SizeType size_) const
+{
+    BoundsCheck::template check<std::length_error>(size_ <= ItemCount,
+                                                   "Data couldn't fit in static_vector");
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Index of the item at `position_`, which must be lower than `limit_`.
+ *
+ * \throws      std::out_of_range if `position_` is out of bounds and the policy throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+[[nodiscard]] constexpr inline typename STATIC_VECTOR_CLASS_SCOPE__::SizeType
+STATIC_VECTOR_CLASS_SCOPE__::index_of(IteratorType position_, SizeType limit_) const
+{
+    const DifferenceType index = position_.ptr() - data();
+    BoundsCheck::template check<std::out_of_range>(
+      (index >= 0) && (static_cast<SizeType>(index) < limit_), "Position out of static_vector");
+    return static_cast<SizeType>(index);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build `count_` items after the last one, with `builder_(slot, index)`.
+ *
+ * \throws      std::length_error if they don't fit and the policy throws.
+ *
+ * \note        The items already built are destroyed if a construction throws.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+template<typename BuilderType>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::append_items(SizeType count_, BuilderType&& builder_)
+{
+    check_fit(size() + count_);
+
+    array_construction_guard<ItemType> guard{m_data + m_length};
+    for(; guard.built < count_; ++guard.built)
+    {
+        builder_(m_data + m_length + guard.built, guard.built);
+    }
+
+    m_length    = static_cast<LengthType>(m_length + count_);
+    guard.built = 0;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Build an item after the last one, which the caller checked there's room for.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+template<typename... Args>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::construct_back(Args&&... args_)
+{
+    std::construct_at(m_data + m_length, std::forward<Args>(args_)...);
+    ++m_length;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destroy the last `count_` items.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::destroy_back(SizeType count_) noexcept
+{
+    std::destroy_n(m_data + m_length - count_, count_);
+    m_length = static_cast<LengthType>(m_length - count_);
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Move the bytes of `count_` trivially relocatable items from index `from_` to index
+ *              `to_`, the ranges possibly overlapping. The caller accounts for the items left
+ *              behind, which are neither destroyed nor valid anymore.
+ *************************************************************************************************/
+template<STATIC_VECTOR_TEMPLATE_DECLARATION__>
+constexpr inline void
+STATIC_VECTOR_CLASS_SCOPE__::relocate_items(SizeType from_, SizeType to_, SizeType count_) noexcept
+{
+    std::memmove(static_cast<void*>(m_data + to_), m_data + from_, count_ * sizeof(ItemType));
+}
+
+
+/*************************************************************************************************/
+/* Undefines ----------------------------------------------------------------------------------- */
+#undef STATIC_VECTOR_TEMPLATE_DECLARATION__
+#undef STATIC_VECTOR_CLASS_SCOPE__
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/
@@ -0,0 +1,129 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+/*************************************************************************************************/
+/* File includes ------------------------------------------------------------------------------- */
+#include "./aligned_array.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace pel
+{
+/*************************************************************************************************/
+/* Work-stealing thread pool ------------------------------------------------------------------- */
+
+/**
+ **************************************************************************************************
+ * \brief       Pool of worker threads running numbered chunks of work, used by the
+ *              `pel::parallel` algorithms.
+ *
+ * \note        `run(chunkCount, function)` calls `function(chunk)` once for every chunk in
+ *              `[0, chunkCount)`, on the calling thread and on the workers, and returns once they
+ *              are all done. Each participating thread starts with a contiguous range of chunks,
+ *              takes chunks from its front, and steals the back half of another thread's range
+ *              once its own is empty: uneven chunks are rebalanced without any central queue.
+ *              Ranges are packed in a single atomic word, alone on its cache line.
+ *
+ * \note        The first exception thrown by `function` is rethrown by `run`, once every chunk has
+ *              been handed out. A `run` called from inside a chunk runs on its calling thread.
+ *************************************************************************************************/
+class thread_pool
+{
+public:
+    using ChunkFunctionType = void (*)(const void* context_, std::size_t chunk_);
+
+    /*********************************************************************************************/
+    /* Constructors ---------------------------------------------------------------------------- */
+    explicit thread_pool(std::size_t workerCount_ = default_worker_count());
+    thread_pool(const thread_pool&)            = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    ~thread_pool();
+
+
+    /*********************************************************************************************/
+    /* Execution ------------------------------------------------------------------------------- */
+    template<typename FunctionType>
+    void run(std::size_t chunkCount_, const FunctionType& function_, std::size_t threadCount_ = 0);
+
+    [[nodiscard]] std::size_t        concurrency() const noexcept;
+    [[nodiscard]] static std::size_t default_worker_count() noexcept;
+
+
+    /*********************************************************************************************/
+    /* Private methods ------------------------------------------------------------------------- */
+private:
+    void run_erased(std::size_t       chunkCount_,
+                    ChunkFunctionType function_,
+                    const void*       context_,
+                    std::size_t       threadCount_);
+
+    void               worker_loop(std::size_t slot_);
+    void               participate(std::size_t slot_);
+    [[nodiscard]] bool next_chunk(std::size_t slot_, std::size_t& chunk_) noexcept;
+    void               run_chunk(std::size_t chunk_) noexcept;
+
+
+    /*********************************************************************************************/
+    /* Variables ------------------------------------------------------------------------------- */
+private:
+    using RangeType = std::atomic<std::uint64_t>;
+
+    std::vector<std::thread>                 m_workers;
+    std::unique_ptr<padded_item<RangeType>[]> m_ranges;
+
+    std::mutex              m_runMutex;
+    std::mutex              m_mutex;
+    std::condition_variable m_wakeUp;
+    std::condition_variable m_done;
+    std::uint64_t           m_generation = 0;
+    bool                    m_stopping   = false;
+
+    ChunkFunctionType        m_function         = nullptr;
+    const void*              m_context          = nullptr;
+    std::size_t              m_participantCount = 0;
+    std::atomic<std::size_t> m_activeWorkers    = 0;
+
+    std::mutex         m_exceptionMutex;
+    std::exception_ptr m_exception;
+};
+
+[[nodiscard]] thread_pool& default_thread_pool();
+
+}        // namespace pel
+
+
+#include "./thread_pool.inl"
+
+/*************************************************************************************************/
+/* ----- END OF FILE ----- */
@@ -0,0 +1,365 @@
+﻿/**
+ * \file
+ * \author  Pascal-Emmanuel Lachance
+ * \p       https://www.github.com/Raesangur
+ * ------------------------------------------------------------------------------------------------
+ * MIT License
+ * Copyright (c) 2020 Pascal-Emmanuel Lachance | Ràësangür
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./thread_pool.hpp"
+
+#include <algorithm>
+
+namespace pel
+{
+
+/*************************************************************************************************/
+/* Helpers ------------------------------------------------------------------------------------- */
+
+/* Set on the threads currently running chunks, so that nested runs execute in place */
+inline thread_local bool t_insideThreadPool = false;
+
+[[nodiscard]] constexpr std::uint64_t
+pack_chunk_range(std::uint64_t begin_, std::uint64_t end_) noexcept
+{
+    return (begin_ << 32U) | end_;
+}
+
+
+/*************************************************************************************************/
+/* CONSTRUCTORS -------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Constructor starting the worker threads.
+ *
+ * \param       workerCount_: Number of worker threads, the calling thread of `run` being an extra
+ *                            participant.
+ *              [defaults : one less than the number of hardware threads]
+ *************************************************************************************************/
+inline thread_pool::thread_pool(std::size_t workerCount_)
+: m_ranges{std::make_unique<padded_item<RangeType>[]>(workerCount_ + 1)}
+{
+    m_workers.reserve(workerCount_);
+    for(std::size_t worker = 0; worker < workerCount_; ++worker)
+    {
+        m_workers.emplace_back([this, worker] { worker_loop(worker + 1); });
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Destructor stopping and joining the worker threads.
+ *************************************************************************************************/
+inline thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+
+    for(std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+
+/*************************************************************************************************/
+/* EXECUTION ----------------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Run `function_(chunk)` for every chunk in `[0, chunkCount_)`, and wait for all of
+ *              them to be done.
+ *
+ * \param       chunkCount_:  Number of chunks, which must fit in 32 bits.
+ * \param       function_:    Callable invoked concurrently with chunk numbers.
+ * \param       threadCount_: Maximum number of threads, the calling one included.
+ *              [defaults : 0, every thread of the pool]
+ *
+ * \throws      The first exception thrown by `function_`.
+ *************************************************************************************************/
+template<typename FunctionType>
+inline void
+thread_pool::run(std::size_t chunkCount_, const FunctionType& function_, std::size_t threadCount_)
+{
+    run_erased(
+      chunkCount_,
+      [](const void* context_, std::size_t chunk_)
+      { (*static_cast<const FunctionType*>(context_))(chunk_); },
+      std::addressof(function_),
+      threadCount_);
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the number of threads running chunks: the workers and the calling thread.
+ *
+ * \retval      std::size_t: Maximum number of threads taking part in a `run`.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+thread_pool::concurrency() const noexcept
+{
+    return m_workers.size() + 1;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Get the default number of workers: one per hardware thread but the caller's.
+ *
+ * \retval      std::size_t: One less than the number of hardware threads, at least 0.
+ *************************************************************************************************/
+[[nodiscard]] inline std::size_t
+thread_pool::default_worker_count() noexcept
+{
+    const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Get the pool shared by the `pel::parallel` algorithms, started on first use.
+ *
+ * \retval      thread_pool&: Process-wide pool with the default number of workers.
+ *************************************************************************************************/
+[[nodiscard]] inline thread_pool&
+default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+
+/*************************************************************************************************/
+/* PRIVATE METHODS ----------------------------------------------------------------------------- */
+/*************************************************************************************************/
+
+/**
+ **************************************************************************************************
+ * \brief       Type-erased body of `run`: hand the chunks out and take part in running them.
+ *
+ * \param       chunkCount_:  Number of chunks.
+ * \param       function_:    Function running a chunk.
+ * \param       context_:     First argument of `function_`.
+ * \param       threadCount_: Maximum number of threads, 0 for all of them.
+ *************************************************************************************************/
+inline void
+thread_pool::run_erased(std::size_t       chunkCount_,
+                        ChunkFunctionType function_,
+                        const void*       context_,
+                        std::size_t       threadCount_)
+{
+    const std::size_t allowedThreads = (threadCount_ == 0) ? concurrency() : threadCount_;
+    const std::size_t participants   = std::min({allowedThreads, concurrency(), chunkCount_});
+
+    if((participants <= 1) || t_insideThreadPool)
+    {
+        for(std::size_t chunk = 0; chunk < chunkCount_; ++chunk)
+        {
+            function_(context_, chunk);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock{m_runMutex};
+
+    /* Even split of the chunks, the first participants taking the remainder */
+    const std::size_t chunksPerParticipant = chunkCount_ / participants;
+    const std::size_t remainder            = chunkCount_ % participants;
+
+    std::size_t begin = 0;
+    for(std::size_t slot = 0; slot < participants; ++slot)
+    {
+        const std::size_t end = begin + chunksPerParticipant + ((slot < remainder) ? 1 : 0);
+        m_ranges[slot].value.store(pack_chunk_range(begin, end), std::memory_order_relaxed);
+        begin = end;
+    }
+
+    m_exception = nullptr;
+    m_activeWorkers.store(participants - 1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_function         = function_;
+        m_context          = context_;
+        m_participantCount = participants;
+        ++m_generation;
+    }
+    m_wakeUp.notify_all();
+
+    participate(0);
+
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_done.wait(lock, [this] { return m_activeWorkers.load(std::memory_order_acquire) == 0; });
+    }
+
+    if(m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+
+/**
+ **************************************************************************************************
+ * \brief       Body of a worker thread: sleep until a run needs it, take part, and repeat.
+ *
+ * \param       slot_: Index of the worker's chunk range, 0 being the calling thread's.
+ *************************************************************************************************/
+inline void
+thread_pool::worker_loop(std::size_t slot_)
+{
+    std::uint64_t seenGeneration = 0;
+
+    while(true)
+    {
+        bool participating = false;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_wakeUp.wait(lock, [&] { return m_stopping || (m_generation != seenGeneration); });
+            if(m_stopping)
+            {
+                return;
+            }
+            seenGeneration = m_generation;
+            participating  = slot_ < m_participantCount;
+        }
+
+        if(!participating)
+        {
+            continue;
+        }
+
+        participate(slot_);
+
+        if(m_activeWorkers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_done.notify_one();
+        }
+    }
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Run chunks, own ones first and then stolen ones, until none are left.
+ *
+ * \param       slot_: Index of the participant's chunk range.
+ *************************************************************************************************/
+inline void
+thread_pool::participate(std::size_t slot_)
+{
+    t_insideThreadPool = true;
+
+    std::size_t chunk = 0;
+    while(next_chunk(slot_, chunk))
+    {
+        run_chunk(chunk);
+    }
+
+    t_insideThreadPool = false;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Take the next chunk to run: the front of the participant's own range, or the back
+ *              half of another participant's range, whose remainder becomes the own range.
+ *
+ * \param       slot_:  Index of the participant's chunk range.
+ * \param       chunk_: Receives the chunk to run.
+ *
+ * \retval      bool: `false` once every range is empty.
+ *************************************************************************************************/
+[[nodiscard]] inline bool
+thread_pool::next_chunk(std::size_t slot_, std::size_t& chunk_) noexcept
+{
+    constexpr std::uint64_t endMask = 0xFFFF'FFFFU;
+
+    RangeType&    ownRange = m_ranges[slot_].value;
+    std::uint64_t range    = ownRange.load(std::memory_order_acquire);
+    while((range >> 32U) < (range & endMask))
+    {
+        if(ownRange.compare_exchange_weak(range,
+                                          pack_chunk_range((range >> 32U) + 1, range & endMask),
+                                          std::memory_order_acq_rel))
+        {
+            chunk_ = range >> 32U;
+            return true;
+        }
+    }
+
+    for(std::size_t offset = 1; offset < m_participantCount; ++offset)
+    {
+        RangeType& victimRange = m_ranges[(slot_ + offset) % m_participantCount].value;
+
+        range = victimRange.load(std::memory_order_acquire);
+        while((range >> 32U) < (range & endMask))
+        {
+            const std::uint64_t begin  = range >> 32U;
+            const std::uint64_t end    = range & endMask;
+            const std::uint64_t middle = begin + ((end - begin) / 2);
+            if(victimRange.compare_exchange_weak(
+                 range, pack_chunk_range(begin, middle), std::memory_order_acq_rel))
+            {
+                ownRange.store(pack_chunk_range(middle + 1, end), std::memory_order_release);
+                chunk_ = middle;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ **************************************************************************************************
+ * \brief       Run a chunk, keeping the first exception it throws for `run` to rethrow.
+ *
+ * \param       chunk_: Chunk to run.
+ *************************************************************************************************/
+inline void
+thread_pool::run_chunk(std::size_t chunk_) noexcept
+{
+    try
+    {
+        m_function(m_context, chunk_);
+    }
+    catch(...)
+    {
+        std::lock_guard<std::mutex> lock{m_exceptionMutex};
+        if(!m_exception)
+        {
+            m_exception = std::current_exception();
+        }
+    }
+}
+
+}        // namespace pel
+
+
+/*************************************************************************************************/
+/* END OF FILE --------------------------------------------------------------------------------- */
+/*************************************************************************************************/